@@ -5,7 +5,11 @@ set -e
 Str=`ls src/*.c src/NetworkNAR/*.c | xargs`
 echo $Str
 echo "Compilation started:"
-BaseFlags="-mfpmath=sse -msse2 -pthread -lpthread -D_POSIX_C_SOURCE=199506L -pedantic -std=c99 -g3 -O3 $Str -lm -oNAR"
+OpenMP=""
+if echo "int main(){return 0;}" | gcc -fopenmp -x c - -o /dev/null 2>/dev/null; then
+    OpenMP="-fopenmp"
+fi
+BaseFlags="-mfpmath=sse -msse2 -pthread -lpthread $OpenMP -D_POSIX_C_SOURCE=199506L -pedantic -std=c99 -g3 -O3 $Str -lm -oNAR"
 NoWarn="-Wno-tautological-compare -Wno-dollar-in-identifier-extension -Wno-unused-parameter -Wno-unused-variable"
 gcc -DSTAGE=1 -Wall -Wextra -Wformat-security $NoWarn $BaseFlags
 echo "First stage done, generating RuleTable.c now, and finishing compilation."
@@ -0,0 +1,8 @@
+#!/bin/sh
+#Decision latency per goal (average CPU cycles of Decision_BestCandidate) on the Decision benchmark, and the Testchamber and Robot examples
+echo "Decision benchmark:"
+./NAR bench | grep -E "Goals per second|decision cycles per goal"
+echo "Testchamber:"
+echo bgcghbhaqqqqqqqqhbhadghaqqqqhbhassiiattqqajja.Q | ./NAR testchamber | grep "decision_cycles_per_goal" | tail -n 1
+echo "Robot:"
+./NAR robot 1200 | grep "decision_cycles_per_goal" | tail -n 1
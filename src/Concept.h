@@ -46,9 +46,13 @@ typedef struct {
     Event belief_spike;
     Event predicted_belief;
     Event goal_spike;
-    Table precondition_beliefs[OPERATIONS_MAX+1];
+    Table *precondition_beliefs[OPERATIONS_MAX+1]; //taken from the table pool on first insertion
+    int operationConceptsIndex[OPERATIONS_MAX+1]; //position in operation_concepts while holding the precondition table
     double priority;
+    long priorityTime; //the time the priority was decayed to
+    double priorityKey; //log-scale priority it would have at time 0, which forgetting doesn't change, see Memory_ConceptPriorityKey
     long processID; //avoids duplicate processing
+    int queuePosition; //position in the concepts priority queue, kept by it
 } Concept;
 
 //Methods//
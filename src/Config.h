@@ -64,6 +64,24 @@
 #define EVENT_DURABILITY 0.9999
 //Concept priority decay of events per cycle
 #define CONCEPT_DURABILITY 0.9
+//Whether forgetting is applied lazily, making its cost independent of the amount of concepts
+#define LAZY_FORGETTING_INITIAL false
+//Amount of concept usefulness values re-evaluated per cycle with lazy forgetting
+#define LAZY_FORGETTING_USEFULNESS_UPDATES 16
+//Amount of eviction candidates re-evaluated before a concept is evicted with lazy forgetting
+#define LAZY_FORGETTING_EVICTION_CANDIDATES 8
+//Amount of worker threads for inference, 1 is single-threaded
+#define INFERENCE_THREADS_INITIAL 1
+//Whether single-threaded inference uses the buffered derivations of parallel inference, giving the same results for any thread count
+#define DETERMINISTIC_INFERENCE_INITIAL false
+//Maximum amount of worker threads for inference
+#define INFERENCE_THREADS_MAX 32
+//Maximum amount of buffered derivations added to memory per cycle, in the order of their premises, with parallel or deterministic inference
+#define DERIVATIONS_MAX_INITIAL 4096
+//Whether match attempts, unifications and derivations are counted per inference rule
+#define RULE_STATS_INITIAL false
+//Whether the processor cycles spent per inference rule are measured, if rule stats are enabled
+#define RULE_TIMING_INITIAL false
 //Minimum confidence to accept events
 #define MIN_CONFIDENCE 0.01
 //Minimum priority to accept events
@@ -84,14 +102,14 @@
 /*------------------*/
 /* Space parameters */
 /*------------------*/
-//Maximum amount of concepts
+//Maximum amount of concepts (default, NAR_INIT_Config can set it at runtime)
 #define CONCEPTS_MAX 16384
-//Amount of buckets for concept hashmap
-#define CONCEPTS_HASHTABLE_BUCKETS CONCEPTS_MAX
-//Maximum amount of belief events attention buffer holds
+//Maximum amount of belief events attention buffer holds (default, NAR_INIT_Config can set it at runtime)
 #define CYCLING_BELIEF_EVENTS_MAX 40
-//Maximum amount of goal events attention buffer holds
+//Maximum amount of goal events attention buffer holds (default, NAR_INIT_Config can set it at runtime)
 #define CYCLING_GOAL_EVENTS_MAX 40
+//Amount of hashmap buckets per item the hashmap can hold, each bucket also stores one item of the chains
+#define HASHTABLE_BUCKETS_PER_ITEM 1
 //Maximum amount of operations which can be registered
 #define OPERATIONS_MAX 10
 //Maximum amount of arguments an operation can babble
@@ -102,20 +120,30 @@
 #define FIFO_SIZE 20
 //Maximum Implication table size
 #define TABLE_SIZE 20
+//Amount of concept references in the inverted atom index per concept, twice the amount which can be in use
+#define POSTINGS_PER_CONCEPT (2*UNIFICATION_DEPTH)
+//Maximum amount of implication tables shared by all concepts (default, NAR_INIT_Config can set it at runtime)
+#define PRECONDITION_TABLES_MAX CONCEPTS_MAX
 //Maximum length of sequences
 #define MAX_SEQUENCE_LEN 3
+//Maximum amount of inference rules the rule table generator can dispatch
+#define RULES_MAX 512
 //Maximum compound term size
 #define COMPOUND_TERM_SIZE_MAX 64
-//Max. amount of atomic terms, must be <= 2^(sizeof(Atom)*8)
+//Max. amount of atomic terms, must be <= 2^(sizeof(Atom)*8) (default, NAR_INIT_Config can set a lower one at runtime)
 #define ATOMS_MAX 65536
-//Amount of buckets for atoms hashmap
-#define ATOMS_HASHTABLE_BUCKETS ATOMS_MAX
 //The type of an atom
 #define Atom unsigned short
 //Maximum size of atomic terms in terms of characters
 #define ATOMIC_TERM_LEN_MAX 32
 //Maximum size of Narsese input in terms of characters
 #define NARSESE_LEN_MAX 256
+//Maximum amount of questions answered in one batch
+#define QUESTIONS_MAX 64
+//Amount of lines the shell bulk load collects into one NAR_AddInputNarseseBatch call
+#define NARSESE_BATCH_MAX 256
+//Maximum size of a journal record, which has to hold a shell line
+#define JOURNAL_RECORD_MAX 1024
 
 /*------------------*/
 /* Truth parameters */
@@ -23,24 +23,81 @@
  */
 
 #include "Cycle.h"
+#include "NAR.h"
 
-static long conceptProcessID = 0; //avoids duplicate concept processing
-#define RELATED_CONCEPTS_FOREACH(TERM, CONCEPT, BODY) \
-    for(int _i_=0; _i_<UNIFICATION_DEPTH; _i_++) \
-    { \
-        ConceptChainElement chain_extended = { .c = Memory_FindConceptByTerm(TERM), .next = InvertedAtomIndex_GetConceptChain((TERM)->atoms[_i_]) }; \
-        ConceptChainElement* chain = &chain_extended; \
-        while(chain != NULL) \
-        { \
-            Concept *CONCEPT = chain->c; \
-            chain = chain->next; \
-            if(CONCEPT != NULL && CONCEPT->processID != conceptProcessID) \
-            { \
-                CONCEPT->processID = conceptProcessID; \
-                BODY \
-            } \
-        } \
+static THREAD_LOCAL long conceptProcessID = 0; //avoids duplicate concept processing
+static THREAD_LOCAL ConceptPosting *relatedConcepts; //taken from the memory arena
+static THREAD_LOCAL int usefulnessUpdateIndex = 0; //round-robin storage slot of the lazy usefulness re-evaluation
+THREAD_LOCAL int INFERENCE_THREADS = INFERENCE_THREADS_INITIAL;
+THREAD_LOCAL bool DETERMINISTIC_INFERENCE = DETERMINISTIC_INFERENCE_INITIAL;
+THREAD_LOCAL int DERIVATIONS_MAX = DERIVATIONS_MAX_INITIAL;
+
+void Cycle_INIT()
+{
+    relatedConcepts = Memory_ArenaTake(memoryConfig.conceptsMax, sizeof(ConceptPosting));
+}
+
+void Cycle_SwapState(Cycle_State *state)
+{
+    SWAP_STATE(conceptProcessID, state->conceptProcessID);
+    SWAP_STATE(relatedConcepts, state->relatedConcepts);
+    SWAP_STATE(usefulnessUpdateIndex, state->usefulnessUpdateIndex);
+    SWAP_STATE(INFERENCE_THREADS, state->INFERENCE_THREADS);
+    SWAP_STATE(DETERMINISTIC_INFERENCE, state->DETERMINISTIC_INFERENCE);
+    SWAP_STATE(DERIVATIONS_MAX, state->DERIVATIONS_MAX);
+}
+
+static int Cycle_CompareConceptId(const void *a, const void *b)
+{
+    long id_a = ((ConceptPosting*) a)->id, id_b = ((ConceptPosting*) b)->id;
+    return (id_a > id_b) - (id_a < id_b);
+}
+//Collects the concepts not processed yet into relatedConcepts: the concept of the term first, then the concepts sharing its simple atoms,
+//by atom and in the order they were added, each once, of the latter only the ones with priority key of at least minPriorityKey.
+//Stops after at least maxAmount concepts, the ones collected beyond are not returned but are marked as processed.
+static int Cycle_RelatedConcepts(Term *term, double minPriorityKey, int maxAmount)
+{
+    int amount = 0;
+    Concept *c = Memory_FindConceptByTerm(term);
+    if(c != NULL && c->processID != conceptProcessID)
+    {
+        c->processID = conceptProcessID;
+        relatedConcepts[amount++] = (ConceptPosting) { .c = c, .id = c->id };
     }
+    for(int i=0; i<UNIFICATION_DEPTH && amount < maxAmount; i++)
+    {
+        Atom atom = term->atoms[i];
+        bool firstAppearance = Narsese_IsSimpleAtom(atom);
+        for(int j=0; firstAppearance && j<i; j++)
+        {
+            firstAppearance = term->atoms[j] != atom;
+        }
+        if(!firstAppearance)
+        {
+            continue;
+        }
+        int size;
+        ConceptPosting *postings = InvertedAtomIndex_GetPostings(atom, &size);
+        int start = amount;
+        for(int k=0; k<size && postings[k].priorityKey >= minPriorityKey; k++)
+        {
+            if(postings[k].c->processID != conceptProcessID)
+            {
+                postings[k].c->processID = conceptProcessID;
+                relatedConcepts[amount++] = postings[k];
+            }
+        }
+        qsort(&relatedConcepts[start], amount - start, sizeof(ConceptPosting), Cycle_CompareConceptId);
+    }
+    return MIN(amount, maxAmount);
+}
+
+//The k-th collected related concept, or NULL if its storage was recycled for another concept while the earlier ones were processed
+static Concept *Cycle_RelatedConcept(int k)
+{
+    Concept *c = relatedConcepts[k].c;
+    return c->id == relatedConcepts[k].id ? c : NULL;
+}
 
 //doing inference within the matched concept, returning whether decisionMaking should continue
 static Decision Cycle_ActivateSensorimotorConcept(Concept *c, Event *e, long currentTime)
@@ -73,8 +130,14 @@ static Decision Cycle_ProcessSensorimotorEvent(Event *e, long currentTime)
     //determine the concept it is related to
     bool e_hasVariable = Variable_hasVariable(&e->term, true, true, true);
     conceptProcessID++; //process the to e related concepts
-    RELATED_CONCEPTS_FOREACH(&e->term, c,
+    int relatedAmount = Cycle_RelatedConcepts(&e->term, -INFINITY, memoryConfig.conceptsMax);
+    for(int k=0; k<relatedAmount; k++)
     {
+        Concept *c = Cycle_RelatedConcept(k);
+        if(c == NULL)
+        {
+            continue;
+        }
         Event ecp = *e;
         if(!e_hasVariable)  //concept matched to the event which doesn't have variables
         {
@@ -106,7 +169,7 @@ static Decision Cycle_ProcessSensorimotorEvent(Event *e, long currentTime)
                 }
             }
         }
-    })
+    }
     return best_decision;
 }
 
@@ -117,7 +180,7 @@ void Cycle_PopEvents(Event *selectionArray, double *selectionPriority, int *sele
     {
         Event *e;
         double priority = 0;
-        if(!PriorityQueue_PopMax(queue, (void**) &e, &priority))
+        if(!Memory_PopCyclingEvent(queue, &e, &priority))
         {
             assert(queue->itemsAmount == 0, "No item was popped, only acceptable reason is when it's empty");
             IN_DEBUG( puts("Selecting event failed, maybe there is no event left."); )
@@ -162,9 +225,12 @@ bool Cycle_GoalSequenceDecomposition(Event *selectedGoal, double selectedGoalPri
         double best_exp = 0.0;
         //the concept with belief event of highest truth exp
         conceptProcessID++;
-        RELATED_CONCEPTS_FOREACH(componentGoal, c,
+        //no need to search another concept if the component doesn't have a var, as the first concept is the only one
+        int relatedAmount = Cycle_RelatedConcepts(componentGoal, -INFINITY, Variable_hasVariable(componentGoal, true, true, true) ? memoryConfig.conceptsMax : 1);
+        for(int k=0; k<relatedAmount; k++)
         {
-            if(!Variable_hasVariable(&c->term, true, true, true))  //concept matched to the event which doesn't have variables
+            Concept *c = Cycle_RelatedConcept(k);
+            if(c != NULL && !Variable_hasVariable(&c->term, true, true, true))  //concept matched to the event which doesn't have variables
             {
                 Substitution subs = Variable_Unify(componentGoal, &c->term); //event with variable matched to concept
                 if(subs.success)
@@ -207,13 +273,7 @@ bool Cycle_GoalSequenceDecomposition(Event *selectedGoal, double selectedGoalPri
                     }
                 }
             }
-            //no need to search another concept, as it didn't have a var so the concept we just iterated is the only one
-            if(!Variable_hasVariable(componentGoal, true, true, true))
-            {
-                goto DONE_CONCEPT_ITERATING;
-            }
-        })
-        DONE_CONCEPT_ITERATING:
+        }
         //no corresponding belief
         if(best_c == NULL)
         {
@@ -268,7 +328,7 @@ static void Cycle_ProcessInputGoalEvents(long currentTime)
     if(best_decision.execute && best_decision.operationID > 0)
     {
         //reset cycling goal events after execution to avoid "residue actions"
-        PriorityQueue_INIT(&cycling_goal_events, cycling_goal_events.items, cycling_goal_events.maxElements);
+        Memory_ClearCyclingEvents(&cycling_goal_events);
         //also don't re-add the selected goal:
         goalsSelectedCnt = 0;
         //execute decision
@@ -279,20 +339,23 @@ static void Cycle_ProcessInputGoalEvents(long currentTime)
     {
         Event *goal = &selectedGoals[i];
         conceptProcessID++; //process subgoaling for the related concepts for each selected goal
-        RELATED_CONCEPTS_FOREACH(&goal->term, c,
+        int relatedAmount = Cycle_RelatedConcepts(&goal->term, -INFINITY, memoryConfig.conceptsMax);
+        for(int k=0; k<relatedAmount; k++)
         {
-            if(Variable_Unify(&c->term, &goal->term).success)
+            Concept *c = Cycle_RelatedConcept(k);
+            if(c != NULL && Variable_Unify(&c->term, &goal->term).success)
             {
                 bool revised;
                 c->goal_spike = Inference_RevisionAndChoice(&c->goal_spike, goal, currentTime, &revised);
                 for(int opi=NOP_SUBGOALING ? 0 : 1; opi<=OPERATIONS_MAX; opi++)
                 {
-                    for(int j=0; j<c->precondition_beliefs[opi].itemsAmount; j++)
+                    Table *table = c->precondition_beliefs[opi];
+                    for(int j=0; table != NULL && j<table->itemsAmount; j++)
                     {
-                        Implication *imp = &c->precondition_beliefs[opi].array[j];
+                        Implication *imp = &table->array[j];
                         if(!Memory_ImplicationValid(imp))
                         {
-                            Table_Remove(&c->precondition_beliefs[opi], j);
+                            Table_Remove(table, j);
                             j--;
                             continue;
                         }
@@ -311,7 +374,7 @@ static void Cycle_ProcessInputGoalEvents(long currentTime)
                     }
                 }
             }
-        })
+        }
     }
 }
 
@@ -336,7 +399,7 @@ static void Cycle_ReinforceLink(Event *a, Event *b)
             {
                 if(precondition_implication.truth.confidence >= MIN_CONFIDENCE)
                 {
-                    NAL_DerivedEvent(precondition_implication.term, currentTime, precondition_implication.truth, precondition_implication.stamp, currentTime, 1, 1, precondition_implication.occurrenceTimeOffset, NULL, 0, true);
+                    NAL_DerivedEvent(precondition_implication.term, currentTime, precondition_implication.truth, precondition_implication.stamp, currentTime, 1, 1, precondition_implication.occurrenceTimeOffset, NULL, 0, true, -1);
                 }
             }
         }
@@ -346,12 +409,12 @@ static void Cycle_ReinforceLink(Event *a, Event *b)
 void Cycle_ProcessInputBeliefEvents(long currentTime)
 {
     //1. process newest event
-    if(belief_events.itemsAmount > 0)
+    if(belief_events->itemsAmount > 0)
     {
         //form concepts for the sequences of different length
         for(int state=(1 << MAX_SEQUENCE_LEN)-1; state>=1; state--)
         {
-            Event *toProcess = FIFO_GetNewestSequence(&belief_events, state);
+            Event *toProcess = FIFO_GetNewestSequence(belief_events, state);
             if(toProcess != NULL && !toProcess->processed && toProcess->type != EVENT_TYPE_DELETED)
             {
                 Concept *c = Memory_Conceptualize(&toProcess->term, currentTime);
@@ -368,11 +431,11 @@ void Cycle_ProcessInputBeliefEvents(long currentTime)
                     int op_id = Memory_getOperationID(&postcondition.term);
                     Term op_term = Narsese_getOperationTerm(&postcondition.term);
                     Decision_Anticipate(op_id, op_term, currentTime); //collection of negative evidence, new way
-                    for(int k=1; k<belief_events.itemsAmount; k++)
+                    for(int k=1; k<belief_events->itemsAmount; k++)
                     {
                         for(int state2=1; state2<(1 << MAX_SEQUENCE_LEN); state2++)
                         {
-                            Event *precondition = FIFO_GetKthNewestSequence(&belief_events, k, state2);
+                            Event *precondition = FIFO_GetKthNewestSequence(belief_events, k, state2);
                             if(precondition != NULL && precondition->type != EVENT_TYPE_DELETED)
                             {
                                 if(state2 > 1)
@@ -387,7 +450,7 @@ void Cycle_ProcessInputBeliefEvents(long currentTime)
                                         {
                                             if(k+shift < FIFO_SIZE)
                                             {
-                                                Event *potential_op = FIFO_GetKthNewestSequence(&belief_events, k+shift, 1);
+                                                Event *potential_op = FIFO_GetKthNewestSequence(belief_events, k+shift, 1);
                                                 if(potential_op != NULL && potential_op->type != EVENT_TYPE_DELETED && Narsese_isOperation(&potential_op->term))
                                                 {
                                                     goto CONTINUE;
@@ -429,7 +492,7 @@ void Cycle_SpecialInferences(Term term1, Term term2, Truth truth1, Truth truth2,
             Truth conclusionTruth = IsImpl ? Truth_Deduction(truth2, truth1) : Truth_Analogy(truth2, truth1);
             if(success)
             {
-                NAL_DerivedEvent(conclusionTerm, conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false);
+                NAL_DerivedEvent(conclusionTerm, conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false, -1);
             }
         }
         //Deduction with remaining condition
@@ -457,7 +520,7 @@ void Cycle_SpecialInferences(Term term1, Term term2, Truth truth1, Truth truth2,
                     Truth conclusionTruth = Truth_Deduction(truth2, truth1);
                     if(success)
                     {
-                        NAL_DerivedEvent(conclusionTerm, conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false);
+                        NAL_DerivedEvent(conclusionTerm, conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false, -1);
                     }
                 }
             }
@@ -471,7 +534,7 @@ void Cycle_SpecialInferences(Term term1, Term term2, Truth truth1, Truth truth2,
             Truth conclusionTruth = IsImpl ? Truth_Abduction(truth2, truth1) : Truth_Analogy(truth2, truth1);
             if(success)
             {
-                NAL_DerivedEvent(conclusionTerm, conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false);
+                NAL_DerivedEvent(conclusionTerm, conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false, -1);
             }
         }
     }
@@ -488,17 +551,114 @@ void Cycle_SpecialInferences(Term term1, Term term2, Truth truth1, Truth truth2,
             Truth conclusionTruth = Truth_AnonymousAnalogy(truth2, truth1);
             if(success)
             {
-                NAL_DerivedEvent(conclusionTerm, conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false);
+                NAL_DerivedEvent(conclusionTerm, conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false, -1);
             }
         }
     }
 #endif
 }
 
+#if STAGE==2
+//Premises collected for parallel inference
+typedef struct
+{
+    Event *e;
+    double priority;
+    Concept *c; //NULL for single-premise inference
+    double conceptPriority;
+    long validation_cid;
+    Event belief;
+    Stamp stamp;
+    int derivationsAmount; //how many derivations the task buffered
+}InferenceTask;
+//the single-premise inference is repeated for each threshold adaptation round, of which there can be as many as matched concepts
+#define INFERENCE_TASKS_MAX (BELIEF_EVENT_SELECTIONS*2*(BELIEF_CONCEPT_MATCH_TARGET+1))
+static THREAD_LOCAL InferenceTask inferenceTasks[INFERENCE_TASKS_MAX];
+static THREAD_LOCAL int inferenceTasksAmount = 0;
+static THREAD_LOCAL NAL_Derivations inferenceDerivations[INFERENCE_THREADS_MAX];
+
+static void Cycle_ApplyRules(Event *e, double priority, Concept *c, double conceptPriority, long validation_cid, Event *belief, Stamp stamp, long currentTime)
+{
+    if(c == NULL)
+    {
+        Term dummy_term = {0};
+        Truth dummy_truth = {0};
+        RuleTable_Apply(e->term, dummy_term, e->truth, dummy_truth, e->occurrenceTime, 0, e->stamp, currentTime, priority, 1, false, NULL, 0);
+        return;
+    }
+    RuleTable_Apply(e->term, c->term, e->truth, belief->truth, e->occurrenceTime, e->occurrenceTimeOffset, stamp, currentTime, priority, conceptPriority, true, c, validation_cid);
+    Cycle_SpecialInferences(e->term, c->term, e->truth, belief->truth, e->occurrenceTime, e->occurrenceTimeOffset, stamp, currentTime, priority, conceptPriority, true, c, validation_cid);
+    Cycle_SpecialInferences(c->term, e->term, belief->truth, e->truth, e->occurrenceTime, e->occurrenceTimeOffset, stamp, currentTime, priority, conceptPriority, true, c, validation_cid);
+}
+
+//Apply the rules now, or with parallel inference, collect the premises to apply them later
+static void Cycle_ScheduleRules(bool parallel, Event *e, double priority, Concept *c, double conceptPriority, long validation_cid, Event *belief, Stamp stamp, long currentTime)
+{
+    if(!parallel)
+    {
+        Cycle_ApplyRules(e, priority, c, conceptPriority, validation_cid, belief, stamp, currentTime);
+        return;
+    }
+    assert(inferenceTasksAmount < INFERENCE_TASKS_MAX, "Too many inference tasks");
+    InferenceTask *task = &inferenceTasks[inferenceTasksAmount++];
+    *task = (InferenceTask) { .e = e, .priority = priority, .c = c, .conceptPriority = conceptPriority, .validation_cid = validation_cid, .stamp = stamp };
+    if(belief != NULL)
+    {
+        task->belief = *belief;
+    }
+}
+
+//Apply the collected inference tasks on worker threads, each buffering its derivations, which are added to memory afterwards
+static void Cycle_ApplyRulesParallel(long currentTime)
+{
+    int threads = MAX(1, MIN(INFERENCE_THREADS, INFERENCE_THREADS_MAX));
+    //the tasks and buffers are the ones of this thread, the workers are bound to the selected instance of this thread
+    InferenceTask *tasks = inferenceTasks;
+    int tasksAmount = inferenceTasksAmount;
+    NAL_Derivations *derivations = inferenceDerivations;
+    NAR *nar = NAR_Share();
+    #pragma omp parallel for num_threads(threads) schedule(static, 1)
+    for(int t=0; t<threads; t++)
+    {
+        NAR binding;
+        NAR_Bind(&binding, nar);
+        NAL_derivations = &derivations[t];
+        for(int i=t; i<tasksAmount; i+=threads)
+        {
+            InferenceTask *task = &tasks[i];
+            int derivationsBefore = NAL_derivations->itemsAmount;
+            Cycle_ApplyRules(task->e, task->priority, task->c, task->conceptPriority, task->validation_cid, &task->belief, task->stamp, currentTime);
+            task->derivationsAmount = NAL_derivations->itemsAmount - derivationsBefore;
+        }
+        NAL_derivations = NULL;
+        NAR_Unbind(&binding);
+    }
+    NAR_Unshare(nar);
+    //Add the derivations ordered by task (selected event and source concept) and then by rule order within the task, independent of the thread count,
+    //which the buffers hold all of, so that the ones beyond DERIVATIONS_MAX are the same ones for any thread count
+    int from[INFERENCE_THREADS_MAX] = {0};
+    int added = 0;
+    for(int i=0; i<inferenceTasksAmount; i++)
+    {
+        int t = i % threads;
+        int amount = MIN(inferenceTasks[i].derivationsAmount, DERIVATIONS_MAX - added);
+        NAL_AddDerivations(&inferenceDerivations[t], from[t], amount, currentTime);
+        from[t] += inferenceTasks[i].derivationsAmount;
+        added += amount;
+    }
+    for(int t=0; t<threads; t++)
+    {
+        inferenceDerivations[t].itemsAmount = 0;
+    }
+    inferenceTasksAmount = 0;
+}
+#endif
+
 void Cycle_Inference(long currentTime)
 {
     //Inferences
 #if STAGE==2
+    bool parallel = INFERENCE_THREADS > 1 || DETERMINISTIC_INFERENCE;
     for(int i=0; i<beliefsSelectedCnt; i++)
     {
         conceptProcessID++; //process the related belief concepts
@@ -517,13 +677,19 @@ void Cycle_Inference(long currentTime)
             //IN_DEBUG( printf("conceptPriorityThreshold=%f\n", conceptPriorityThreshold); )
             Event *e = &selectedBeliefs[i];
             double priority = selectedBeliefsPriority[i];
-            Term dummy_term = {0};
-            Truth dummy_truth = {0};
-            RuleTable_Apply(e->term, dummy_term, e->truth, dummy_truth, e->occurrenceTime, 0, e->stamp, currentTime, priority, 1, false, NULL, 0);
-            RELATED_CONCEPTS_FOREACH(&e->term, c,
+            Cycle_ScheduleRules(parallel, e, priority, NULL, 0, 0, NULL, e->stamp, currentTime);
+            double priorityKeyThreshold = Memory_ConceptPriorityKey(conceptPriorityThresholdCurrent, currentTime); //the concepts below are not visited
+            int relatedAmount = Cycle_RelatedConcepts(&e->term, priorityKeyThreshold, memoryConfig.conceptsMax);
+            for(int k=0; k<relatedAmount; k++)
             {
+                Concept *c = Cycle_RelatedConcept(k);
+                if(c == NULL)
+                {
+                    continue;
+                }
                 long validation_cid = c->id; //allows for lockfree rule table application (only adding to memory is locked)
-                if(c->priority < conceptPriorityThresholdCurrent)
+                double conceptPriority = Memory_ConceptPriority(c, currentTime); //decayed on read, so it's computed once for the premise
+                if(conceptPriority < conceptPriorityThresholdCurrent)
                 {
                     continue;
                 }
@@ -557,7 +723,7 @@ void Cycle_Inference(long currentTime)
                     {
                         c->usage = Usage_use(c->usage, currentTime, false);
                         Stamp stamp = Stamp_make(&e->stamp, &belief->stamp);
-                        if(PRINT_CONTROL_INFO)
+                        if(PRINT_CONTROL_INFO && !Journal_Replaying())
                         {
                             fputs("Apply rule table on ", stdout);
                             Narsese_PrintTerm(&e->term);
@@ -566,12 +732,10 @@ void Cycle_Inference(long currentTime)
                             Narsese_PrintTerm(&c->term);
                             puts("");
                         }
-                        RuleTable_Apply(e->term, c->term, e->truth, belief->truth, e->occurrenceTime, e->occurrenceTimeOffset, stamp, currentTime, priority, c->priority, true, c, validation_cid);
-                        Cycle_SpecialInferences(e->term, c->term, e->truth, belief->truth, e->occurrenceTime, e->occurrenceTimeOffset, stamp, currentTime, priority, c->priority, true, c, validation_cid);
-                        Cycle_SpecialInferences(c->term, e->term, belief->truth, e->truth, e->occurrenceTime, e->occurrenceTimeOffset, stamp, currentTime, priority, c->priority, true, c, validation_cid);
+                        Cycle_ScheduleRules(parallel, e, priority, c, conceptPriority, validation_cid, belief, stamp, currentTime);
                     }
                 }
-            })
+            }
             if(countConceptsMatched > Stats_countConceptsMatchedMax)
             {
                 Stats_countConceptsMatchedMax = countConceptsMatched;
@@ -582,6 +746,10 @@ void Cycle_Inference(long currentTime)
             }
         }
     }
+    if(parallel)
+    {
+        Cycle_ApplyRulesParallel(currentTime);
+    }
 #endif
 }
 
@@ -597,21 +765,40 @@ void Cycle_RelativeForgetting(long currentTime)
         cycling_goal_events.items[i].priority *= EVENT_DURABILITY;
     }
     //Apply concept forgetting:
-    for(int i=0; i<concepts.itemsAmount; i++)
+    if(LAZY_FORGETTING)
     {
-        Concept *c = concepts.items[i].address;
-        c->priority *= CONCEPT_DURABILITY;
-        concepts.items[i].priority = Usage_usefulness(c->usage, currentTime); //how concept memory is sorted by, by concept usefulness
+        //concept priority decays when read, and only a few concepts get their usefulness re-evaluated,
+        //visited by storage slot, as the update changes the queue positions
+        for(int k=0; k<LAZY_FORGETTING_USEFULNESS_UPDATES && concepts.itemsAmount > 0; k++)
+        {
+            usefulnessUpdateIndex = (usefulnessUpdateIndex + 1) % concepts.itemsAmount;
+            Concept *c = &concept_storage[usefulnessUpdateIndex];
+            IN_DEBUG( assert(concepts.items[c->queuePosition].address == c, "Concept not at its kept queue position!"); )
+            PriorityQueue_PopAt(&concepts, c->queuePosition, NULL);
+            PriorityQueue_Push(&concepts, Usage_usefulness(c->usage, currentTime)); //takes the popped item's place again
+        }
+    }
+    else
+    {
+        for(int i=0; i<concepts.itemsAmount; i++)
+        {
+            Concept *c = concepts.items[i].address;
+            Memory_SetConceptPriority(c, c->priority * CONCEPT_DURABILITY, currentTime+1);
+            concepts.items[i].priority = Usage_usefulness(c->usage, currentTime); //how concept memory is sorted by, by concept usefulness
+        }
+        PriorityQueue_Rebuild(&concepts);
     }
     //Re-sort queues
-    PriorityQueue_Rebuild(&concepts);
     PriorityQueue_Rebuild(&cycling_belief_events);
     PriorityQueue_Rebuild(&cycling_goal_events);
 }
 
 void Cycle_Perform(long currentTime)
 {   
-    Metric_send("NARNode.Cycle", 1);
+    if(!Journal_Replaying())
+    {
+        Metric_send("NARNode.Cycle", 1);
+    }
     //1. Retrieve BELIEF/GOAL_EVENT_SELECTIONS events from cyclings events priority queue (which includes both input and derivations)
     Cycle_PopEvents(selectedGoals, selectedGoalsPriority, &goalsSelectedCnt, &cycling_goal_events, GOAL_EVENT_SELECTIONS);
     Cycle_PopEvents(selectedBeliefs, selectedBeliefsPriority, &beliefsSelectedCnt, &cycling_belief_events, BELIEF_EVENT_SELECTIONS);
@@ -41,9 +41,35 @@
 #include "Stats.h"
 #include "./NetworkNAR/Metric.h"
 
+//Parameters//
+//----------//
+extern THREAD_LOCAL int INFERENCE_THREADS;
+extern THREAD_LOCAL bool DETERMINISTIC_INFERENCE;
+extern THREAD_LOCAL int DERIVATIONS_MAX;
+
+//Data structure//
+//--------------//
+//Parameters and state of a reasoner instance
+typedef struct
+{
+    long conceptProcessID;
+    ConceptPosting *relatedConcepts;
+    int usefulnessUpdateIndex;
+    int INFERENCE_THREADS;
+    bool DETERMINISTIC_INFERENCE;
+    int DERIVATIONS_MAX;
+}Cycle_State;
+#define CYCLE_STATE_INITIAL ((Cycle_State) { .INFERENCE_THREADS = INFERENCE_THREADS_INITIAL, .DETERMINISTIC_INFERENCE = DETERMINISTIC_INFERENCE_INITIAL, .DERIVATIONS_MAX = DERIVATIONS_MAX_INITIAL })
+
 //Methods//
 //-------//
+//Init module, after Memory_INIT as its buffers are taken from the memory arena
+void Cycle_INIT();
+//Exchange the parameters and state with the ones kept for a reasoner instance
+void Cycle_SwapState(Cycle_State *state);
 //Apply one operating cyle
 void Cycle_Perform(long currentTime);
+//Apply relative forgetting to concepts and events
+void Cycle_RelativeForgetting(long currentTime);
 
 #endif
@@ -23,18 +23,38 @@
  */
 
 #include "Decision.h"
+#include "NAR.h"
 
-double CONDITION_THRESHOLD = CONDITION_THRESHOLD_INITIAL;
-double DECISION_THRESHOLD = DECISION_THRESHOLD_INITIAL;
-double ANTICIPATION_THRESHOLD = ANTICIPATION_THRESHOLD_INITIAL;
-double ANTICIPATION_CONFIDENCE = ANTICIPATION_CONFIDENCE_INITIAL;
-double MOTOR_BABBLING_CHANCE = MOTOR_BABBLING_CHANCE_INITIAL;
-int BABBLING_OPS = OPERATIONS_MAX;
-int anticipationStampID = -1;
+THREAD_LOCAL double CONDITION_THRESHOLD = CONDITION_THRESHOLD_INITIAL;
+THREAD_LOCAL double DECISION_THRESHOLD = DECISION_THRESHOLD_INITIAL;
+THREAD_LOCAL double ANTICIPATION_THRESHOLD = ANTICIPATION_THRESHOLD_INITIAL;
+THREAD_LOCAL double ANTICIPATION_CONFIDENCE = ANTICIPATION_CONFIDENCE_INITIAL;
+THREAD_LOCAL double MOTOR_BABBLING_CHANCE = MOTOR_BABBLING_CHANCE_INITIAL;
+THREAD_LOCAL int BABBLING_OPS = OPERATIONS_MAX;
+THREAD_LOCAL int anticipationStampID = -1;
+
+//The concepts which can unify with a precondition, and the ones anticipating for an operation, taken from the memory arena
+static THREAD_LOCAL Concept **preconditionCandidates;
+static THREAD_LOCAL Concept **anticipating_concepts;
 
 void Decision_INIT()
 {
     anticipationStampID = -1;
+    preconditionCandidates = Memory_ArenaTake(memoryConfig.conceptsMax, sizeof(Concept*));
+    anticipating_concepts = Memory_ArenaTake(memoryConfig.preconditionTablesMax, sizeof(Concept*));
+}
+
+void Decision_SwapState(Decision_State *state)
+{
+    SWAP_STATE(CONDITION_THRESHOLD, state->CONDITION_THRESHOLD);
+    SWAP_STATE(DECISION_THRESHOLD, state->DECISION_THRESHOLD);
+    SWAP_STATE(ANTICIPATION_THRESHOLD, state->ANTICIPATION_THRESHOLD);
+    SWAP_STATE(ANTICIPATION_CONFIDENCE, state->ANTICIPATION_CONFIDENCE);
+    SWAP_STATE(MOTOR_BABBLING_CHANCE, state->MOTOR_BABBLING_CHANCE);
+    SWAP_STATE(BABBLING_OPS, state->BABBLING_OPS);
+    SWAP_STATE(anticipationStampID, state->anticipationStampID);
+    SWAP_STATE(preconditionCandidates, state->preconditionCandidates);
+    SWAP_STATE(anticipating_concepts, state->anticipating_concepts);
 }
 
 static void Decision_AddNegativeConfirmation(Event *precondition, Implication imp, int operationID, Concept *postc)
@@ -43,10 +63,11 @@ static void Decision_AddNegativeConfirmation(Event *precondition, Implication im
     Truth TNew = { .frequency = 0.0, .confidence = ANTICIPATION_CONFIDENCE };
     Truth TPast = Truth_Projection(precondition->truth, 0, round(imp.occurrenceTimeOffset));
     negative_confirmation.truth = Truth_Eternalize(Truth_Induction(TNew, TPast));
-    negative_confirmation.stamp = (Stamp) { .evidentalBase = { -anticipationStampID } };
+    negative_confirmation.stamp = Stamp_input(-anticipationStampID);
     anticipationStampID--;
     assert(negative_confirmation.truth.confidence >= 0.0 && negative_confirmation.truth.confidence <= 1.0, "(666) confidence out of bounds");
-    Implication *added = Table_AddAndRevise(&postc->precondition_beliefs[operationID], &negative_confirmation);
+    Table *table = Memory_PreconditionTable(postc, operationID);
+    Implication *added = table == NULL ? NULL : Table_AddAndRevise(table, &negative_confirmation);
     if(added != NULL)
     {
         added->sourceConcept = negative_confirmation.sourceConcept;
@@ -71,8 +92,14 @@ void Decision_Execute(Decision *decision)
         }
         feedback = operation;
     }
-    Narsese_PrintTerm(&decision->op.term); fputs(" executed with args ", stdout); Narsese_PrintTerm(&decision->arguments); puts(""); fflush(stdout);
-    (*decision->op.action)(decision->arguments);
+    if(!Journal_Replaying())
+    {
+        Narsese_PrintTerm(&decision->op.term); fputs(" executed with args ", stdout); Narsese_PrintTerm(&decision->arguments); puts(""); fflush(stdout);
+    }
+    if(decision->op.action != NULL) //operations loaded from a snapshot have none until they are registered again
+    {
+        (*decision->op.action)(decision->arguments);
+    }
     NAR_AddInputBelief(feedback);
     //assumption of failure extension to specific cases not experienced before:
     if(ANTICIPATE_FOR_NOT_EXISTING_SPECIFIC_TEMPORAL_IMPLICATION && decision->missing_specific_implication.term.atoms[0])
@@ -173,8 +200,35 @@ static Decision Decision_ConsiderImplication(long currentTime, Event *goal, int
     return decision;
 }
 
+//The concepts which can unify with the precondition: its own concept if it has no variable, else the concepts containing its rarest atom,
+//as they need to have its atoms at the same positions, which are in the inverted atom index when within the unification depth
+static int Decision_PreconditionCandidates(Term *precondition)
+{
+    if(!Variable_hasVariable(precondition, true, true, true))
+    {
+        preconditionCandidates[0] = Memory_FindConceptByTerm(precondition);
+        return preconditionCandidates[0] != NULL;
+    }
+    int size;
+    ConceptPosting *postings = InvertedAtomIndex_GetRarestPostings(precondition, &size);
+    if(postings == NULL) //no atom to look up, all concepts are candidates
+    {
+        for(int i=0; i<concepts.itemsAmount; i++)
+        {
+            preconditionCandidates[i] = concepts.items[i].address;
+        }
+        return concepts.itemsAmount;
+    }
+    for(int i=0; i<size; i++)
+    {
+        preconditionCandidates[i] = postings[i].c;
+    }
+    return size;
+}
+
 Decision Decision_BestCandidate(Concept *goalconcept, Event *goal, long currentTime)
 {
+    unsigned long long startCycles = Stats_Cycles();
     Decision decision = {0};
     Implication bestImp = {0};
     long bestComplexity = COMPOUND_TERM_SIZE_MAX+1;
@@ -183,14 +237,15 @@ Decision Decision_BestCandidate(Concept *goalconcept, Event *goal, long currentT
     {
         for(int opi=1; opi<=OPERATIONS_MAX && operations[opi-1].term.atoms[0] != 0; opi++)
         {
-            for(int j=0; j<goalconcept->precondition_beliefs[opi].itemsAmount; j++)
+            Table *table = goalconcept->precondition_beliefs[opi];
+            for(int j=0; table != NULL && j<table->itemsAmount; j++)
             {
-                if(!Memory_ImplicationValid(&goalconcept->precondition_beliefs[opi].array[j]))
+                if(!Memory_ImplicationValid(&table->array[j]))
                 {
-                    Table_Remove(&goalconcept->precondition_beliefs[opi], j--);
+                    Table_Remove(table, j--);
                     continue;
                 }
-                Implication imp = goalconcept->precondition_beliefs[opi].array[j];
+                Implication imp = table->array[j];
                 bool impHasVariable = Variable_hasVariable(&imp.term, true, true, true);
                 bool success;
                 imp.term = Variable_ApplySubstitute(imp.term, subs, &success);
@@ -199,9 +254,10 @@ Decision Decision_BestCandidate(Concept *goalconcept, Event *goal, long currentT
                     assert(Narsese_copulaEquals(imp.term.atoms[0], TEMPORAL_IMPLICATION), "This should be a temporal implication!");
                     Term left_side_with_op = Term_ExtractSubterm(&imp.term, 1);
                     Term left_side = Narsese_GetPreconditionWithoutOp(&left_side_with_op); //might be something like <#1 --> a>
-                    for(int cmatch_k=0; cmatch_k<concepts.itemsAmount; cmatch_k++)
+                    int candidates = Decision_PreconditionCandidates(&left_side);
+                    for(int cmatch_k=0; cmatch_k<candidates; cmatch_k++)
                     {
-                        Concept *cmatch = concepts.items[cmatch_k].address;
+                        Concept *cmatch = preconditionCandidates[cmatch_k];
                         if(!Variable_hasVariable(&cmatch->term, true, true, true))
                         {
                             Substitution subs2 = Variable_Unify(&left_side, &cmatch->term);
@@ -222,11 +278,12 @@ Decision Decision_BestCandidate(Concept *goalconcept, Event *goal, long currentT
                                         Term predicate = Term_ExtractSubterm(&specific_imp.term, 2);
                                         Concept *relatedc = Memory_FindConceptByTerm(&predicate);
                                         bool hypothesis_existed = false;
-                                        if(relatedc != NULL)
+                                        if(relatedc != NULL && relatedc->precondition_beliefs[opi] != NULL)
                                         {
-                                            for(int jj=0; jj<relatedc->precondition_beliefs[opi].itemsAmount; jj++)
+                                            Table *relatedtable = relatedc->precondition_beliefs[opi];
+                                            for(int jj=0; jj<relatedtable->itemsAmount; jj++)
                                             {
-                                                Implication *relatedimp = &relatedc->precondition_beliefs[opi].array[jj];
+                                                Implication *relatedimp = &relatedtable->array[jj];
                                                 bool specific_exists = Term_Equal(&specific_imp.term, &relatedimp->term);
                                                 if(specific_exists)
                                                 {
@@ -266,15 +323,20 @@ Decision Decision_BestCandidate(Concept *goalconcept, Event *goal, long currentT
             }
         }
     }
+    Stats_countDecisionGoals++;
+    Stats_countDecisionCycles += Stats_Cycles() - startCycles;
     if(decision.desire < DECISION_THRESHOLD)
     {
         return (Decision) {0}; 
     }
     //set execute and return execution
-    printf("decision expectation=%f implication: ", decision.desire);
-    Narsese_PrintTerm(&bestImp.term); printf(". Truth: frequency=%f confidence=%f dt=%f", bestImp.truth.frequency, bestImp.truth.confidence, bestImp.occurrenceTimeOffset); 
-    fputs(" precondition: ", stdout); Narsese_PrintTerm(&decision.reason->term); fputs(". :|: ", stdout);  printf("Truth: frequency=%f confidence=%f", decision.reason->truth.frequency, decision.reason->truth.confidence); 
-    printf(" occurrenceTime=%ld\n", decision.reason->occurrenceTime);
+    if(!Journal_Replaying())
+    {
+        printf("decision expectation=%f implication: ", decision.desire);
+        Narsese_PrintTerm(&bestImp.term); printf(". Truth: frequency=%f confidence=%f dt=%f", bestImp.truth.frequency, bestImp.truth.confidence, bestImp.occurrenceTimeOffset); 
+        fputs(" precondition: ", stdout); Narsese_PrintTerm(&decision.reason->term); fputs(". :|: ", stdout);  printf("Truth: frequency=%f confidence=%f", decision.reason->truth.frequency, decision.reason->truth.confidence); 
+        printf(" occurrenceTime=%ld\n", decision.reason->occurrenceTime);
+    }
     decision.execute = true;
     return decision;
 }
@@ -282,18 +344,22 @@ Decision Decision_BestCandidate(Concept *goalconcept, Event *goal, long currentT
 void Decision_Anticipate(int operationID, Term opTerm, long currentTime)
 {
     assert(operationID >= 0 && operationID <= OPERATIONS_MAX, "Wrong operation id, did you inject an event manually?");
-    for(int j=0; j<concepts.itemsAmount; j++)
+    //only the concepts holding implications for the operation are relevant, copied as conceptualizing the predictions can recycle them
+    int anticipating_conceptsAmount = operation_conceptsAmount[operationID];
+    memcpy(anticipating_concepts, operation_concepts[operationID], anticipating_conceptsAmount * sizeof(Concept*));
+    for(int j=0; j<anticipating_conceptsAmount; j++)
     {
-        Concept *postc = concepts.items[j].address;
-        for(int  h=0; h<postc->precondition_beliefs[operationID].itemsAmount; h++)
+        Concept *postc = anticipating_concepts[j];
+        Table *table = postc->precondition_beliefs[operationID];
+        for(int h=0; table != NULL && h<table->itemsAmount; h++)
         {
-            if(!Memory_ImplicationValid(&postc->precondition_beliefs[operationID].array[h]))
+            if(!Memory_ImplicationValid(&table->array[h]))
             {
-                Table_Remove(&postc->precondition_beliefs[operationID], h);
+                Table_Remove(table, h);
                 h--;
                 continue;
             }
-            Implication imp = postc->precondition_beliefs[operationID].array[h]; //(&/,a,op) =/> b.
+            Implication imp = table->array[h]; //(&/,a,op) =/> b.
             Concept *current_prec = imp.sourceConcept;
             Event *precondition = &current_prec->belief_spike;
             if(precondition != NULL && precondition->type != EVENT_TYPE_DELETED)
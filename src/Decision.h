@@ -35,17 +35,16 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include "Memory.h"
-#include "NAR.h"
 #include "Config.h"
 
 //Parameters//
 //----------//
-extern double CONDITION_THRESHOLD;
-extern double DECISION_THRESHOLD;
-extern double ANTICIPATION_THRESHOLD;
-extern double ANTICIPATION_CONFIDENCE;
-extern double MOTOR_BABBLING_CHANCE;
-extern int BABBLING_OPS;
+extern THREAD_LOCAL double CONDITION_THRESHOLD;
+extern THREAD_LOCAL double DECISION_THRESHOLD;
+extern THREAD_LOCAL double ANTICIPATION_THRESHOLD;
+extern THREAD_LOCAL double ANTICIPATION_CONFIDENCE;
+extern THREAD_LOCAL double MOTOR_BABBLING_CHANCE;
+extern THREAD_LOCAL int BABBLING_OPS;
 
 //Data structure//
 //--------------//
@@ -59,11 +58,28 @@ typedef struct
     Implication missing_specific_implication;
     Event *reason;
 }Decision;
+//Parameters and state of a reasoner instance
+typedef struct
+{
+    double CONDITION_THRESHOLD;
+    double DECISION_THRESHOLD;
+    double ANTICIPATION_THRESHOLD;
+    double ANTICIPATION_CONFIDENCE;
+    double MOTOR_BABBLING_CHANCE;
+    int BABBLING_OPS;
+    int anticipationStampID;
+    Concept **preconditionCandidates;
+    Concept **anticipating_concepts;
+}Decision_State;
+#define DECISION_STATE_INITIAL ((Decision_State) { .CONDITION_THRESHOLD = CONDITION_THRESHOLD_INITIAL, .DECISION_THRESHOLD = DECISION_THRESHOLD_INITIAL, .ANTICIPATION_THRESHOLD = ANTICIPATION_THRESHOLD_INITIAL, \
+                                                   .ANTICIPATION_CONFIDENCE = ANTICIPATION_CONFIDENCE_INITIAL, .MOTOR_BABBLING_CHANCE = MOTOR_BABBLING_CHANCE_INITIAL, .BABBLING_OPS = OPERATIONS_MAX, .anticipationStampID = -1 })
 
 //Methods//
 //-------//
-//Init module
+//Init module, after Memory_INIT as its buffers are taken from the memory arena
 void Decision_INIT();
+//Exchange the parameters and state with the ones kept for a reasoner instance
+void Decision_SwapState(Decision_State *state);
 //execute decision
 void Decision_Execute(Decision *decision);
 //assumption of failure, also works for "do nothing operator"
@@ -24,13 +24,13 @@
 
 #include "Event.h"
 
-long base = 1;
+THREAD_LOCAL long base = 1;
 Event Event_InputEvent(Term term, char type, Truth truth, double occurrenceTimeOffset, long currentTime)
 {
     return (Event) { .term = term,
                      .type = type, 
                      .truth = truth, 
-                     .stamp = (Stamp) { .evidentalBase = { base++ } }, 
+                     .stamp = Stamp_input(base++), 
                      .occurrenceTime = currentTime,
                      .occurrenceTimeOffset = occurrenceTimeOffset,
                      .creationTime = currentTime };
@@ -41,11 +41,23 @@ void Event_INIT()
     base = 1;
 }
 
+void Event_SwapState(Event_State *state)
+{
+    SWAP_STATE(base, state->base);
+}
+
 bool Event_Equal(Event *event, Event *existing)
 {
     return Truth_Equal(&event->truth, &existing->truth) && event->occurrenceTime == existing->occurrenceTime && Term_Equal(&event->term, &existing->term) && Stamp_Equal(&event->stamp, &existing->stamp);
 }
 
+HASH_TYPE Event_Hash(Event *event)
+{
+    //truth and stamp are left out, events with the same term and occurrence time share a bucket
+    unsigned long hash = ((unsigned long) Term_Hash(&event->term)) ^ (((unsigned long) event->occurrenceTime) * 2654435761UL);
+    return (HASH_TYPE) (hash >> 1); //non-negative for the bucket index
+}
+
 bool Event_EqualTermEqualStampLessConfidentThan(Event *event, Event *existing)
 {
     return event->truth.confidence <= existing->truth.confidence && event->occurrenceTime == existing->occurrenceTime && Term_Equal(&event->term, &existing->term) && Stamp_Equal(&event->stamp, &existing->stamp);
@@ -50,15 +50,25 @@ typedef struct {
     bool processed;
     long creationTime;
 } Event;
+//Input event ID counter of a reasoner instance
+typedef struct
+{
+    long base;
+}Event_State;
+#define EVENT_STATE_INITIAL ((Event_State) { .base = 1 })
 
 //Methods//
 //-------//
 //Init/Reset module
 void Event_INIT();
+//Exchange the state with the one kept for a reasoner instance
+void Event_SwapState(Event_State *state);
 //construct an input event
 Event Event_InputEvent(Term term, char type, Truth truth, double occurrenceTimeOffset, long currentTime);
 //Whether two events are the same
 bool Event_Equal(Event *event, Event *existing);
+//Hash of an event, equal for events which are the same according to Event_Equal
+HASH_TYPE Event_Hash(Event *event);
 //Whether the left event with same term and stamp overlap is less true than the second
 bool Event_EqualTermEqualStampLessConfidentThan(Event *event, Event *existing);
 
@@ -54,7 +54,7 @@ HASH_TYPE Globals_Hash(HASH_TYPE *data, int pieces)
 
 //rand(): http://man7.org/linux/man-pages/man3/rand.3.html
 //"POSIX.1-2001 gives the following example of an implementation of rand() and srand(), possibly useful when one needs the same sequence on two different machines."
-static unsigned long next = 1;
+static THREAD_LOCAL unsigned long next = 1;
 
 /* RAND_MAX assumed to be 32767 */
 int myrand(void)
@@ -67,3 +67,8 @@ void mysrand(unsigned int seed)
 {
    next = seed;
 }
+
+void Globals_SwapState(Globals_State *state)
+{
+    SWAP_STATE(next, state->next);
+}
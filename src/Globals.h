@@ -63,5 +63,17 @@ HASH_TYPE Globals_Hash(HASH_TYPE *data, int pieces);
 int myrand(void);
 void mysrand(unsigned int seed);
 #define MY_RAND_MAX 32767
+//State of the random number generator, part of the state of a reasoner instance
+typedef struct
+{
+    unsigned long next;
+}Globals_State;
+#define GLOBALS_STATE_INITIAL ((Globals_State) { .next = 1 })
+//Exchange the state with the one kept for a reasoner instance
+void Globals_SwapState(Globals_State *state);
+//Exchange the value of a variable with its copy in a module state, used by the *_SwapState methods
+#define SWAP_STATE(variable, copy) { char swapped[sizeof(variable)]; memcpy(swapped, &(variable), sizeof(variable)); memcpy(&(variable), &(copy), sizeof(variable)); memcpy(&(copy), swapped, sizeof(variable)); }
+//Storage class of the module globals holding the state of the selected instance, each thread has its own selected instance
+#define THREAD_LOCAL __thread
 
 #endif
@@ -24,118 +24,109 @@
 
 #include "HashTable.h"
 
-void *HashTable_Get(HashTable *hashtable, void *key)
+static HashTableSlot *HashTable_Bucket(HashTable *hashtable, HASH_TYPE hash)
 {
-    HASH_TYPE keyhash = hashtable->hash(key) % hashtable->buckets;
-    VMItem *item = hashtable->HT[keyhash];
-    for(; item!=NULL; item=item->next)
-    {
-        if(hashtable->equal(item->key, key))
-        {
-            return item->value;
-        }
-    }
-    return NULL;
+    return &hashtable->slots[((unsigned long) hash) % hashtable->buckets];
 }
 
-void HashTable_Set(HashTable *hashtable, void *key, void *value)
+//Slot of the key, or -1 if it's not in the hashtable
+static int HashTable_Find(HashTable *hashtable, void *key, HASH_TYPE hash)
 {
-    HASH_TYPE keyhash = hashtable->hash(key) % hashtable->buckets;
-    //Check if item already exists in hashtable, if yes return
-    VMItem *item = hashtable->HT[keyhash];
-    bool empty = item == NULL;
-    if(!empty)
+    for(int i=HashTable_Bucket(hashtable, hash)->head; i; i=hashtable->slots[i-1].next)
     {
-        for(; item->next!=NULL; item=item->next)
+        if(hashtable->slots[i-1].hash == hash && hashtable->equal(hashtable->slots[i-1].key, key))
         {
-            if(hashtable->equal(item->key, key))
-            {
-                return;
-            }
+            return i-1;
         }
     }
-    //Retrieve recycled VMItem from the stack and set its value to c
-    VMItem *popped = Stack_Pop(&hashtable->VMStack);
-    popped->value = value;
-    popped->key = key;
-    popped->next = NULL;
-    //Case1: HT at hash was empty so add recycled item at HT[keyhash]
-    if(empty)
-    {
-        hashtable->HT[keyhash] = popped;
-    }
-    //Case2: HT at hash not empty so add recycled item at end of the chain of HT[keyhash]
-    else
-    {
-        assert(item != NULL, "VMItem should not be null!");
-        item->next = popped;
-    }
+    return -1;
 }
 
-void HashTable_Delete(HashTable *hashtable, void *key)
+void *HashTable_GetWithHash(HashTable *hashtable, void *key, HASH_TYPE hash)
 {
-    HASH_TYPE keyhash = hashtable->hash(key) % hashtable->buckets;
-    VMItem *item = hashtable->HT[keyhash];
-    VMItem *previous = NULL;
-    //If there is only one item set HT[keyhash] to NULL and push back the VMItem to stack for recycling
-    if(item->next == NULL)
+    int slot = HashTable_Find(hashtable, key, hash);
+    return slot == -1 ? NULL : hashtable->slots[slot].value;
+}
+
+void *HashTable_Get(HashTable *hashtable, void *key)
+{
+    return HashTable_GetWithHash(hashtable, key, hashtable->hash(key));
+}
+
+void HashTable_SetWithHash(HashTable *hashtable, void *key, HASH_TYPE hash, void *value)
+{
+    //Check if item already exists in hashtable, if yes return
+    if(HashTable_Find(hashtable, key, hash) != -1)
     {
-        hashtable->HT[keyhash] = NULL;
-        Stack_Push(&hashtable->VMStack, item);
         return;
     }
-    //If there is more than 1 item, we have to remove the item from chain, relinking previous to next
-    for(; item!=NULL; previous=item, item=item->next)
+    assert(hashtable->freeSlots != 0, "HashTable is full!");
+    //Take a free slot for the item and put it in front of the chain of its bucket
+    int i = hashtable->freeSlots;
+    HashTableSlot *bucket = HashTable_Bucket(hashtable, hash);
+    hashtable->freeSlots = hashtable->slots[i-1].next;
+    hashtable->slots[i-1].key = key;
+    hashtable->slots[i-1].value = value;
+    hashtable->slots[i-1].hash = hash;
+    hashtable->slots[i-1].next = bucket->head;
+    bucket->head = i;
+    hashtable->itemsAmount++;
+}
+
+void HashTable_Set(HashTable *hashtable, void *key, void *value)
+{
+    HashTable_SetWithHash(hashtable, key, hashtable->hash(key), value);
+}
+
+void HashTable_DeleteWithHash(HashTable *hashtable, void *key, HASH_TYPE hash)
+{
+    //Find the link to the item, to relink it to the next item in the chain
+    int *link = &HashTable_Bucket(hashtable, hash)->head;
+    for(; *link; link=&hashtable->slots[*link-1].next)
     {
-        //item found?
-        if(hashtable->equal(item->key, key))
+        HashTableSlot *item = &hashtable->slots[*link-1];
+        if(item->hash == hash && hashtable->equal(item->key, key))
         {
-            //remove item and return
-            if(previous == NULL)
-            {
-                hashtable->HT[keyhash] = item->next;
-            }
-            else
-            {
-                previous->next = item->next;
-            }
-            Stack_Push(&hashtable->VMStack, item);
+            //remove the item and give its slot back to the free list
+            int i = *link;
+            *link = item->next;
+            item->key = item->value = NULL;
+            item->hash = 0;
+            item->next = hashtable->freeSlots;
+            hashtable->freeSlots = i;
+            hashtable->itemsAmount--;
             return;
         }
     }
     assert(false, "HashTable deletion failed, item was not found!");
 }
 
-void HashTable_INIT(HashTable *hashtable, VMItem* storage, VMItem** storageptrs, VMItem** HT, int buckets, int maxElements, Equal equal, Hash hash)
+void HashTable_Delete(HashTable *hashtable, void *key)
+{
+    HashTable_DeleteWithHash(hashtable, key, hashtable->hash(key));
+}
+
+void HashTable_INIT(HashTable *hashtable, HashTableSlot *slots, int buckets, Equal equal, Hash hash)
 {
-    hashtable->storage = storage;
-    hashtable->storageptrs = storageptrs;
-    hashtable->HT = HT;
-    hashtable->VMStack = (Stack) {0};
-    Stack_INIT(&hashtable->VMStack, (void**) hashtable->storageptrs, maxElements);
+    hashtable->slots = slots;
+    hashtable->buckets = buckets;
+    hashtable->itemsAmount = 0;
+    hashtable->freeSlots = buckets > 0 ? 1 : 0;
     hashtable->equal = equal;
     hashtable->hash = hash;
-    hashtable->buckets = buckets;
     for(int i=0; i<buckets; i++)
     {
-        hashtable->HT[i] = NULL;
-    }
-    for(int i=0; i<maxElements; i++)
-    {
-        hashtable->storage[i] = (VMItem) {0};
-        hashtable->storageptrs[i] = NULL;
-        Stack_Push(&hashtable->VMStack, &hashtable->storage[i]);
+        hashtable->slots[i] = (HashTableSlot) { .next = i+1 < buckets ? i+2 : 0 };
     }
 }
 
 int HashTable_MaximumChainLength(HashTable *hashtable)
 {
     int maxlen = 0;
-    for(int i=0; i<hashtable->buckets; i++)
+    for(int b=0; b<hashtable->buckets; b++)
     {
-        VMItem *item = hashtable->HT[i];
         int cnt = 0;
-        for(;item != NULL; item=item->next, cnt++);
+        for(int i=hashtable->slots[b].head; i; i=hashtable->slots[i-1].next, cnt++);
         maxlen = MAX(maxlen, cnt);
     }
     return maxlen;
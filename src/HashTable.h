@@ -29,12 +29,14 @@
 //  HashTable  //
 /////////////////
 //The hashtable HT[Term] -> Concept*
+//Separate chaining: each slot is the head of the chain of its bucket, and also stores one item,
+//the items are taken from a free list of the slots, so the chains are linked by slot indices instead of pointers
 
 //References//
 //----------//
 #include <stdlib.h>
 #include <stdbool.h>
-#include "Stack.h"
+#include "Globals.h"
 
 //Data structure//
 //--------------//
@@ -42,17 +44,18 @@ typedef bool (*Equal)(void*, void*);
 typedef HASH_TYPE (*Hash)(void*);
 typedef struct
 {
-    void *key;
+    void *key; //NULL if the slot holds no item
     void *value;
-    void *next;
-} VMItem;
+    HASH_TYPE hash; //stored, so that a chain only calls equal on hash matches and never rehashes
+    int next; //index+1 of the next item in the chain, or of the next free slot, 0 at the end
+    int head; //index+1 of the first item in the chain of the bucket of this slot, 0 if the bucket is empty
+} HashTableSlot;
 typedef struct
 {
-    VMItem** storageptrs;
-    VMItem* storage;
-    VMItem** HT; //the hash of the concept term is the index
-    Stack VMStack; //"Virtual memory" stack
+    HashTableSlot *slots;
     int buckets;
+    int itemsAmount;
+    int freeSlots; //index+1 of the first slot holding no item, 0 if all are taken
     Equal equal;
     Hash hash;
 } HashTable;
@@ -61,14 +64,16 @@ typedef struct
 //-------//
 //Get a concept from the hashtable via term
 void* HashTable_Get(HashTable *hashtable, void *key);
+void* HashTable_GetWithHash(HashTable *hashtable, void *key, HASH_TYPE hash);
 //Add a concept to the hashtable using the concept term
 void HashTable_Set(HashTable *hashtable, void *key, void *value);
+void HashTable_SetWithHash(HashTable *hashtable, void *key, HASH_TYPE hash, void *value);
 //Delete a concept from hashtable (the concept's term is the key)
 void HashTable_Delete(HashTable *hashtable, void *key);
-//Initialize hashtable "virtual memory" stack and HT array
-void HashTable_INIT(HashTable *hashtable, VMItem* storage, VMItem** storageptrs, VMItem** HT, int buckets, int maxElements, Equal equal, Hash hash);
+void HashTable_DeleteWithHash(HashTable *hashtable, void *key, HASH_TYPE hash);
+//Initialize hashtable slots, each bucket can hold one item, so buckets needs to be at least the maximum amount of items
+void HashTable_INIT(HashTable *hashtable, HashTableSlot *slots, int buckets, Equal equal, Hash hash);
 //Maximum chain length in hashtable
 int HashTable_MaximumChainLength(HashTable *hashtable);
 
 #endif
-
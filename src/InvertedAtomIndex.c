@@ -24,24 +24,152 @@
 
 #include "InvertedAtomIndex.h"
 
-ConceptChainElement* conceptChainElementStoragePointers[UNIFICATION_DEPTH*CONCEPTS_MAX];
-ConceptChainElement conceptChainElementStorage[UNIFICATION_DEPTH*CONCEPTS_MAX];
-Stack conceptChainElementStack;
-ConceptChainElement *invertedAtomIndex[ATOMS_MAX];
+THREAD_LOCAL ConceptPosting *conceptPostings;
+THREAD_LOCAL PostingList *invertedAtomIndex; //indexed by the atom, so it holds maxAtoms+1 lists
+static THREAD_LOCAL int atomsMax = 0;
+static THREAD_LOCAL int postingsMax = 0;
+static THREAD_LOCAL int postingsUsed = 0; //the storage is used from the beginning, lists which grow move to its end
 
-void InvertedAtomIndex_INIT()
+void InvertedAtomIndex_INIT(ConceptPosting *postings, int maxPostings, PostingList *postingLists, int maxAtoms)
 {
-    for(int i=0; i<ATOMS_MAX; i++)
+    assert(maxAtoms <= ATOMS_MAX, "More atoms than ATOMS_MAX!");
+    conceptPostings = postings;
+    postingsMax = maxPostings;
+    invertedAtomIndex = postingLists;
+    atomsMax = maxAtoms;
+    for(int i=0; i<=atomsMax; i++)
     {
-        invertedAtomIndex[i] = NULL;
+        invertedAtomIndex[i] = (PostingList) {0};
     }
-    Stack_INIT(&conceptChainElementStack, (void**) conceptChainElementStoragePointers, UNIFICATION_DEPTH*CONCEPTS_MAX);
-    for(int i=0; i<UNIFICATION_DEPTH*CONCEPTS_MAX; i++)
+    postingsUsed = 0;
+}
+
+void InvertedAtomIndex_SwapState(InvertedAtomIndex_State *state)
+{
+    SWAP_STATE(conceptPostings, state->conceptPostings);
+    SWAP_STATE(invertedAtomIndex, state->invertedAtomIndex);
+    SWAP_STATE(atomsMax, state->atomsMax);
+    SWAP_STATE(postingsMax, state->postingsMax);
+    SWAP_STATE(postingsUsed, state->postingsUsed);
+}
+
+static int InvertedAtomIndex_CompareStart(const void *a, const void *b)
+{
+    return invertedAtomIndex[*(Atom*) a].start - invertedAtomIndex[*(Atom*) b].start;
+}
+
+//Move the posting lists to the beginning of the storage, freeing the space left behind by grown lists
+static void InvertedAtomIndex_Compact()
+{
+    Atom *compactionOrder = malloc((atomsMax+1) * sizeof(Atom)); //only needed when the storage is exhausted, which is rare
+    assert(compactionOrder != NULL, "Allocation of the compaction order failed!");
+    int amount = 0;
+    for(int i=0; i<=atomsMax; i++)
+    {
+        if(invertedAtomIndex[i].capacity > 0)
+        {
+            compactionOrder[amount++] = i;
+        }
+    }
+    qsort(compactionOrder, amount, sizeof(Atom), InvertedAtomIndex_CompareStart);
+    postingsUsed = 0;
+    for(int i=0; i<amount; i++) //in storage order, so that no list is overwritten before it was moved
+    {
+        PostingList *list = &invertedAtomIndex[compactionOrder[i]];
+        memmove(&conceptPostings[postingsUsed], &conceptPostings[list->start], list->size * sizeof(ConceptPosting));
+        list->start = postingsUsed;
+        list->capacity = list->size;
+        postingsUsed += list->size;
+    }
+    free(compactionOrder);
+}
+
+static void InvertedAtomIndex_Grow(PostingList *list)
+{
+    int capacity = MAX(4, list->capacity * 2);
+    if(postingsUsed + capacity > postingsMax)
+    {
+        InvertedAtomIndex_Compact();
+        if(postingsUsed + capacity > postingsMax)
+        {
+            capacity = list->size + 1;
+        }
+    }
+    assert(postingsUsed + capacity <= postingsMax, "Postings storage exhausted, increase POSTINGS_PER_CONCEPT!");
+    memcpy(&conceptPostings[postingsUsed], &conceptPostings[list->start], list->size * sizeof(ConceptPosting));
+    list->start = postingsUsed;
+    list->capacity = capacity;
+    postingsUsed += capacity;
+}
+
+//Position after the postings with a priority key at least as high
+static int InvertedAtomIndex_InsertionPoint(ConceptPosting *postings, int size, double priorityKey)
+{
+    int low = 0, high = size;
+    while(low < high)
+    {
+        int mid = (low + high) / 2;
+        if(postings[mid].priorityKey >= priorityKey)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+//Position of the concept, found via its priority key, or -1 if not in the list
+static int InvertedAtomIndex_Find(PostingList *list, Concept *c)
+{
+    ConceptPosting *postings = &conceptPostings[list->start];
+    if(c->priorityKey == -INFINITY) //concepts without priority are at the end
+    {
+        for(int i=list->size-1; i>=0 && postings[i].priorityKey == -INFINITY; i--)
+        {
+            if(postings[i].c == c)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+    int low = 0, high = list->size; //first position with a priority key not higher
+    while(low < high)
+    {
+        int mid = (low + high) / 2;
+        if(postings[mid].priorityKey > c->priorityKey)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    for(int i=low; i<list->size && postings[i].priorityKey == c->priorityKey; i++)
+    {
+        if(postings[i].c == c)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//Each simple atom only once, as it can appear multiple times in the term
+static bool InvertedAtomIndex_FirstAppearance(Term *term, int i)
+{
+    for(int j=0; j<i; j++)
     {
-        conceptChainElementStorage[i] = (ConceptChainElement) {0};
-        conceptChainElementStoragePointers[i] = NULL;
-        Stack_Push(&conceptChainElementStack, &conceptChainElementStorage[i]);
+        if(term->atoms[j] == term->atoms[i])
+        {
+            return false;
+        }
     }
+    return true;
 }
 
 void InvertedAtomIndex_AddConcept(Term term, Concept *c)
@@ -49,35 +177,19 @@ void InvertedAtomIndex_AddConcept(Term term, Concept *c)
     for(int i=0; i<UNIFICATION_DEPTH; i++)
     {
         Atom atom = term.atoms[i];
-        if(Narsese_IsSimpleAtom(atom))
+        if(Narsese_IsSimpleAtom(atom) && InvertedAtomIndex_FirstAppearance(&term, i))
         {
-            ConceptChainElement *elem = invertedAtomIndex[atom];
-            if(elem == NULL)
+            PostingList *list = &invertedAtomIndex[atom];
+            if(list->size == list->capacity)
             {
-                ConceptChainElement *newElem = Stack_Pop(&conceptChainElementStack); //new item
-                newElem->c = c;
-                invertedAtomIndex[atom] = newElem;
-            }
-            else
-            {
-                //search for c:
-                ConceptChainElement *previous = NULL;
-                while(elem != NULL)
-                {
-                    if(elem->c == c)
-                    {
-                        goto NEXT_ATOM;
-                    }
-                    previous = elem;
-                    elem = elem->next;
-                }
-                //ok, we can add it as previous->next
-                ConceptChainElement *newElem = Stack_Pop(&conceptChainElementStack); //new item
-                newElem->c = c;
-                previous->next = newElem;
+                InvertedAtomIndex_Grow(list);
             }
+            ConceptPosting *postings = &conceptPostings[list->start];
+            int k = InvertedAtomIndex_InsertionPoint(postings, list->size, c->priorityKey);
+            memmove(&postings[k+1], &postings[k], (list->size - k) * sizeof(ConceptPosting));
+            postings[k] = (ConceptPosting) { .c = c, .priorityKey = c->priorityKey, .id = c->id };
+            list->size++;
         }
-        NEXT_ATOM:;
     }
 }
 
@@ -86,67 +198,82 @@ void InvertedAtomIndex_RemoveConcept(Term term, Concept *c)
     for(int i=0; i<UNIFICATION_DEPTH; i++)
     {
         Atom atom = term.atoms[i];
-        if(Narsese_IsSimpleAtom(atom))
+        if(Narsese_IsSimpleAtom(atom) && InvertedAtomIndex_FirstAppearance(&term, i))
         {
-            ConceptChainElement *previous = NULL;
-            ConceptChainElement *elem = invertedAtomIndex[atom];
-            while(elem != NULL)
-            {
-                if(elem->c == c) //we found c in the chain, remove it
-                {
-                    if(previous == NULL) //item was the initial chain element, let the next element be the initial now
-                    {
-                        invertedAtomIndex[atom] = elem->next;
-                    }
-                    else //item was within the chain, relink the previous to the next of elem
-                    {
-                        previous->next = elem->next;
-                    }
-                    //push elem back to the stack, it's "freed"
-                    assert(elem->c != NULL, "A null concept was in inverted atom index!");
-                    elem->c = NULL;
-                    elem->next = NULL;
-                    Stack_Push(&conceptChainElementStack, elem);
-                    goto NEXT_ATOM;
-                }
-                previous = elem;
-                elem = elem->next;
-            }
+            PostingList *list = &invertedAtomIndex[atom];
+            int k = InvertedAtomIndex_Find(list, c);
+            assert(k != -1, "Concept to remove was not in inverted atom index!");
+            ConceptPosting *postings = &conceptPostings[list->start];
+            memmove(&postings[k], &postings[k+1], (list->size - k - 1) * sizeof(ConceptPosting));
+            list->size--;
         }
-        NEXT_ATOM:;
     }
 }
 
+void InvertedAtomIndex_IncreasePriorityKey(Term term, Concept *c, double priorityKey)
+{
+    for(int i=0; i<UNIFICATION_DEPTH; i++)
+    {
+        Atom atom = term.atoms[i];
+        if(Narsese_IsSimpleAtom(atom) && InvertedAtomIndex_FirstAppearance(&term, i))
+        {
+            PostingList *list = &invertedAtomIndex[atom];
+            int k = InvertedAtomIndex_Find(list, c);
+            assert(k != -1, "Concept to update was not in inverted atom index!");
+            ConceptPosting *postings = &conceptPostings[list->start];
+            int k_new = InvertedAtomIndex_InsertionPoint(postings, k, priorityKey); //only moves forward
+            memmove(&postings[k_new+1], &postings[k_new], (k - k_new) * sizeof(ConceptPosting));
+            postings[k_new] = (ConceptPosting) { .c = c, .priorityKey = priorityKey, .id = c->id };
+        }
+    }
+    c->priorityKey = priorityKey;
+}
+
 void InvertedAtomIndex_Print()
 {
     puts("printing inverted atom table content:");
-    for(int i=0; i<ATOMS_MAX; i++)
+    for(int i=0; i<=atomsMax && i<ATOMS_MAX; i++)
     {
-        Atom atom = i; //the atom is directly the value (from 0 to ATOMS_MAX)
+        Atom atom = i; //the atom is directly the value (from 0 to atomsMax)
         if(Narsese_IsSimpleAtom(atom))
         {
-            ConceptChainElement *elem = invertedAtomIndex[atom];
-            while(elem != NULL)
+            PostingList *list = &invertedAtomIndex[atom];
+            for(int k=0; k<list->size; k++)
             {
-                Concept *c = elem->c;
+                Concept *c = conceptPostings[list->start + k].c;
                 assert(c != NULL, "A null concept was in inverted atom index!");
                 Narsese_PrintAtom(atom);
                 fputs(" -> ", stdout);
                 Narsese_PrintTerm(&c->term);
                 puts("");
-                elem = elem->next;
             }
         }
     }
     puts("table print finish");
 }
 
-ConceptChainElement* InvertedAtomIndex_GetConceptChain(Atom atom)
+ConceptPosting* InvertedAtomIndex_GetPostings(Atom atom, int *size)
 {
-    ConceptChainElement* ret = NULL;
-    if(atom != 0)
+    *size = atom != 0 ? invertedAtomIndex[atom].size : 0;
+    return &conceptPostings[invertedAtomIndex[atom].start];
+}
+
+ConceptPosting* InvertedAtomIndex_GetRarestPostings(Term *term, int *size)
+{
+    ConceptPosting *postings = NULL;
+    *size = 0;
+    for(int i=0; i<UNIFICATION_DEPTH; i++)
     {
-        ret = invertedAtomIndex[atom];
+        if(Narsese_IsSimpleAtom(term->atoms[i]))
+        {
+            int atomSize;
+            ConceptPosting *atomPostings = InvertedAtomIndex_GetPostings(term->atoms[i], &atomSize);
+            if(postings == NULL || atomSize < *size)
+            {
+                postings = atomPostings;
+                *size = atomSize;
+            }
+        }
     }
-    return ret;
+    return postings;
 }
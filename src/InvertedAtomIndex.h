@@ -32,8 +32,8 @@
 
 //References//
 //////////////
+#include <math.h>
 #include "Concept.h"
-#include "Stack.h"
 #include "Config.h"
 
 //Data structure//
@@ -41,24 +41,44 @@
 typedef struct
 {
     Concept *c;
-    void *next;
-}ConceptChainElement;
-extern ConceptChainElement* conceptChainElementStoragePointers[UNIFICATION_DEPTH*CONCEPTS_MAX];
-extern ConceptChainElement conceptChainElementStorage[UNIFICATION_DEPTH*CONCEPTS_MAX];
-extern Stack conceptChainElementStack;
-extern ConceptChainElement *invertedAtomIndex[ATOMS_MAX];
+    double priorityKey; //copy of the concept's priority key, the posting list is sorted by it in descending order
+    long id; //copy of the concept id, which gives the order the concepts were added in
+}ConceptPosting;
+typedef struct
+{
+    int start; //position of the posting list in the postings storage
+    int size;
+    int capacity;
+}PostingList;
+extern THREAD_LOCAL ConceptPosting *conceptPostings;
+extern THREAD_LOCAL PostingList *invertedAtomIndex;
+//State of a reasoner instance
+typedef struct
+{
+    ConceptPosting *conceptPostings;
+    PostingList *invertedAtomIndex;
+    int atomsMax;
+    int postingsMax;
+    int postingsUsed;
+}InvertedAtomIndex_State;
 
 //Methods//
 //-------//
-//Init inverted atom index
-void InvertedAtomIndex_INIT();
-//Add concept to inverted atom index
+//Init inverted atom index with the storage for its postings, and for the posting lists of atoms up to maxAtoms
+void InvertedAtomIndex_INIT(ConceptPosting *postings, int maxPostings, PostingList *postingLists, int maxAtoms);
+//Exchange the state with the one kept for a reasoner instance
+void InvertedAtomIndex_SwapState(InvertedAtomIndex_State *state);
+//Add concept to inverted atom index, sorted in by its priority key
 void InvertedAtomIndex_AddConcept(Term term, Concept *c);
 //Remove concept from inverted atom index
 void InvertedAtomIndex_RemoveConcept(Term term, Concept *c);
+//Move concept to the position of its new priority key, which has to be higher than its current one
+void InvertedAtomIndex_IncreasePriorityKey(Term term, Concept *c, double priorityKey);
 //Print the inverted atom index
 void InvertedAtomIndex_Print();
-//Get the invtable chain with the concepts for an atom
-ConceptChainElement* InvertedAtomIndex_GetConceptChain(Atom atom);
+//Get the posting list with the concepts for an atom, sorted by priority key in descending order
+ConceptPosting* InvertedAtomIndex_GetPostings(Atom atom, int *size);
+//Get the shortest posting list of the simple atoms within the unification depth of the term, NULL if it has none
+ConceptPosting* InvertedAtomIndex_GetRarestPostings(Term *term, int *size);
 
 #endif
@@ -0,0 +1,286 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Journal.h"
+#include "Shell.h"
+
+static THREAD_LOCAL FILE *journal = NULL;
+static THREAD_LOCAL int depth = 0;
+static THREAD_LOCAL bool replaying = false;
+static THREAD_LOCAL bool failed = false;
+
+//The journal header, the layout sizes have to be the same to replay it
+#define JOURNAL_VERSION 1
+typedef struct
+{
+    char magic[8];
+    int version;
+    int layout[4];
+}Journal_Header;
+#define JOURNAL_HEADER ((Journal_Header) { .magic = "ONAJRNL", .version = JOURNAL_VERSION, \
+                                           .layout = { sizeof(Atom), sizeof(Truth), sizeof(Memory_Config), sizeof(Journal_Input) } })
+
+bool Journal_Open(char *path)
+{
+    Journal_Close();
+    failed = false;
+    journal = fopen(path, "ab");
+    if(journal != NULL && ftell(journal) == 0)
+    {
+        Journal_Header header = JOURNAL_HEADER;
+        if(fwrite(&header, sizeof(header), 1, journal) != 1 || fflush(journal) != 0)
+        {
+            Journal_Close();
+        }
+    }
+    return journal != NULL;
+}
+
+void Journal_Close()
+{
+    if(journal != NULL)
+    {
+        fclose(journal);
+        journal = NULL;
+    }
+}
+
+bool Journal_Enter()
+{
+    depth++;
+    return journal != NULL && !replaying && depth == 1;
+}
+
+void Journal_Leave()
+{
+    depth--;
+}
+
+bool Journal_Record(char type, void *payload, int size)
+{
+    //a record which can't be replayed would leave out input, replaying the journal only goes up to the last record before it
+    if(size > JOURNAL_RECORD_MAX || fwrite(&type, sizeof(char), 1, journal) != 1 || fwrite(&size, sizeof(int), 1, journal) != 1 ||
+       (int) fwrite(payload, 1, size, journal) != size || fflush(journal) != 0) //a crash only loses the record which was being written
+    {
+        Journal_Close();
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+bool Journal_RecordString(char type, char *str)
+{
+    return Journal_Record(type, str, strlen(str));
+}
+
+bool Journal_RecordInput(Term *term, char type, Truth truth, bool eternal, double occurrenceTimeOffset)
+{
+    char payload[sizeof(Journal_Input) + TERM_ATOMS_SIZE];
+    Journal_Input input = { .truth = truth, .occurrenceTimeOffset = occurrenceTimeOffset, .type = type, .eternal = eternal };
+    for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+    {
+        if(term->atoms[i])
+        {
+            input.atomsAmount = i+1;
+        }
+    }
+    memcpy(payload, &input, sizeof(Journal_Input));
+    memcpy(&payload[sizeof(Journal_Input)], term->atoms, input.atomsAmount * sizeof(Atom));
+    return Journal_Record(JOURNAL_INPUT, payload, sizeof(Journal_Input) + input.atomsAmount * sizeof(Atom));
+}
+
+void Journal_RecordAtom(char *name)
+{
+    if(journal != NULL && !replaying && depth == 0)
+    {
+        Journal_RecordString(JOURNAL_ATOM, name);
+    }
+}
+
+void Journal_RecordSnapshot(char *path)
+{
+    if(journal != NULL && !replaying)
+    {
+        Journal_RecordString(JOURNAL_SNAPSHOT, path);
+    }
+}
+
+bool Journal_Failed()
+{
+    return failed;
+}
+
+bool Journal_Replaying()
+{
+    return replaying;
+}
+
+//Read the next record, false at the end of the journal, or at a record which was cut off by a crash
+static bool Journal_Read(FILE *file, char *type, char *payload, int *size)
+{
+    if(fread(type, sizeof(char), 1, file) != 1 || fread(size, sizeof(int), 1, file) != 1 || *size < 0 || *size > JOURNAL_RECORD_MAX)
+    {
+        return false;
+    }
+    bool complete = (int) fread(payload, 1, *size, file) == *size;
+    payload[*size] = 0; //strings are recorded without terminator
+    return complete;
+}
+
+//Procedures can't be recorded, the replayed operations take the ones registered under the same name before, else one doing nothing
+static THREAD_LOCAL char operationNames[OPERATIONS_MAX][ATOMIC_TERM_LEN_MAX];
+static THREAD_LOCAL Action operationProcedures[OPERATIONS_MAX];
+static void Journal_Nop(Term args)
+{
+}
+
+static Action Journal_Procedure(char *name)
+{
+    for(int i=0; i<OPERATIONS_MAX; i++)
+    {
+        if(!strcmp(operationNames[i], name))
+        {
+            return operationProcedures[i];
+        }
+    }
+    return Journal_Nop;
+}
+
+static void Journal_Apply(char type, char *payload)
+{
+    if(type == JOURNAL_INIT)
+    {
+        Memory_Config config;
+        memcpy(&config, payload, sizeof(Memory_Config));
+        NAR_INIT_Config(config);
+    }
+    else
+    if(type == JOURNAL_INPUT)
+    {
+        Journal_Input input;
+        memcpy(&input, payload, sizeof(Journal_Input));
+        Term term = {0};
+        memcpy(term.atoms, &payload[sizeof(Journal_Input)], input.atomsAmount * sizeof(Atom));
+        NAR_AddInput(term, input.type, input.truth, input.eternal, input.occurrenceTimeOffset);
+    }
+    else
+    if(type == JOURNAL_CYCLES)
+    {
+        int cycles;
+        memcpy(&cycles, payload, sizeof(int));
+        NAR_Cycles(cycles);
+    }
+    else
+    if(type == JOURNAL_NARSESE)
+    {
+        NAR_AddInputNarsese(payload);
+    }
+    else
+    if(type == JOURNAL_QUESTIONS)
+    {
+        NAR_AddInputNarseseQuestions(payload);
+    }
+    else
+    if(type == JOURNAL_OPERATION)
+    {
+        NAR_AddOperation(payload, Journal_Procedure(payload));
+    }
+    else
+    if(type == JOURNAL_SHELL)
+    {
+        Shell_ProcessInput(payload); //a reset was recorded by the calls it caused
+    }
+    else
+    if(type == JOURNAL_LOAD)
+    {
+        NAR_Load(payload);
+    }
+    else
+    if(type == JOURNAL_ATOM)
+    {
+        Narsese_AtomicTermIndex(payload);
+    }
+}
+
+bool Journal_Replay(char *path, bool fromSnapshot)
+{
+    FILE *file = fopen(path, "rb");
+    Journal_Header header, expected = JOURNAL_HEADER;
+    if(file == NULL || fread(&header, sizeof(header), 1, file) != 1 || memcmp(&header, &expected, sizeof(header)))
+    {
+        if(file != NULL)
+        {
+            fclose(file);
+        }
+        return false;
+    }
+    char *payload = malloc(JOURNAL_RECORD_MAX+1), *snapshot = malloc(JOURNAL_RECORD_MAX+1);
+    assert(payload != NULL && snapshot != NULL, "Allocation of the journal record buffers failed!");
+    char type;
+    int size;
+    long start = ftell(file);
+    snapshot[0] = 0;
+    while(fromSnapshot && Journal_Read(file, &type, payload, &size))
+    {
+        if(type == JOURNAL_SNAPSHOT)
+        {
+            strcpy(snapshot, payload);
+            start = ftell(file);
+        }
+    }
+    for(int i=0; i<OPERATIONS_MAX; i++)
+    {
+        operationNames[i][0] = 0;
+        if(operations[i].term.atoms[0])
+        {
+            strcpy(operationNames[i], Narsese_atomNames[operations[i].term.atoms[0]-1]);
+            operationProcedures[i] = operations[i].action;
+        }
+    }
+    //catch-up mode: the replayed calls are not recorded again, and neither print nor send metrics
+    replaying = true;
+    if(snapshot[0] && !NAR_Load(snapshot))
+    {
+        start = sizeof(Journal_Header); //replay it all instead
+    }
+    fseek(file, start, SEEK_SET);
+    while(Journal_Read(file, &type, payload, &size))
+    {
+        Journal_Apply(type, payload);
+    }
+    replaying = false;
+    free(payload);
+    free(snapshot);
+    fclose(file);
+    return true;
+}
+
+void Journal_SwapState(Journal_State *state)
+{
+    SWAP_STATE(journal, state->file);
+    SWAP_STATE(depth, state->depth);
+    SWAP_STATE(replaying, state->replaying);
+    SWAP_STATE(failed, state->failed);
+}
@@ -0,0 +1,97 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H_JOURNAL
+#define H_JOURNAL
+
+/////////////////////
+//  Input journal  //
+/////////////////////
+//Append-only binary journal of the input, replaying it restores the reasoner state
+
+//References//
+//----------//
+#include <stdio.h>
+#include "Memory.h"
+#include "Config.h"
+
+//Data structure//
+//--------------//
+//Record types, a record is its type, the size of its payload and the payload
+#define JOURNAL_INIT 'I' //NAR_INIT_Config with the Memory_Config
+#define JOURNAL_INPUT 'E' //NAR_AddInput with a Journal_Input followed by the atoms of the term
+#define JOURNAL_CYCLES 'C' //NAR_Cycles with the amount of cycles, marking the cycle boundaries
+#define JOURNAL_NARSESE 'N' //NAR_AddInputNarsese with the sentence
+#define JOURNAL_QUESTIONS 'Q' //NAR_AddInputNarseseQuestions with the questions
+#define JOURNAL_OPERATION 'O' //NAR_AddOperation with the operator name
+#define JOURNAL_SHELL 'S' //Shell_ProcessInput with the line
+#define JOURNAL_LOAD 'L' //NAR_Load with the snapshot path
+#define JOURNAL_SNAPSHOT 'P' //NAR_Save with the snapshot path, recovery can start from it
+#define JOURNAL_ATOM 'A' //atom created outside of the recorded calls, with its name, so that the atoms keep their indices
+typedef struct
+{
+    Truth truth;
+    double occurrenceTimeOffset;
+    char type;
+    bool eternal;
+    unsigned char atomsAmount; //the remaining atoms of the term are 0
+}Journal_Input;
+//Journal of a reasoner instance
+typedef struct
+{
+    FILE *file;
+    int depth; //recorded calls in progress, only the outermost one is recorded as it causes the others
+    bool replaying;
+    bool failed; //a record could not be written, the journal was closed then as it would miss input from there on
+}Journal_State;
+
+//Methods//
+//-------//
+//Start appending to a journal file, false if it can't be opened
+bool Journal_Open(char *path);
+//Stop journaling
+void Journal_Close();
+//Enter a recorded call, returns whether it's the outermost one and has to be recorded
+bool Journal_Enter();
+//Leave the recorded call
+void Journal_Leave();
+//Append a record to the journal, false if it's larger than JOURNAL_RECORD_MAX or can't be written, which closes the journal
+bool Journal_Record(char type, void *payload, int size);
+bool Journal_RecordString(char type, char *str);
+bool Journal_RecordInput(Term *term, char type, Truth truth, bool eternal, double occurrenceTimeOffset);
+//Record the creation of an atom, if it's not created by a recorded call
+void Journal_RecordAtom(char *name);
+//Record a saved snapshot, also when it's saved by a recorded call
+void Journal_RecordSnapshot(char *path);
+//Whether a record failed since the journal was opened
+bool Journal_Failed();
+//Whether the selected instance is catching up with a journal, its output is not printed and no metrics are sent then
+bool Journal_Replaying();
+//Replay a journal in catch-up mode with printing and metrics suppressed,
+//from its latest snapshot if fromSnapshot, false if it can't be read
+bool Journal_Replay(char *path, bool fromSnapshot);
+//Exchange the journal with the one kept for a reasoner instance
+void Journal_SwapState(Journal_State *state);
+
+#endif
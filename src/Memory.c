@@ -23,44 +23,85 @@
  */
 
 #include "Memory.h"
+#include "Stats.h"
+#include "Journal.h"
 
 //Concepts in main memory:
-PriorityQueue concepts;
+THREAD_LOCAL PriorityQueue concepts;
 //cycling events cycling in main memory:
-PriorityQueue cycling_belief_events;
-PriorityQueue cycling_goal_events;
+THREAD_LOCAL PriorityQueue cycling_belief_events;
+THREAD_LOCAL PriorityQueue cycling_goal_events;
 //Hashtable of concepts used for fast retrieval of concepts via term:
-HashTable HTconcepts;
-//Input event fifo:
-FIFO belief_events;
+THREAD_LOCAL HashTable HTconcepts;
+//Hashtables of the cycling events for fast duplicate checks:
+THREAD_LOCAL HashTable HTcycling_belief_events;
+THREAD_LOCAL HashTable HTcycling_goal_events;
+//Input event fifo, taken from the memory arena:
+THREAD_LOCAL FIFO *belief_events;
 //Operations
-Operation operations[OPERATIONS_MAX];
+THREAD_LOCAL Operation operations[OPERATIONS_MAX];
 //Parameters
-bool PRINT_DERIVATIONS = PRINT_DERIVATIONS_INITIAL;
-bool PRINT_INPUT = PRINT_INPUT_INITIAL;
+THREAD_LOCAL bool PRINT_DERIVATIONS = PRINT_DERIVATIONS_INITIAL;
+THREAD_LOCAL bool PRINT_INPUT = PRINT_INPUT_INITIAL;
+THREAD_LOCAL bool LAZY_FORGETTING = LAZY_FORGETTING_INITIAL;
+//Capacities the memory was initialized with
+THREAD_LOCAL Memory_Config memoryConfig;
+//Arena all storage arrays sized by the memory configuration are taken from
+static THREAD_LOCAL char *arena = NULL;
+static THREAD_LOCAL size_t arenaSize = 0, arenaUsed = 0;
 //Storage arrays for the datastructures
-Concept concept_storage[CONCEPTS_MAX];
-Item concept_items_storage[CONCEPTS_MAX];
-Event cycling_belief_event_storage[CYCLING_BELIEF_EVENTS_MAX];
-Item cycling_belief_event_items_storage[CYCLING_BELIEF_EVENTS_MAX];
-Event cycling_goal_event_storage[CYCLING_GOAL_EVENTS_MAX];
-Item cycling_goal_event_items_storage[CYCLING_GOAL_EVENTS_MAX];
+THREAD_LOCAL Concept *concept_storage;
+THREAD_LOCAL Item *concept_items_storage;
+THREAD_LOCAL Event *cycling_belief_event_storage;
+THREAD_LOCAL Item *cycling_belief_event_items_storage;
+THREAD_LOCAL Event *cycling_goal_event_storage;
+THREAD_LOCAL Item *cycling_goal_event_items_storage;
+THREAD_LOCAL HashTableSlot *HTcycling_belief_events_slots;
+THREAD_LOCAL HashTableSlot *HTcycling_goal_events_slots;
+//Pool of implication tables, only concepts which hold implications get one
+THREAD_LOCAL Table *precondition_table_storage;
+THREAD_LOCAL Table **precondition_table_storageptrs;
+THREAD_LOCAL Stack precondition_table_stack;
+//Concepts holding a precondition table per operation
+THREAD_LOCAL Concept **operation_concepts[OPERATIONS_MAX+1];
+THREAD_LOCAL int operation_conceptsAmount[OPERATIONS_MAX+1];
 //Dynamic concept firing threshold
-double conceptPriorityThreshold = 0.0;
+THREAD_LOCAL double conceptPriorityThreshold = 0.0;
 //Priority threshold for printing derivations
-double PRINT_EVENTS_PRIORITY_THRESHOLD = PRINT_EVENTS_PRIORITY_THRESHOLD_INITIAL;
+THREAD_LOCAL double PRINT_EVENTS_PRIORITY_THRESHOLD = PRINT_EVENTS_PRIORITY_THRESHOLD_INITIAL;
+
+static HashTable *Memory_CyclingEventsHashTable(PriorityQueue *queue)
+{
+    assert(queue == &cycling_belief_events || queue == &cycling_goal_events, "Not a cycling events queue!");
+    return queue == &cycling_belief_events ? &HTcycling_belief_events : &HTcycling_goal_events;
+}
+
+void Memory_ClearCyclingEvents(PriorityQueue *queue)
+{
+    PriorityQueue_INIT(queue, queue->items, queue->maxElements);
+    if(queue == &cycling_belief_events)
+    {
+        HashTable_INIT(&HTcycling_belief_events, HTcycling_belief_events_slots, HASHTABLE_BUCKETS_PER_ITEM*memoryConfig.cyclingBeliefEventsMax, (Equal) Event_Equal, (Hash) Event_Hash);
+    }
+    else
+    {
+        HashTable_INIT(&HTcycling_goal_events, HTcycling_goal_events_slots, HASHTABLE_BUCKETS_PER_ITEM*memoryConfig.cyclingGoalEventsMax, (Equal) Event_Equal, (Hash) Event_Hash);
+    }
+}
 
 static void Memory_ResetEvents()
 {
-    belief_events = (FIFO) {0};
-    PriorityQueue_INIT(&cycling_belief_events, cycling_belief_event_items_storage, CYCLING_BELIEF_EVENTS_MAX);
-    PriorityQueue_INIT(&cycling_goal_events, cycling_goal_event_items_storage, CYCLING_GOAL_EVENTS_MAX);
-    for(int i=0; i<CYCLING_BELIEF_EVENTS_MAX; i++)
+    *belief_events = (FIFO) {0};
+    PriorityQueue_INIT(&cycling_belief_events, cycling_belief_event_items_storage, memoryConfig.cyclingBeliefEventsMax);
+    PriorityQueue_INIT(&cycling_goal_events, cycling_goal_event_items_storage, memoryConfig.cyclingGoalEventsMax);
+    Memory_ClearCyclingEvents(&cycling_belief_events);
+    Memory_ClearCyclingEvents(&cycling_goal_events);
+    for(int i=0; i<memoryConfig.cyclingBeliefEventsMax; i++)
     {
         cycling_belief_event_storage[i] = (Event) {0};
         cycling_belief_events.items[i] = (Item) { .address = &(cycling_belief_event_storage[i]) };
     }
-    for(int i=0; i<CYCLING_GOAL_EVENTS_MAX; i++)
+    for(int i=0; i<memoryConfig.cyclingGoalEventsMax; i++)
     {
         cycling_goal_event_storage[i] = (Event) {0};
         cycling_goal_events.items[i] = (Item) { .address = &(cycling_goal_event_storage[i]) };
@@ -69,26 +110,117 @@ static void Memory_ResetEvents()
 
 static void Memory_ResetConcepts()
 {
-    PriorityQueue_INIT(&concepts, concept_items_storage, CONCEPTS_MAX);
-    for(int i=0; i<CONCEPTS_MAX; i++)
+    PriorityQueue_INIT(&concepts, concept_items_storage, memoryConfig.conceptsMax);
+    PriorityQueue_KeepPositions(&concepts, offsetof(Concept, queuePosition));
+    for(int i=0; i<memoryConfig.conceptsMax; i++)
     {
         concept_storage[i] = (Concept) {0};
         concepts.items[i] = (Item) { .address = &(concept_storage[i]) };
     }
+    //tables are only cleared when taken from the pool, which avoids touching all of them here
+    Stack_INIT(&precondition_table_stack, (void**) precondition_table_storageptrs, memoryConfig.preconditionTablesMax);
+    for(int i=memoryConfig.preconditionTablesMax-1; i>=0; i--)
+    {
+        Stack_Push(&precondition_table_stack, &precondition_table_storage[i]);
+    }
+    for(int opi=0; opi<=OPERATIONS_MAX; opi++)
+    {
+        operation_conceptsAmount[opi] = 0;
+    }
 }
 
-int concept_id = 0;
-VMItem* HTconcepts_storageptrs[CONCEPTS_MAX];
-VMItem HTconcepts_storage[CONCEPTS_MAX];
-VMItem* HTconcepts_HT[CONCEPTS_HASHTABLE_BUCKETS]; //the hash of the concept term is the index
+THREAD_LOCAL int concept_id = 0;
+THREAD_LOCAL HashTableSlot *HTconcepts_slots; //the hash of the concept term is the home slot
+
+//Arena space of amount elements of a size, each array starting at a cache line
+#define MEMORY_ARENA_SPACE(amount, size) ((((size_t) (amount)) * (size) + 63) / 64 * 64)
 
-void Memory_INIT()
+//Arena space for all arrays which are sized by the memory configuration
+size_t Memory_ArenaSize(Memory_Config config)
 {
-    HashTable_INIT(&HTconcepts, HTconcepts_storage, HTconcepts_storageptrs, HTconcepts_HT, CONCEPTS_HASHTABLE_BUCKETS, CONCEPTS_MAX, (Equal) Term_Equal, (Hash) Term_Hash);
+    return MEMORY_ARENA_SPACE(config.conceptsMax, sizeof(Concept)) +
+           MEMORY_ARENA_SPACE(config.conceptsMax, sizeof(Item)) +
+           MEMORY_ARENA_SPACE(HASHTABLE_BUCKETS_PER_ITEM*config.conceptsMax, sizeof(HashTableSlot)) +
+           MEMORY_ARENA_SPACE(POSTINGS_PER_CONCEPT*config.conceptsMax, sizeof(ConceptPosting)) +
+           MEMORY_ARENA_SPACE(config.atomsMax+1, sizeof(PostingList)) +
+           MEMORY_ARENA_SPACE(config.cyclingBeliefEventsMax, sizeof(Event)) +
+           MEMORY_ARENA_SPACE(config.cyclingBeliefEventsMax, sizeof(Item)) +
+           MEMORY_ARENA_SPACE(HASHTABLE_BUCKETS_PER_ITEM*config.cyclingBeliefEventsMax, sizeof(HashTableSlot)) +
+           MEMORY_ARENA_SPACE(config.cyclingGoalEventsMax, sizeof(Event)) +
+           MEMORY_ARENA_SPACE(config.cyclingGoalEventsMax, sizeof(Item)) +
+           MEMORY_ARENA_SPACE(HASHTABLE_BUCKETS_PER_ITEM*config.cyclingGoalEventsMax, sizeof(HashTableSlot)) +
+           MEMORY_ARENA_SPACE(1, sizeof(FIFO)) +
+           MEMORY_ARENA_SPACE(config.preconditionTablesMax, sizeof(Table)) +
+           MEMORY_ARENA_SPACE(config.preconditionTablesMax, sizeof(Table*)) +
+           (OPERATIONS_MAX+1) * MEMORY_ARENA_SPACE(config.preconditionTablesMax, sizeof(Concept*)) +
+           //taken by Decision_INIT for the precondition candidates and anticipating concepts, and by Cycle_INIT for the related concepts:
+           MEMORY_ARENA_SPACE(config.conceptsMax, sizeof(Concept*)) +
+           MEMORY_ARENA_SPACE(config.preconditionTablesMax, sizeof(Concept*)) +
+           MEMORY_ARENA_SPACE(config.conceptsMax, sizeof(ConceptPosting)) +
+           //taken by Stats_INIT for the rule stats:
+           MEMORY_ARENA_SPACE(RULES_MAX, sizeof(RuleStats)) +
+           //taken by Narsese_INIT for the atom names and the atoms hashtable:
+           MEMORY_ARENA_SPACE(config.atomsMax, ATOMIC_TERM_LEN_MAX) +
+           MEMORY_ARENA_SPACE(HASHTABLE_BUCKETS_PER_ITEM*config.atomsMax, sizeof(HashTableSlot));
+}
+
+bool Memory_ConfigValid(Memory_Config config)
+{
+    int max = INT_MAX / (POSTINGS_PER_CONCEPT + HASHTABLE_BUCKETS_PER_ITEM); //the largest multiple a capacity is taken with
+    return config.conceptsMax > 0 && config.cyclingBeliefEventsMax > 0 && config.cyclingGoalEventsMax > 0 && config.preconditionTablesMax > 0 && config.atomsMax > 0 &&
+           config.conceptsMax <= max && config.cyclingBeliefEventsMax <= max && config.cyclingGoalEventsMax <= max && config.preconditionTablesMax <= max && config.atomsMax <= ATOMS_MAX;
+}
+
+void *Memory_ArenaTake(int amount, size_t size)
+{
+    size_t space = MEMORY_ARENA_SPACE(amount, size);
+    assert(arenaUsed + space <= arenaSize, "Memory arena exhausted, a storage array is missing in Memory_ArenaSize!");
+    void *storage = &arena[arenaUsed];
+    arenaUsed += space;
+    return storage;
+}
+
+void Memory_INIT(Memory_Config config)
+{
+    assert(config.conceptsMax > 0 && config.cyclingBeliefEventsMax > 0 && config.cyclingGoalEventsMax > 0 && config.preconditionTablesMax > 0 && config.atomsMax > 0, "Memory capacities need to be positive!");
+    assert(config.atomsMax <= ATOMS_MAX, "More atoms than ATOMS_MAX, which is limited by the Atom type!");
+    memoryConfig = config;
+    size_t size = Memory_ArenaSize(config);
+    if(arena == NULL || size != arenaSize) //the arena is kept on reset with the same capacities
+    {
+        free(arena);
+        arena = calloc(size, 1);
+        assert(arena != NULL, "Memory arena allocation failed, decrease the capacities!");
+        arenaSize = size;
+    }
+    else
+    {
+        memset(arena, 0, arenaSize); //snapshots write the whole arena, so padding and unused storage must not be left over
+    }
+    arenaUsed = 0;
+    concept_storage = Memory_ArenaTake(config.conceptsMax, sizeof(Concept));
+    concept_items_storage = Memory_ArenaTake(config.conceptsMax, sizeof(Item));
+    HTconcepts_slots = Memory_ArenaTake(HASHTABLE_BUCKETS_PER_ITEM*config.conceptsMax, sizeof(HashTableSlot));
+    ConceptPosting *postings = Memory_ArenaTake(POSTINGS_PER_CONCEPT*config.conceptsMax, sizeof(ConceptPosting));
+    PostingList *postingLists = Memory_ArenaTake(config.atomsMax+1, sizeof(PostingList));
+    cycling_belief_event_storage = Memory_ArenaTake(config.cyclingBeliefEventsMax, sizeof(Event));
+    cycling_belief_event_items_storage = Memory_ArenaTake(config.cyclingBeliefEventsMax, sizeof(Item));
+    HTcycling_belief_events_slots = Memory_ArenaTake(HASHTABLE_BUCKETS_PER_ITEM*config.cyclingBeliefEventsMax, sizeof(HashTableSlot));
+    cycling_goal_event_storage = Memory_ArenaTake(config.cyclingGoalEventsMax, sizeof(Event));
+    cycling_goal_event_items_storage = Memory_ArenaTake(config.cyclingGoalEventsMax, sizeof(Item));
+    HTcycling_goal_events_slots = Memory_ArenaTake(HASHTABLE_BUCKETS_PER_ITEM*config.cyclingGoalEventsMax, sizeof(HashTableSlot));
+    belief_events = Memory_ArenaTake(1, sizeof(FIFO));
+    precondition_table_storage = Memory_ArenaTake(config.preconditionTablesMax, sizeof(Table));
+    precondition_table_storageptrs = Memory_ArenaTake(config.preconditionTablesMax, sizeof(Table*));
+    for(int opi=0; opi<=OPERATIONS_MAX; opi++)
+    {
+        operation_concepts[opi] = Memory_ArenaTake(config.preconditionTablesMax, sizeof(Concept*)); //only concepts with a table are in it
+    }
+    HashTable_INIT(&HTconcepts, HTconcepts_slots, HASHTABLE_BUCKETS_PER_ITEM*config.conceptsMax, (Equal) Term_Equal, (Hash) Term_Hash);
     conceptPriorityThreshold = 0.0;
     Memory_ResetConcepts();
     Memory_ResetEvents();
-    InvertedAtomIndex_INIT();
+    InvertedAtomIndex_INIT(postings, POSTINGS_PER_CONCEPT*config.conceptsMax, postingLists, config.atomsMax);
     for(int i=0; i<OPERATIONS_MAX; i++)
     {
         operations[i] = (Operation) {0};
@@ -96,11 +228,176 @@ void Memory_INIT()
     concept_id = 0;
 }
 
+void Memory_Free()
+{
+    free(arena);
+    arena = NULL;
+    arenaSize = arenaUsed = 0;
+}
+
+void Memory_SwapState(Memory_State *state)
+{
+    SWAP_STATE(concepts, state->concepts);
+    SWAP_STATE(cycling_belief_events, state->cycling_belief_events);
+    SWAP_STATE(cycling_goal_events, state->cycling_goal_events);
+    SWAP_STATE(HTconcepts, state->HTconcepts);
+    SWAP_STATE(HTcycling_belief_events, state->HTcycling_belief_events);
+    SWAP_STATE(HTcycling_goal_events, state->HTcycling_goal_events);
+    SWAP_STATE(belief_events, state->belief_events);
+    SWAP_STATE(operations, state->operations);
+    SWAP_STATE(PRINT_DERIVATIONS, state->PRINT_DERIVATIONS);
+    SWAP_STATE(PRINT_INPUT, state->PRINT_INPUT);
+    SWAP_STATE(LAZY_FORGETTING, state->LAZY_FORGETTING);
+    SWAP_STATE(memoryConfig, state->memoryConfig);
+    SWAP_STATE(arena, state->arena);
+    SWAP_STATE(arenaSize, state->arenaSize);
+    SWAP_STATE(arenaUsed, state->arenaUsed);
+    SWAP_STATE(concept_storage, state->concept_storage);
+    SWAP_STATE(concept_items_storage, state->concept_items_storage);
+    SWAP_STATE(cycling_belief_event_storage, state->cycling_belief_event_storage);
+    SWAP_STATE(cycling_belief_event_items_storage, state->cycling_belief_event_items_storage);
+    SWAP_STATE(cycling_goal_event_storage, state->cycling_goal_event_storage);
+    SWAP_STATE(cycling_goal_event_items_storage, state->cycling_goal_event_items_storage);
+    SWAP_STATE(HTconcepts_slots, state->HTconcepts_slots);
+    SWAP_STATE(HTcycling_belief_events_slots, state->HTcycling_belief_events_slots);
+    SWAP_STATE(HTcycling_goal_events_slots, state->HTcycling_goal_events_slots);
+    SWAP_STATE(precondition_table_storage, state->precondition_table_storage);
+    SWAP_STATE(precondition_table_storageptrs, state->precondition_table_storageptrs);
+    SWAP_STATE(precondition_table_stack, state->precondition_table_stack);
+    SWAP_STATE(operation_concepts, state->operation_concepts);
+    SWAP_STATE(operation_conceptsAmount, state->operation_conceptsAmount);
+    SWAP_STATE(conceptPriorityThreshold, state->conceptPriorityThreshold);
+    SWAP_STATE(PRINT_EVENTS_PRIORITY_THRESHOLD, state->PRINT_EVENTS_PRIORITY_THRESHOLD);
+    SWAP_STATE(concept_id, state->concept_id);
+}
+
+//Move a pointer into the arena to its offset+1 in it, so that snapshots hold no addresses of the process which saved them, or back
+//Pointers outside of the arena are left over in unused storage and are dropped, offsets beyond the arena are invalid
+static void *Memory_MovePointer(void *pointer, bool toOffset, bool *valid)
+{
+    if(toOffset)
+    {
+        bool inArena = pointer != NULL && (char*) pointer >= arena && (char*) pointer < arena + arenaSize;
+        return inArena ? (void*) ((uintptr_t) ((char*) pointer - arena) + 1) : NULL;
+    }
+    uintptr_t offset = (uintptr_t) pointer;
+    if(offset > arenaSize)
+    {
+        *valid = false;
+        return NULL;
+    }
+    return offset == 0 ? NULL : arena + (offset - 1);
+}
+#define MEMORY_MOVE_POINTER(pointer, toOffset, valid) { (pointer) = Memory_MovePointer((pointer), (toOffset), &(valid)); }
+
+static void Memory_MoveHashTablePointers(HashTable *ht, bool pointerValues, bool toOffsets, bool *valid)
+{
+    for(int i=0; i<ht->buckets; i++)
+    {
+        MEMORY_MOVE_POINTER(ht->slots[i].key, toOffsets, *valid);
+        if(pointerValues)
+        {
+            MEMORY_MOVE_POINTER(ht->slots[i].value, toOffsets, *valid);
+        }
+        //the chains and the free list are indices+1 of slots
+        *valid = *valid && ht->slots[i].next >= 0 && ht->slots[i].next <= ht->buckets && ht->slots[i].head >= 0 && ht->slots[i].head <= ht->buckets;
+    }
+}
+
+//Move all pointers in the arena to offsets or back, also in unused storage, false if the arena holds offsets or indices beyond its storage
+static bool Memory_MoveArenaPointers(bool toOffsets)
+{
+    bool valid = true;
+    for(int i=0; i<memoryConfig.conceptsMax; i++)
+    {
+        MEMORY_MOVE_POINTER(concepts.items[i].address, toOffsets, valid);
+        Concept *c = &concept_storage[i];
+        valid = valid && c->queuePosition >= 0 && c->queuePosition < memoryConfig.conceptsMax;
+        for(int opi=0; opi<=OPERATIONS_MAX; opi++)
+        {
+            MEMORY_MOVE_POINTER(c->precondition_beliefs[opi], toOffsets, valid);
+            valid = valid && c->operationConceptsIndex[opi] >= 0 && c->operationConceptsIndex[opi] < memoryConfig.preconditionTablesMax;
+        }
+    }
+    for(int i=0; i<memoryConfig.preconditionTablesMax; i++)
+    {
+        Table *table = &precondition_table_storage[i];
+        valid = valid && table->itemsAmount >= 0 && table->itemsAmount <= TABLE_SIZE;
+        for(int j=0; j<TABLE_SIZE; j++)
+        {
+            MEMORY_MOVE_POINTER(table->array[j].sourceConcept, toOffsets, valid);
+        }
+        MEMORY_MOVE_POINTER(precondition_table_storageptrs[i], toOffsets, valid);
+        for(int opi=0; opi<=OPERATIONS_MAX; opi++)
+        {
+            MEMORY_MOVE_POINTER(operation_concepts[opi][i], toOffsets, valid);
+        }
+    }
+    for(int i=0; i<POSTINGS_PER_CONCEPT*memoryConfig.conceptsMax; i++)
+    {
+        MEMORY_MOVE_POINTER(conceptPostings[i].c, toOffsets, valid);
+    }
+    for(int i=0; i<=memoryConfig.atomsMax; i++)
+    {
+        PostingList *list = &invertedAtomIndex[i];
+        valid = valid && list->start >= 0 && list->size >= 0 && list->size <= list->capacity && list->capacity <= POSTINGS_PER_CONCEPT*memoryConfig.conceptsMax - list->start;
+    }
+    for(int i=0; i<memoryConfig.cyclingBeliefEventsMax; i++)
+    {
+        MEMORY_MOVE_POINTER(cycling_belief_events.items[i].address, toOffsets, valid);
+    }
+    for(int i=0; i<memoryConfig.cyclingGoalEventsMax; i++)
+    {
+        MEMORY_MOVE_POINTER(cycling_goal_events.items[i].address, toOffsets, valid);
+    }
+    valid = valid && belief_events->itemsAmount >= 0 && belief_events->itemsAmount <= FIFO_SIZE && belief_events->currentIndex >= 0 && belief_events->currentIndex < FIFO_SIZE;
+    Memory_MoveHashTablePointers(&HTconcepts, true, toOffsets, &valid);
+    Memory_MoveHashTablePointers(&HTcycling_belief_events, true, toOffsets, &valid);
+    Memory_MoveHashTablePointers(&HTcycling_goal_events, true, toOffsets, &valid);
+    Memory_MoveHashTablePointers(&HTatoms, false, toOffsets, &valid); //the values are the atom indices
+    for(int i=0; i<memoryConfig.atomsMax; i++)
+    {
+        valid = valid && memchr(Narsese_atomNames[i], 0, ATOMIC_TERM_LEN_MAX) != NULL;
+    }
+    return valid;
+}
+
+bool Memory_WriteArena(FILE *file)
+{
+    Memory_MoveArenaPointers(true);
+    bool success = fwrite(arena, 1, arenaSize, file) == arenaSize;
+    Memory_MoveArenaPointers(false);
+    return success;
+}
+
+bool Memory_ReadArena(FILE *file)
+{
+    //the arrays are at the same positions as the capacities are the same, only the pointers between them have to be restored
+    return fread(arena, 1, arenaSize, file) == arenaSize && Memory_MoveArenaPointers(false);
+}
+
 Concept *Memory_FindConceptByTerm(Term *term)
 {
     return HashTable_Get(&HTconcepts, term);
 }
 
+//With lazy forgetting the usefulness of a concept is only up to date when it was re-evaluated recently,
+//the eviction candidate is re-evaluated, and if it turns out to be more useful (it was used since), it's updated and the next one is tried
+static void Memory_ReevaluateEvictionCandidates(long currentTime)
+{
+    for(int k=0; k<LAZY_FORGETTING_EVICTION_CANDIDATES; k++)
+    {
+        Concept *c = concepts.items[0].address;
+        double usefulness = Usage_usefulness(c->usage, currentTime);
+        if(usefulness <= concepts.items[0].priority)
+        {
+            break;
+        }
+        PriorityQueue_PopMin(&concepts, NULL, NULL);
+        PriorityQueue_Push(&concepts, usefulness); //takes the popped item's place again
+    }
+}
+
 Concept* Memory_Conceptualize(Term *term, long currentTime)
 {
     if(Memory_getOperationID(term)) //don't conceptualize operations
@@ -120,6 +417,10 @@ Concept* Memory_Conceptualize(Term *term, long currentTime)
     Concept *ret = Memory_FindConceptByTerm(term);
     if(ret == NULL)
     {
+        if(LAZY_FORGETTING && concepts.itemsAmount >= concepts.maxElements)
+        {
+            Memory_ReevaluateEvictionCandidates(currentTime);
+        }
         Concept *recycleConcept = NULL;
         //try to add it, and if successful add to voting structure
         PriorityQueue_Push_Feedback feedback = PriorityQueue_Push(&concepts, 1);
@@ -134,14 +435,18 @@ Concept* Memory_Conceptualize(Term *term, long currentTime)
                 IN_DEBUG( assert(HashTable_Get(&HTconcepts, &recycleConcept->term) == NULL, "VMItem to delete was not deleted!"); )
                 //and also delete from inverted atom index:
                 InvertedAtomIndex_RemoveConcept(recycleConcept->term, recycleConcept);
+                //and give its implication tables back to the pool:
+                Memory_ReleasePreconditionTables(recycleConcept);
             }
-            //Add term to inverted atom index as well:
-            InvertedAtomIndex_AddConcept(*term, recycleConcept);
             //proceed with recycling of the concept in the priority queue
-            *recycleConcept = (Concept) {0};
+            *recycleConcept = (Concept) { .queuePosition = recycleConcept->queuePosition };
             recycleConcept->term = *term;
             recycleConcept->id = concept_id;
             recycleConcept->usage = (Usage) { .useCount = 1, .lastUsed = currentTime };
+            recycleConcept->priorityTime = currentTime;
+            recycleConcept->priorityKey = -INFINITY;
+            //Add term to inverted atom index as well:
+            InvertedAtomIndex_AddConcept(*term, recycleConcept);
             concept_id++;
             //also add added concept to HashMap:
             IN_DEBUG( assert(HashTable_Get(&HTconcepts, &recycleConcept->term) == NULL, "VMItem to add already exists!"); )
@@ -157,23 +462,27 @@ Concept* Memory_Conceptualize(Term *term, long currentTime)
     return NULL;
 }
 
-Event selectedBeliefs[BELIEF_EVENT_SELECTIONS]; //better to be global
-double selectedBeliefsPriority[BELIEF_EVENT_SELECTIONS]; //better to be global
-int beliefsSelectedCnt = 0;
-Event selectedGoals[GOAL_EVENT_SELECTIONS]; //better to be global
-double selectedGoalsPriority[GOAL_EVENT_SELECTIONS]; //better to be global
-int goalsSelectedCnt = 0;
+THREAD_LOCAL Event selectedBeliefs[BELIEF_EVENT_SELECTIONS]; //better to be global
+THREAD_LOCAL double selectedBeliefsPriority[BELIEF_EVENT_SELECTIONS]; //better to be global
+THREAD_LOCAL int beliefsSelectedCnt = 0;
+THREAD_LOCAL Event selectedGoals[GOAL_EVENT_SELECTIONS]; //better to be global
+THREAD_LOCAL double selectedGoalsPriority[GOAL_EVENT_SELECTIONS]; //better to be global
+THREAD_LOCAL int goalsSelectedCnt = 0;
 
 static bool Memory_containsEvent(PriorityQueue *queue, Event *event)
 {
-    for(int i=0; i<queue->itemsAmount; i++)
+    return HashTable_Get(Memory_CyclingEventsHashTable(queue), event) != NULL;
+}
+
+bool Memory_PopCyclingEvent(PriorityQueue *queue, Event **returnEvent, double *returnPriority)
+{
+    if(!PriorityQueue_PopMax(queue, (void**) returnEvent, returnPriority))
     {
-        if(Event_Equal(event, queue->items[i].address))
-        {
-            return true;
-        }
+        return false;
     }
-    return false;
+    //the popped event keeps its content until its storage is recycled by the next push
+    HashTable_Delete(Memory_CyclingEventsHashTable(queue), *returnEvent);
+    return true;
 }
 
 bool Memory_containsBelief(Event *e)
@@ -228,8 +537,14 @@ bool Memory_addCyclingEvent(Event *e, double priority, bool sequenced, long curr
     PriorityQueue_Push_Feedback feedback = PriorityQueue_Push(priority_queue, priority);
     if(feedback.added)
     {
+        HashTable *hashtable = Memory_CyclingEventsHashTable(priority_queue);
         Event *toRecyle = feedback.addedItem.address;
+        if(feedback.evicted)
+        {
+            HashTable_Delete(hashtable, feedback.evictedItem.address); //before its storage gets overwritten
+        }
         *toRecyle = *e;
+        HashTable_Set(hashtable, toRecyle, toRecyle);
         return true;
     }
     return false;
@@ -237,7 +552,7 @@ bool Memory_addCyclingEvent(Event *e, double priority, bool sequenced, long curr
 
 static void Memory_printAddedKnowledge(Term *term, char type, Truth *truth, long occurrenceTime, double occurrenceTimeOffset, double priority, bool input, bool derived, bool revised, bool controlInfo)
 {
-    if(((input && PRINT_INPUT) || (!input && PRINT_DERIVATIONS)) && (input || priority > PRINT_EVENTS_PRIORITY_THRESHOLD))
+    if(((input && PRINT_INPUT) || (!input && PRINT_DERIVATIONS)) && (input || priority > PRINT_EVENTS_PRIORITY_THRESHOLD) && !Journal_Replaying())
     {
         if(controlInfo)
             fputs(revised ? "Revised: " : (input ? "Input: " : "Derived: "), stdout);
@@ -272,7 +587,7 @@ void Memory_printAddedImplication(Term *implication, Truth *truth, double occurr
     Memory_printAddedKnowledge(implication, EVENT_TYPE_BELIEF, truth, OCCURRENCE_ETERNAL, occurrenceTimeOffset, priority, input, true, revised, controlInfo);
 }
 
-void Memory_ProcessNewBeliefEvent(Event *event, long currentTime, double priority, bool input, bool isImplication)
+void Memory_ProcessNewBeliefEvent(Event *event, long currentTime, double priority, bool input, bool isImplication, bool echo)
 {
     bool eternalInput = input && event->occurrenceTime == OCCURRENCE_ETERNAL;
     Event eternal_event = *event;
@@ -325,8 +640,9 @@ void Memory_ProcessNewBeliefEvent(Event *event, long currentTime, double priorit
                 imp.sourceConceptId = source_concept->id;
                 imp.sourceConcept = source_concept;
                 imp.term = event->term;
-                Implication *revised = Table_AddAndRevise(&target_concept->precondition_beliefs[opi], &imp);
-                if(revised != NULL)
+                Table *table = Memory_PreconditionTable(target_concept, opi);
+                Implication *revised = table == NULL ? NULL : Table_AddAndRevise(table, &imp);
+                if(revised != NULL && echo)
                 {
                     bool wasRevised = revised->truth.confidence > event->truth.confidence || revised->truth.confidence == MAX_CONFIDENCE;
                     Memory_printAddedImplication(&event->term, &imp.truth, event->occurrenceTimeOffset, priority, input, false, true);
@@ -342,7 +658,7 @@ void Memory_ProcessNewBeliefEvent(Event *event, long currentTime, double priorit
         if(c != NULL)
         {
             c->usage = Usage_use(c->usage, currentTime, eternalInput);
-            c->priority = MAX(c->priority, priority);
+            Memory_RaiseConceptPriority(c, priority, currentTime);
             if(event->occurrenceTime != OCCURRENCE_ETERNAL && event->occurrenceTime <= currentTime)
             {
                 c->belief_spike = Inference_RevisionAndChoice(&c->belief_spike, event, currentTime, NULL);
@@ -356,7 +672,7 @@ void Memory_ProcessNewBeliefEvent(Event *event, long currentTime, double priorit
             bool revision_happened = false;
             c->belief = Inference_RevisionAndChoice(&c->belief, &eternal_event, currentTime, &revision_happened);
             c->belief.creationTime = currentTime; //for metrics
-            if(input)
+            if(input && echo)
             {
                 Memory_printAddedEvent(event, priority, input, false, false, true);
             }
@@ -372,7 +688,8 @@ void Memory_ProcessNewBeliefEvent(Event *event, long currentTime, double priorit
     }
 }
 
-void Memory_AddEvent(Event *event, long currentTime, double priority, bool input, bool derived, bool revised, bool sequenced)
+//Adds the event, echo is whether input is printed
+static void Memory_AddEventEchoed(Event *event, long currentTime, double priority, bool input, bool derived, bool revised, bool sequenced, bool echo)
 {
     if(!revised && !input) //derivations get penalized by complexity as well, but revised ones not as they already come from an input or derivation
     {
@@ -385,9 +702,9 @@ void Memory_AddEvent(Event *event, long currentTime, double priority, bool input
     }
     if(event->occurrenceTime != OCCURRENCE_ETERNAL && input && event->type == EVENT_TYPE_BELIEF)
     {
-        FIFO_Add(event, &belief_events); //not revised yet
+        FIFO_Add(event, belief_events); //not revised yet
     }
-    if(input && (Narsese_isOperation(&event->term) || event->type == EVENT_TYPE_GOAL))
+    if(input && echo && (Narsese_isOperation(&event->term) || event->type == EVENT_TYPE_GOAL))
     {
         Memory_printAddedEvent(event, priority, input, false, false, true);
     }
@@ -396,7 +713,7 @@ void Memory_AddEvent(Event *event, long currentTime, double priority, bool input
     if(event->type == EVENT_TYPE_BELIEF)
     {
         addedToCyclingEventsQueue = Memory_addCyclingEvent(event, priority, sequenced, currentTime);
-        Memory_ProcessNewBeliefEvent(event, currentTime, priority, input, isImplication);
+        Memory_ProcessNewBeliefEvent(event, currentTime, priority, input, isImplication, echo);
     }
     if(event->type == EVENT_TYPE_GOAL)
     {
@@ -410,9 +727,14 @@ void Memory_AddEvent(Event *event, long currentTime, double priority, bool input
     assert(event->type == EVENT_TYPE_BELIEF || event->type == EVENT_TYPE_GOAL, "Errornous event type");
 }
 
-void Memory_AddInputEvent(Event *event, long currentTime)
+void Memory_AddEvent(Event *event, long currentTime, double priority, bool input, bool derived, bool revised, bool sequenced)
 {
-    Memory_AddEvent(event, currentTime, 1, true, false, false, false);
+    Memory_AddEventEchoed(event, currentTime, priority, input, derived, revised, sequenced, true);
+}
+
+void Memory_AddInputEvent(Event *event, long currentTime, bool echo)
+{
+    Memory_AddEventEchoed(event, currentTime, 1, true, false, false, false, echo);
 }
 
 bool Memory_ImplicationValid(Implication *imp)
@@ -420,6 +742,65 @@ bool Memory_ImplicationValid(Implication *imp)
     return imp->sourceConceptId == ((Concept*) imp->sourceConcept)->id;
 }
 
+double Memory_ConceptPriority(Concept *c, long currentTime)
+{
+    long decaySteps = currentTime - c->priorityTime;
+    return LAZY_FORGETTING && decaySteps > 0 ? c->priority * pow(CONCEPT_DURABILITY, decaySteps) : c->priority;
+}
+
+void Memory_SetConceptPriority(Concept *c, double priority, long currentTime)
+{
+    c->priority = priority;
+    c->priorityTime = currentTime;
+}
+
+void Memory_RaiseConceptPriority(Concept *c, double priority, long currentTime)
+{
+    if(priority > Memory_ConceptPriority(c, currentTime))
+    {
+        Memory_SetConceptPriority(c, priority, currentTime);
+        InvertedAtomIndex_IncreasePriorityKey(c->term, c, MAX(c->priorityKey, Memory_ConceptPriorityKey(priority, currentTime)));
+    }
+}
+
+double Memory_ConceptPriorityKey(double priority, long currentTime)
+{
+    return priority > 0 ? log(priority) - currentTime * log(CONCEPT_DURABILITY) : -INFINITY;
+}
+
+Table* Memory_PreconditionTable(Concept *c, int opi)
+{
+    if(c->precondition_beliefs[opi] == NULL)
+    {
+        if(Stack_IsEmpty(&precondition_table_stack))
+        {
+            return NULL;
+        }
+        Table *table = Stack_Pop(&precondition_table_stack);
+        *table = (Table) {0};
+        c->precondition_beliefs[opi] = table;
+        c->operationConceptsIndex[opi] = operation_conceptsAmount[opi];
+        operation_concepts[opi][operation_conceptsAmount[opi]++] = c;
+    }
+    return c->precondition_beliefs[opi];
+}
+
+void Memory_ReleasePreconditionTables(Concept *c)
+{
+    for(int opi=0; opi<=OPERATIONS_MAX; opi++)
+    {
+        if(c->precondition_beliefs[opi] != NULL)
+        {
+            Stack_Push(&precondition_table_stack, c->precondition_beliefs[opi]);
+            c->precondition_beliefs[opi] = NULL;
+            //the last concept of the operation takes its place
+            Concept *last = operation_concepts[opi][--operation_conceptsAmount[opi]];
+            operation_concepts[opi][c->operationConceptsIndex[opi]] = last;
+            last->operationConceptsIndex[opi] = c->operationConceptsIndex[opi];
+        }
+    }
+}
+
 int Memory_getOperationID(Term *term)
 {
     Atom op_atom = Narsese_getOperationAtom(term);
@@ -33,23 +33,38 @@
 //References//
 //////////////
 #include <math.h>
+#include <stddef.h>
+#include <limits.h>
 #include "Concept.h"
 #include "InvertedAtomIndex.h"
 #include "PriorityQueue.h"
 #include "Config.h"
 #include "HashTable.h"
+#include "Stack.h"
 #include "Variable.h"
 
 //Parameters//
 //----------//
 //Inferences per cycle (amount of events from cycling events)
 extern double PROPAGATION_THRESHOLD;
-extern bool PRINT_DERIVATIONS;
-extern bool PRINT_INPUT;
-extern double conceptPriorityThreshold;
+extern THREAD_LOCAL bool PRINT_DERIVATIONS;
+extern THREAD_LOCAL bool PRINT_INPUT;
+extern THREAD_LOCAL double conceptPriorityThreshold;
+extern THREAD_LOCAL bool LAZY_FORGETTING;
 
 //Data structure//
 //--------------//
+//Capacities of memory, the storage of its data structures is allocated at once from an arena on init
+typedef struct
+{
+    int conceptsMax;
+    int cyclingBeliefEventsMax;
+    int cyclingGoalEventsMax;
+    int preconditionTablesMax;
+    int atomsMax;
+}Memory_Config;
+#define MEMORY_CONFIG_DEFAULT ((Memory_Config) { .conceptsMax = CONCEPTS_MAX, .cyclingBeliefEventsMax = CYCLING_BELIEF_EVENTS_MAX, .cyclingGoalEventsMax = CYCLING_GOAL_EVENTS_MAX, .preconditionTablesMax = PRECONDITION_TABLES_MAX, .atomsMax = ATOMS_MAX })
+extern THREAD_LOCAL Memory_Config memoryConfig;
 typedef void (*Action)(Term);
 typedef struct
 {
@@ -58,41 +73,122 @@ typedef struct
     Term arguments[OPERATIONS_BABBLE_ARGS_MAX];
 }Operation;
 extern bool ontology_handling;
-extern Event selectedBeliefs[BELIEF_EVENT_SELECTIONS]; //better to be global
-extern double selectedBeliefsPriority[BELIEF_EVENT_SELECTIONS]; //better to be global
-extern int beliefsSelectedCnt;
-extern Event selectedGoals[GOAL_EVENT_SELECTIONS]; //better to be global
-extern double selectedGoalsPriority[GOAL_EVENT_SELECTIONS]; //better to be global
-extern int goalsSelectedCnt;
+extern THREAD_LOCAL Event selectedBeliefs[BELIEF_EVENT_SELECTIONS]; //better to be global
+extern THREAD_LOCAL double selectedBeliefsPriority[BELIEF_EVENT_SELECTIONS]; //better to be global
+extern THREAD_LOCAL int beliefsSelectedCnt;
+extern THREAD_LOCAL Event selectedGoals[GOAL_EVENT_SELECTIONS]; //better to be global
+extern THREAD_LOCAL double selectedGoalsPriority[GOAL_EVENT_SELECTIONS]; //better to be global
+extern THREAD_LOCAL int goalsSelectedCnt;
 //Concepts in main memory:
-extern PriorityQueue concepts;
+extern THREAD_LOCAL PriorityQueue concepts;
+//Storage of the concepts, the first concepts.itemsAmount of it are the ones in memory, as evicted storage is recycled:
+extern THREAD_LOCAL Concept *concept_storage;
 //cycling events cycling in main memory:
-extern PriorityQueue cycling_belief_events;
-extern PriorityQueue cycling_goal_events;
+extern THREAD_LOCAL PriorityQueue cycling_belief_events;
+extern THREAD_LOCAL PriorityQueue cycling_goal_events;
 //Hashtable of concepts used for fast retrieval of concepts via term:
-extern HashTable HTconcepts;
+extern THREAD_LOCAL HashTable HTconcepts;
+//Hashtables of the cycling events for fast duplicate checks:
+extern THREAD_LOCAL HashTable HTcycling_belief_events;
+extern THREAD_LOCAL HashTable HTcycling_goal_events;
+//Pool of implication tables for the concepts:
+extern THREAD_LOCAL Stack precondition_table_stack;
+//Concepts holding a precondition table per operation, which are the only ones anticipation has to consider:
+extern THREAD_LOCAL Concept **operation_concepts[OPERATIONS_MAX+1];
+extern THREAD_LOCAL int operation_conceptsAmount[OPERATIONS_MAX+1];
 //Input event buffers:
-extern FIFO belief_events;
+extern THREAD_LOCAL FIFO *belief_events;
 //Registered perations
-extern Operation operations[OPERATIONS_MAX];
+extern THREAD_LOCAL Operation operations[OPERATIONS_MAX];
 //Priority threshold for printing derivations
-extern double PRINT_EVENTS_PRIORITY_THRESHOLD;
+extern THREAD_LOCAL double PRINT_EVENTS_PRIORITY_THRESHOLD;
+//Memory and its parameters of a reasoner instance
+typedef struct
+{
+    PriorityQueue concepts;
+    PriorityQueue cycling_belief_events;
+    PriorityQueue cycling_goal_events;
+    HashTable HTconcepts;
+    HashTable HTcycling_belief_events;
+    HashTable HTcycling_goal_events;
+    FIFO *belief_events;
+    Operation operations[OPERATIONS_MAX];
+    bool PRINT_DERIVATIONS;
+    bool PRINT_INPUT;
+    bool LAZY_FORGETTING;
+    Memory_Config memoryConfig;
+    char *arena;
+    size_t arenaSize;
+    size_t arenaUsed;
+    Concept *concept_storage;
+    Item *concept_items_storage;
+    Event *cycling_belief_event_storage;
+    Item *cycling_belief_event_items_storage;
+    Event *cycling_goal_event_storage;
+    Item *cycling_goal_event_items_storage;
+    HashTableSlot *HTconcepts_slots;
+    HashTableSlot *HTcycling_belief_events_slots;
+    HashTableSlot *HTcycling_goal_events_slots;
+    Table *precondition_table_storage;
+    Table **precondition_table_storageptrs;
+    Stack precondition_table_stack;
+    Concept **operation_concepts[OPERATIONS_MAX+1];
+    int operation_conceptsAmount[OPERATIONS_MAX+1];
+    double conceptPriorityThreshold;
+    double PRINT_EVENTS_PRIORITY_THRESHOLD;
+    int concept_id;
+}Memory_State;
+#define MEMORY_STATE_INITIAL ((Memory_State) { .PRINT_DERIVATIONS = PRINT_DERIVATIONS_INITIAL, .PRINT_INPUT = PRINT_INPUT_INITIAL, .LAZY_FORGETTING = LAZY_FORGETTING_INITIAL, \
+                                               .PRINT_EVENTS_PRIORITY_THRESHOLD = PRINT_EVENTS_PRIORITY_THRESHOLD_INITIAL })
 
 //Methods//
 //-------//
-//Init memory
-void Memory_INIT();
+//Init memory, allocating its storage for the capacities of the config
+void Memory_INIT(Memory_Config config);
+//Take storage of amount elements of a size from the arena, valid until the next Memory_INIT which also has to account for it
+void *Memory_ArenaTake(int amount, size_t size);
+//Free the arena, the memory has to be initialized again before it can be used
+void Memory_Free();
+//Arena space the storage of a memory with the capacities takes
+size_t Memory_ArenaSize(Memory_Config config);
+//Whether the capacities are positive and small enough to index the storage sized by them
+bool Memory_ConfigValid(Memory_Config config);
+//Write the arena, with its pointers written as offsets in it, false on failure
+bool Memory_WriteArena(FILE *file);
+//Read an arena of a memory with the same capacities, restoring its pointers, false on failure or if it holds offsets or indices beyond its storage
+bool Memory_ReadArena(FILE *file);
+//Exchange the memory and its parameters with the ones kept for a reasoner instance
+void Memory_SwapState(Memory_State *state);
 //Find a concept
 Concept *Memory_FindConceptByTerm(Term *term);
 //Create a new concept
 Concept* Memory_Conceptualize(Term *term, long currentTime);
 //Add event to memory
 void Memory_AddEvent(Event *event, long currentTime, double priority, bool input, bool derived, bool revised, bool sequenced);
-void Memory_AddInputEvent(Event *event, long currentTime);
+//Add input event to memory, echo is whether it's printed
+void Memory_AddInputEvent(Event *event, long currentTime, bool echo);
+//Add event for cycling through the system, false if it's a duplicate or didn't make it into the queue
+bool Memory_addCyclingEvent(Event *e, double priority, bool sequenced, long currentTime);
+//Pop the highest priority event of a cycling events queue, keeping its duplicate check hashtable in sync
+bool Memory_PopCyclingEvent(PriorityQueue *queue, Event **returnEvent, double *returnPriority);
+//Remove all events of a cycling events queue
+void Memory_ClearCyclingEvents(PriorityQueue *queue);
 //Add operation to memory
 void Memory_AddOperation(int id, Operation op);
 //check if implication is still valid (source concept might be forgotten)
 bool Memory_ImplicationValid(Implication *imp);
+//Concept priority at currentTime, with lazy forgetting decayed by CONCEPT_DURABILITY since it was last set
+double Memory_ConceptPriority(Concept *c, long currentTime);
+//Set the concept priority at currentTime
+void Memory_SetConceptPriority(Concept *c, double priority, long currentTime);
+//Raise the concept priority at currentTime to priority if it's lower, keeping the inverted atom index sorted
+void Memory_RaiseConceptPriority(Concept *c, double priority, long currentTime);
+//Key which orders concepts by priority independent of the time, as forgetting decays all priorities the same way
+double Memory_ConceptPriorityKey(double priority, long currentTime);
+//Get the precondition table of a concept for an operation, taking it from the table pool on first use (NULL if exhausted)
+Table* Memory_PreconditionTable(Concept *c, int opi);
+//Return the precondition tables of a concept to the table pool
+void Memory_ReleasePreconditionTables(Concept *c);
 //Print an event in memory:
 void Memory_printAddedEvent(Event *event, double priority, bool input, bool derived, bool revised, bool controlInfo);
 //Print an implication in memory:
@@ -25,6 +25,140 @@
 #include "NAL.h"
 
 int ruleID = 0;
+//A rule with the root copulas required by its premises, 0 if the premise can have any root
+typedef struct
+{
+    bool doublePremise;
+    Atom root1;
+    Atom root2;
+    char *premise1;
+    char *premise2;
+    char *conclusion;
+    char *truthFunction;
+} RuleInfo;
+//The rules are collected in a first pass to generate the copula-indexed dispatch
+static bool collectingRules = false;
+static RuleInfo rules[RULES_MAX];
+static int rulesAmount = 0;
+//The distinct root copulas of the premises, with 0 at index 0 for roots no rule requires
+static Atom roots1[RULES_MAX+1];
+static Atom roots2[RULES_MAX+1];
+static int roots1Amount = 0, roots2Amount = 0;
+
+static Atom NAL_RuleRoot(Term *premise)
+{
+    Atom atom = premise->atoms[0];
+    //upper case atoms are treated as variables in the meta rule language
+    return atom && Narsese_atomNames[atom-1][0] >= 'A' && Narsese_atomNames[atom-1][0] <= 'Z' ? 0 : atom;
+}
+
+static void NAL_AddRoot(Atom *roots, int *rootsAmount, Atom root)
+{
+    for(int i=0; i<*rootsAmount; i++)
+    {
+        if(roots[i] == root)
+        {
+            return;
+        }
+    }
+    roots[(*rootsAmount)++] = root;
+}
+
+static bool NAL_RuleApplies(int rule, bool doublePremise, Atom root1, Atom root2)
+{
+    return rules[rule].doublePremise == doublePremise && (!rules[rule].root1 || rules[rule].root1 == root1) && (!rules[rule].root2 || rules[rule].root2 == root2);
+}
+
+static int NAL_RuleClass(bool doublePremise, int i1, int i2)
+{
+    return (doublePremise*roots1Amount + i1)*roots2Amount + i2;
+}
+
+//The next rule after rule which can apply to premises of the class
+static int NAL_NextRule(int rule, bool doublePremise, int i1, int i2)
+{
+    int next = rule+1;
+    while(next < rulesAmount && !NAL_RuleApplies(next, doublePremise, roots1[i1], roots2[i2]))
+    {
+        next++;
+    }
+    return next;
+}
+
+//Two-level switch over the root copulas of the premises, jumping to the first rule of the premise class
+static void NAL_GenerateRuleDispatch()
+{
+    puts("int ruleClass = 0;");
+    for(int doublePremise=1; doublePremise>=0; doublePremise--)
+    {
+        puts(doublePremise ? "if(doublePremise)\n{\nswitch(term1.atoms[0])\n{" : "switch(term1.atoms[0])\n{");
+        for(int j1=1; j1<=roots1Amount; j1++)
+        {
+            int i1 = j1 % roots1Amount; //"other" roots at index 0 last as default
+            if(i1) { printf("case %d:\n", roots1[i1]); } else { puts("default:"); }
+            if(doublePremise)
+            {
+                puts("switch(term2.atoms[0])\n{");
+                for(int j2=1; j2<=roots2Amount; j2++)
+                {
+                    int i2 = j2 % roots2Amount;
+                    if(i2) { printf("case %d: ", roots2[i2]); } else { fputs("default: ", stdout); }
+                    printf("ruleClass = %d; goto RULE_%d;\n", NAL_RuleClass(true, i1, i2), NAL_NextRule(-1, true, i1, i2));
+                }
+                puts("}");
+            }
+            else
+            {
+                printf("ruleClass = %d; goto RULE_%d;\n", NAL_RuleClass(false, i1, 0), NAL_NextRule(-1, false, i1, 0));
+            }
+        }
+        puts(doublePremise ? "}\n}" : "}");
+    }
+}
+
+//Continues with the next rule of the premise class, falling through if it's the subsequent one
+static void NAL_GenerateRuleSuccessor()
+{
+    printf("NEXT_%d:\nRULE_STATS_END(%d)\nswitch(ruleClass)\n{\n", ruleID, ruleID);
+    bool doublePremise = rules[ruleID].doublePremise;
+    for(int i1=0; i1<roots1Amount; i1++)
+    {
+        for(int i2=0; i2<(doublePremise ? roots2Amount : 1); i2++)
+        {
+            int next = NAL_NextRule(ruleID, doublePremise, i1, i2);
+            if(NAL_RuleApplies(ruleID, doublePremise, roots1[i1], roots2[i2]) && next != ruleID+1)
+            {
+                printf("case %d: goto RULE_%d;\n", NAL_RuleClass(doublePremise, i1, i2), next);
+            }
+        }
+    }
+    puts("}");
+}
+
+//Prints the rule as C string literal for the rule names of the rule stats
+static void NAL_GenerateRuleName(RuleInfo *rule)
+{
+    char name[NARSESE_LEN_MAX*4];
+    if(rule->doublePremise)
+    {
+        snprintf(name, sizeof(name), "%s, %s |- %s %s", rule->premise1, rule->premise2, rule->conclusion, rule->truthFunction);
+    }
+    else
+    {
+        snprintf(name, sizeof(name), "%s |- %s %s", rule->premise1, rule->conclusion, rule->truthFunction);
+    }
+    putchar('"');
+    for(char *c = name; *c; c++)
+    {
+        if(*c == '"' || *c == '\\')
+        {
+            putchar('\\');
+        }
+        putchar(*c);
+    }
+    puts("\",");
+}
+
 static void NAL_GeneratePremisesUnifier(int i, Atom atom, int premiseIndex)
 {
     if(atom)
@@ -35,17 +169,17 @@ static void NAL_GeneratePremisesUnifier(int i, Atom atom, int premiseIndex)
         {
             //unification failure by inequal value assignment (value at position i versus previously assigned one), and variable binding
             printf("subtree = Term_ExtractSubterm(&term%d, %d);\n", premiseIndex, i);
-            printf("if((substitutions[%d].atoms[0]!=0 && !Term_Equal(&substitutions[%d], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto RULE_%d; }\n", atom, atom, ruleID);
+            printf("if((substitutions[%d].atoms[0]!=0 && !Term_Equal(&substitutions[%d], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_%d; }\n", atom, atom, ruleID);
             if(isOp)
             {
-                printf("if(!Narsese_isOperation(&subtree)) { goto RULE_%d; }\n", ruleID);
+                printf("if(!Narsese_isOperation(&subtree)) { goto NEXT_%d; }\n", ruleID);
             }
             printf("substitutions[%d] = subtree;\n", atom);
         }
         else
         {
             //structural constraint given by copulas at position i
-            printf("if(term%d.atoms[%d] != %d){ goto RULE_%d; }\n", premiseIndex, i, atom, ruleID);
+            printf("if(term%d.atoms[%d] != %d){ goto NEXT_%d; }\n", premiseIndex, i, atom, ruleID);
         }
     }
 }
@@ -57,7 +191,7 @@ static void NAL_GenerateConclusionSubstitution(int i, Atom atom)
         if(Narsese_atomNames[atom-1][0] >= 'A' && Narsese_atomNames[atom-1][0] <= 'Z')
         {
             //conclusion term gets variables substituted
-            printf("if(!Term_OverrideSubterm(&conclusion,%d,&substitutions[%d])){ goto RULE_%d; }\n", i, atom, ruleID);
+            printf("if(!Term_OverrideSubterm(&conclusion,%d,&substitutions[%d])){ goto NEXT_%d; }\n", i, atom, ruleID);
         }
         else
         {
@@ -67,15 +201,16 @@ static void NAL_GenerateConclusionSubstitution(int i, Atom atom)
     }
 }
 
-static void NAL_GenerateConclusionTerm(char *premise1, char *premise2, char* conclusion, bool doublePremise)
+static void NAL_GenerateConclusionTerm(char *premise1, char *premise2, char* conclusion, bool doublePremise, bool ruleStats)
 {
     Term term1 = Narsese_Term(premise1);
     Term term2 = doublePremise ? Narsese_Term(premise2) : (Term) {0};
     Term conclusion_term = Narsese_Term(conclusion);
-    printf("RULE_%d:\n{\n", ruleID++);
+    printf("RULE_%d:\n{\n", ruleID);
+    if(ruleStats) { printf("RULE_STATS_ATTEMPT(%d)\n", ruleID); }
     //skip double/single premise rule if single/double premise
-    if(doublePremise) { printf("if(!doublePremise) { goto RULE_%d; }\n", ruleID); }
-    if(!doublePremise) { printf("if(doublePremise) { goto RULE_%d; }\n", ruleID); }
+    if(doublePremise) { printf("if(!doublePremise) { goto NEXT_%d; }\n", ruleID); }
+    if(!doublePremise) { printf("if(doublePremise) { goto NEXT_%d; }\n", ruleID); }
     puts("Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};"); //27 because of 9 indep, 9 dep, 9 query vars, and +1 for Op
     for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
     {
@@ -88,6 +223,7 @@ static void NAL_GenerateConclusionTerm(char *premise1, char *premise2, char* con
             NAL_GeneratePremisesUnifier(i, term2.atoms[i], 2);
         }
     }
+    if(ruleStats) { printf("RULE_STATS_UNIFICATION(%d)\n", ruleID); }
     puts("Term conclusion = {0};");
     for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
     {
@@ -97,7 +233,16 @@ static void NAL_GenerateConclusionTerm(char *premise1, char *premise2, char* con
 
 static void NAL_GenerateRule(char *premise1, char *premise2, char* conclusion, char* truthFunction, bool doublePremise, bool switchTruthArgs, bool VarIntro)
 {
-    NAL_GenerateConclusionTerm(premise1, premise2, conclusion, doublePremise);
+    if(collectingRules)
+    {
+        assert(ruleID < RULES_MAX, "Too many rules, increase RULES_MAX!");
+        Term term1 = Narsese_Term(premise1);
+        Term term2 = doublePremise ? Narsese_Term(premise2) : (Term) {0};
+        rules[ruleID++] = (RuleInfo) { .doublePremise = doublePremise, .root1 = NAL_RuleRoot(&term1), .root2 = NAL_RuleRoot(&term2),
+                                       .premise1 = premise1, .premise2 = premise2, .conclusion = conclusion, .truthFunction = truthFunction };
+        return;
+    }
+    NAL_GenerateConclusionTerm(premise1, premise2, conclusion, doublePremise, true);
     if(switchTruthArgs)
     {
         printf("Truth conclusionTruth = %s(truth2,truth1);\n", truthFunction);
@@ -106,19 +251,39 @@ static void NAL_GenerateRule(char *premise1, char *premise2, char* conclusion, c
     {
         printf("Truth conclusionTruth = %s(truth1,truth2);\n", truthFunction);
     }
-    printf("NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, %d);}\n", VarIntro);
+    printf("NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, %d, %d);}\n", VarIntro, ruleID);
+    NAL_GenerateRuleSuccessor();
+    ruleID++;
 }
 
 static void NAL_GenerateReduction(char *premise1, char* conclusion)
 {
-    NAL_GenerateConclusionTerm(premise1, NULL, conclusion, false);
+    NAL_GenerateConclusionTerm(premise1, NULL, conclusion, false, false);
     puts("IN_DEBUG( fputs(\"Reduced: \", stdout); Narsese_PrintTerm(&term1); fputs(\" -> \", stdout); Narsese_PrintTerm(&conclusion); puts(\"\"); ) \nreturn conclusion;\n}");
+    printf("NEXT_%d:;\n", ruleID++);
 }
 
 void NAL_GenerateRuleTable()
 {
+    //collect the root copulas of the rule premises
+    collectingRules = true;
+#define H_NAL_RULES
+#include "NAL.h"
+#undef H_NAL_RULES
+    collectingRules = false;
+    rulesAmount = ruleID;
+    ruleID = 0;
+    roots1Amount = roots2Amount = 1;
+    for(int i=0; i<rulesAmount; i++)
+    {
+        NAL_AddRoot(roots1, &roots1Amount, rules[i].root1);
+        NAL_AddRoot(roots2, &roots2Amount, rules[i].root2);
+    }
+    //generate the rules, dispatched by the root copulas of the premises
     puts("#include \"RuleTable.h\"");
-    puts("void RuleTable_Apply(Term term1, Term term2, Truth truth1, Truth truth2, long conclusionOccurrence, double occurrenceTimeOffset, Stamp conclusionStamp, long currentTime, double parentPriority, double conceptPriority, bool doublePremise, Concept *validation_concept, long validation_cid)\n{\ngoto RULE_0;");
+    puts("void RuleTable_Apply(Term term1, Term term2, Truth truth1, Truth truth2, long conclusionOccurrence, double occurrenceTimeOffset, Stamp conclusionStamp, long currentTime, double parentPriority, double conceptPriority, bool doublePremise, Concept *validation_concept, long validation_cid)\n{");
+    puts("unsigned long long ruleStart = 0;");
+    NAL_GenerateRuleDispatch();
 #define H_NAL_RULES
 #include "NAL.h"
 #undef H_NAL_RULES
@@ -128,27 +293,37 @@ void NAL_GenerateRuleTable()
 #include "NAL.h"
 #undef H_NAL_REDUCTIONS
     printf("RULE_%d:;\nreturn term1;\n}\n\n", ruleID);
+    puts("char *RuleTable_ruleNames[] = {");
+    for(int i=0; i<rulesAmount; i++)
+    {
+        NAL_GenerateRuleName(&rules[i]);
+    }
+    printf("};\nint RuleTable_rulesAmount = %d;\n", rulesAmount);
 }
 
-static int atomsCounter = 1; //allows to avoid memset
-static int atomsAppeared[ATOMS_MAX] = {0};
+THREAD_LOCAL NAL_Derivations *NAL_derivations = NULL;
+
 static bool NAL_AtomAppearsTwice(Term *conclusionTerm)
 {
     if(!ATOM_APPEARS_TWICE_FILTER)
         return false;
     if(Narsese_copulaEquals(conclusionTerm->atoms[0], INHERITANCE) || Narsese_copulaEquals(conclusionTerm->atoms[0], SIMILARITY)) //similarity or inheritance
     {
-        atomsCounter++;
-        for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+        Atom appeared[COMPOUND_TERM_SIZE_MAX]; //the simple atoms seen so far, a term has only a few of them
+        int appearedAmount = 0;
+        for(uint64_t mask = Term_AtomsMask(conclusionTerm); mask; mask &= mask-1)
         {
-            Atom atom = conclusionTerm->atoms[i];
-            if(atomsAppeared[conclusionTerm->atoms[i]] == atomsCounter) //atom already appeared
+            Atom atom = conclusionTerm->atoms[Term_LowestAtom(mask)];
+            for(int j=0; j<appearedAmount; j++)
             {
-                return true;
+                if(appeared[j] == atom) //atom already appeared
+                {
+                    return true;
+                }
             }
             if(Narsese_IsSimpleAtom(atom))
             {
-                atomsAppeared[atom] = atomsCounter;
+                appeared[appearedAmount++] = atom;
             }
         }
     }
@@ -305,7 +480,30 @@ static bool EmptySetOp(Term *conclusionTerm) //to be refined, with atom appears
     return false;
 }
 
-void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conclusionTruth, Stamp stamp, long currentTime, double parentPriority, double conceptPriority, double occurrenceTimeOffset, Concept *validation_concept, long validation_cid, bool varIntro)
+static void NAL_AddDerivedEvent(Event *e, double priority, Concept *validation_concept, long validation_cid, int rule, long currentTime)
+{
+    if(validation_concept == NULL || validation_concept->id == validation_cid) //concept recycling would invalidate the derivation (allows to lock only adding results to memory)
+    {
+        bool accepted = !NAL_AtomAppearsTwice(&e->term) && !NAL_NestedHOLStatement(&e->term) && !NAL_InhOrSimHasDepVar(&e->term) && !NAL_JunctionNotRightNested(&e->term) && !EmptySetOp(&e->term);
+        if(RULE_STATS && rule >= 0)
+        {
+            if(accepted)
+            {
+                Stats_rules[rule].derivations++;
+            }
+            else
+            {
+                Stats_rules[rule].rejections++;
+            }
+        }
+        if(accepted)
+        {
+            Memory_AddEvent(e, currentTime, priority, false, true, false, false);
+        }
+    }
+}
+
+void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conclusionTruth, Stamp stamp, long currentTime, double parentPriority, double conceptPriority, double occurrenceTimeOffset, Concept *validation_concept, long validation_cid, bool varIntro, int rule)
 {
     if(varIntro && (Narsese_copulaEquals(conclusionTerm.atoms[0], TEMPORAL_IMPLICATION) || Narsese_copulaEquals(conclusionTerm.atoms[0], IMPLICATION) || Narsese_copulaEquals(conclusionTerm.atoms[0], EQUIVALENCE)))
     {
@@ -313,13 +511,13 @@ void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conc
         Term conclusionTermWithVarExt = Variable_IntroduceImplicationVariables(conclusionTerm, &success, true);
         if(success && !Term_Equal(&conclusionTermWithVarExt, &conclusionTerm) && !NAL_HOLStatementComponentHasInvalidInhOrSim(&conclusionTermWithVarExt, true))
         {
-            NAL_DerivedEvent(conclusionTermWithVarExt, conclusionOccurrence, conclusionTruth, stamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false);
+            NAL_DerivedEvent(conclusionTermWithVarExt, conclusionOccurrence, conclusionTruth, stamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false, rule);
         }
         bool success2;
         Term conclusionTermWithVarInt = Variable_IntroduceImplicationVariables(conclusionTerm, &success2, false);
         if(success2 && !Term_Equal(&conclusionTermWithVarInt, &conclusionTerm) && !NAL_HOLStatementComponentHasInvalidInhOrSim(&conclusionTermWithVarInt, true))
         {
-            NAL_DerivedEvent(conclusionTermWithVarInt, conclusionOccurrence, conclusionTruth, stamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false);
+            NAL_DerivedEvent(conclusionTermWithVarInt, conclusionOccurrence, conclusionTruth, stamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false, rule);
         }
         if(Narsese_copulaEquals(conclusionTerm.atoms[0], IMPLICATION) || Narsese_copulaEquals(conclusionTerm.atoms[0], EQUIVALENCE))
         {
@@ -332,13 +530,13 @@ void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conc
         Term conclusionTermWithVarExt = Variable_IntroduceConjunctionVariables(conclusionTerm, &success, true);
         if(success && !Term_Equal(&conclusionTermWithVarExt, &conclusionTerm) && !NAL_HOLStatementComponentHasInvalidInhOrSim(&conclusionTermWithVarExt, true))
         {
-            NAL_DerivedEvent(conclusionTermWithVarExt, conclusionOccurrence, conclusionTruth, stamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false);
+            NAL_DerivedEvent(conclusionTermWithVarExt, conclusionOccurrence, conclusionTruth, stamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false, rule);
         }
         bool success2;
         Term conclusionTermWithVarInt = Variable_IntroduceConjunctionVariables(conclusionTerm, &success2, false);
         if(success2 && !Term_Equal(&conclusionTermWithVarInt, &conclusionTerm) && !NAL_HOLStatementComponentHasInvalidInhOrSim(&conclusionTermWithVarInt, true))
         {
-            NAL_DerivedEvent(conclusionTermWithVarInt, conclusionOccurrence, conclusionTruth, stamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false);
+            NAL_DerivedEvent(conclusionTermWithVarInt, conclusionOccurrence, conclusionTruth, stamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, false, rule);
         }
         return;
     }
@@ -349,14 +547,26 @@ void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conc
                 .occurrenceTime = conclusionOccurrence,
                 .occurrenceTimeOffset = occurrenceTimeOffset,
                 .creationTime = currentTime };
-    #pragma omp critical(Memory)
+    double priority = conceptPriority*parentPriority*Truth_Expectation(conclusionTruth);
+    if(NAL_derivations != NULL) //buffered by a worker thread, added to memory after the inference phase
     {
-        if(validation_concept == NULL || validation_concept->id == validation_cid) //concept recycling would invalidate the derivation (allows to lock only adding results to memory)
+        if(NAL_derivations->itemsAmount >= NAL_derivations->itemsMax)
         {
-            if(!NAL_AtomAppearsTwice(&conclusionTerm) && !NAL_NestedHOLStatement(&conclusionTerm) && !NAL_InhOrSimHasDepVar(&conclusionTerm) && !NAL_JunctionNotRightNested(&conclusionTerm) && !EmptySetOp(&conclusionTerm))
-            {
-                Memory_AddEvent(&e, currentTime, conceptPriority*parentPriority*Truth_Expectation(conclusionTruth), false, true, false, false);
-            }
+            NAL_derivations->itemsMax = MAX(64, 2*NAL_derivations->itemsMax);
+            NAL_derivations->items = realloc(NAL_derivations->items, NAL_derivations->itemsMax*sizeof(Derivation));
+            assert(NAL_derivations->items != NULL, "Derivation buffer allocation failed!");
         }
+        NAL_derivations->items[NAL_derivations->itemsAmount++] = (Derivation) { .event = e, .priority = priority, .validation_concept = validation_concept, .validation_cid = validation_cid, .rule = rule };
+        return;
+    }
+    NAL_AddDerivedEvent(&e, priority, validation_concept, validation_cid, rule, currentTime);
+}
+
+void NAL_AddDerivations(NAL_Derivations *derivations, int from, int amount, long currentTime)
+{
+    for(int i=from; i<from+amount; i++)
+    {
+        Derivation *d = &derivations->items[i];
+        NAL_AddDerivedEvent(&d->event, d->priority, d->validation_concept, d->validation_cid, d->rule, currentTime);
     }
 }
@@ -36,13 +36,36 @@
 #include "Stamp.h"
 #include "Narsese.h"
 #include "Memory.h"
+#include "Stats.h"
+
+//Data structure//
+//--------------//
+//Derivations of a worker thread of parallel inference, added to memory after the inference phase
+typedef struct
+{
+    Event event;
+    double priority;
+    Concept *validation_concept;
+    long validation_cid;
+    int rule;
+}Derivation;
+typedef struct
+{
+    Derivation *items; //grows as needed
+    int itemsAmount;
+    int itemsMax;
+}NAL_Derivations;
+//Where NAL_DerivedEvent buffers derivations to, or NULL to add them to memory directly
+extern THREAD_LOCAL NAL_Derivations *NAL_derivations;
 
 //Methods//
 //-------//
 //Generates inference rule code
 void NAL_GenerateRuleTable();
-//Method for the derivation of new events as called by the generated rule table
-void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conclusionTruth, Stamp stamp, long currentTime, double parentPriority, double conceptPriority, double occurrenceTimeOffset, Concept *validation_concept, long validation_cid, bool varIntro);
+//Method for the derivation of new events as called by the generated rule table, rule being the deriving rule's index or -1
+void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conclusionTruth, Stamp stamp, long currentTime, double parentPriority, double conceptPriority, double occurrenceTimeOffset, Concept *validation_concept, long validation_cid, bool varIntro, int rule);
+//Adds amount buffered derivations, starting at index from, to memory
+void NAL_AddDerivations(NAL_Derivations *derivations, int from, int amount, long currentTime);
 //macro for syntactic representation, increases readability, double premise inference
 #define R2(premise1, premise2, _, conclusion, truthFunction)         NAL_GenerateRule(#premise1, #premise2, #conclusion, #truthFunction, true, false, false); NAL_GenerateRule(#premise2, #premise1, #conclusion, #truthFunction, true, true, false);
 #define R2VarIntro(premise1, premise2, _, conclusion, truthFunction) NAL_GenerateRule(#premise1, #premise2, #conclusion, #truthFunction, true, false, true);  NAL_GenerateRule(#premise2, #premise1, #conclusion, #truthFunction, true, true, true);
@@ -24,46 +24,436 @@
 
 #include "NAR.h"
 
-long currentTime = 1;
-static bool initialized = false;
-static int op_k = 0;
+THREAD_LOCAL long currentTime = 1;
+static THREAD_LOCAL bool initialized = false;
+static THREAD_LOCAL int op_k = 0;
+//The state of the selected instance is in the module globals of the thread, the other instances keep theirs
+static THREAD_LOCAL NAR defaultInstance;
+static THREAD_LOCAL NAR *selected = NULL; //the default instance of the thread if NULL
 
-void NAR_INIT()
+static void NAR_SwapState(NAR *nar)
+{
+    Memory_SwapState(&nar->memory);
+    InvertedAtomIndex_SwapState(&nar->invertedAtomIndex);
+    Narsese_SwapState(&nar->narsese);
+    Cycle_SwapState(&nar->cycle);
+    Decision_SwapState(&nar->decision);
+    Event_SwapState(&nar->event);
+    Stats_SwapState(&nar->stats);
+    Truth_SwapState(&nar->truth);
+    Globals_SwapState(&nar->globals);
+    Journal_SwapState(&nar->journal);
+    SWAP_STATE(currentTime, nar->currentTime);
+    SWAP_STATE(initialized, nar->initialized);
+    SWAP_STATE(op_k, nar->op_k);
+}
+
+NAR *NAR_Selected()
+{
+    return selected == NULL ? &defaultInstance : selected;
+}
+
+void NAR_Select(NAR *nar)
+{
+    nar = nar == NULL ? &defaultInstance : nar;
+    NAR *previous = NAR_Selected();
+    if(nar != previous)
+    {
+        NAR_SwapState(previous); //the selected instance takes its state from the globals
+        NAR_SwapState(nar); //which then take the state of the instance
+        selected = nar;
+    }
+}
+
+NAR *NAR_New(Memory_Config config)
+{
+    NAR *nar = calloc(1, sizeof(NAR));
+    assert(nar != NULL, "Allocation of NAR instance failed!");
+    nar->memory = MEMORY_STATE_INITIAL;
+    nar->invertedAtomIndex = (InvertedAtomIndex_State) {0};
+    nar->narsese = (Narsese_State) {0};
+    nar->cycle = CYCLE_STATE_INITIAL;
+    nar->decision = DECISION_STATE_INITIAL;
+    nar->event = EVENT_STATE_INITIAL;
+    nar->stats = STATS_STATE_INITIAL;
+    nar->truth = TRUTH_STATE_INITIAL;
+    nar->globals = GLOBALS_STATE_INITIAL;
+    nar->journal = (Journal_State) {0};
+    nar->currentTime = 1;
+    nar->initialized = false;
+    nar->op_k = 0;
+    pthread_mutex_init(&nar->lock, NULL);
+    NAR *previous = NAR_Selected();
+    NAR_Select(nar);
+    NAR_INIT_Config(config);
+    NAR_Select(previous);
+    return nar;
+}
+
+void NAR_Delete(NAR *nar)
+{
+    assert(nar != &defaultInstance, "The default instance can't be deleted!");
+    NAR *previous = NAR_Selected() == nar ? &defaultInstance : NAR_Selected();
+    NAR_Select(nar);
+    Journal_Close();
+    Memory_Free();
+    NAR_Select(previous);
+    pthread_mutex_destroy(&nar->lock);
+    free(nar);
+}
+
+void NAR_Acquire(NAR *nar)
+{
+    assert(nar != NULL, "Only instances of NAR_New can be acquired, the default instance is the one of the thread!");
+    pthread_mutex_lock(&nar->lock);
+    NAR_Select(nar);
+}
+
+void NAR_Release()
+{
+    NAR *nar = NAR_Selected();
+    assert(nar != &defaultInstance, "No instance was acquired!");
+    NAR_Select(NULL); //the instance takes its state from the globals of this thread, so that another thread can select it
+    pthread_mutex_unlock(&nar->lock);
+}
+
+NAR *NAR_Share()
 {
+    NAR *nar = NAR_Selected();
+    NAR_SwapState(nar); //the instance holds the state during the parallel region, this thread is bound to it like the workers
+    return nar;
+}
+
+void NAR_Unshare(NAR *nar)
+{
+    NAR_SwapState(nar);
+}
+
+//Copy the state of the modules, the lock stays with the instance it belongs to
+static void NAR_CopyState(NAR *to, NAR *from)
+{
+    to->memory = from->memory;
+    to->invertedAtomIndex = from->invertedAtomIndex;
+    to->narsese = from->narsese;
+    to->cycle = from->cycle;
+    to->decision = from->decision;
+    to->event = from->event;
+    to->stats = from->stats;
+    to->truth = from->truth;
+    to->globals = from->globals;
+    to->journal = from->journal;
+    to->currentTime = from->currentTime;
+    to->initialized = from->initialized;
+    to->op_k = from->op_k;
+}
+
+void NAR_Bind(NAR *binding, NAR *shared)
+{
+    NAR_CopyState(binding, shared); //a copy, as the workers only change the storage the pointers of the state refer to
+    NAR_SwapState(binding);
+}
+
+void NAR_Unbind(NAR *binding)
+{
+    NAR_SwapState(binding);
+}
+
+//Snapshot file: the header, the state of the modules, and the memory arena with its pointers as offsets
+#define NAR_SNAPSHOT_HEADER ((NAR_SnapshotHeader) { .magic = "ONASNAP", .version = NAR_SNAPSHOT_VERSION, .byteOrder = NAR_SNAPSHOT_BYTE_ORDER, \
+                                                    .layout = { sizeof(NAR_Snapshot), sizeof(Concept), sizeof(Event), sizeof(Table), sizeof(HashTableSlot), sizeof(ConceptPosting), sizeof(void*), ATOMIC_TERM_LEN_MAX } })
+
+static NAR_SnapshotHashTable NAR_SnapshotHashTableOf(HashTable *ht)
+{
+    return (NAR_SnapshotHashTable) { .itemsAmount = ht->itemsAmount, .freeSlots = ht->freeSlots };
+}
+
+//Take the amounts and counters of the state the instance holds
+static NAR_Snapshot NAR_SnapshotOf(NAR *nar)
+{
+    NAR_Snapshot snapshot = {0};
+    snapshot.memoryConfig = nar->memory.memoryConfig;
+    snapshot.conceptsAmount = nar->memory.concepts.itemsAmount;
+    snapshot.cyclingBeliefEventsAmount = nar->memory.cycling_belief_events.itemsAmount;
+    snapshot.cyclingGoalEventsAmount = nar->memory.cycling_goal_events.itemsAmount;
+    snapshot.HTconcepts = NAR_SnapshotHashTableOf(&nar->memory.HTconcepts);
+    snapshot.HTcycling_belief_events = NAR_SnapshotHashTableOf(&nar->memory.HTcycling_belief_events);
+    snapshot.HTcycling_goal_events = NAR_SnapshotHashTableOf(&nar->memory.HTcycling_goal_events);
+    snapshot.HTatoms = NAR_SnapshotHashTableOf(&nar->narsese.HTatoms);
+    for(int i=0; i<OPERATIONS_MAX; i++)
+    {
+        snapshot.operations[i] = nar->memory.operations[i];
+        snapshot.operations[i].action = NULL;
+    }
+    snapshot.LAZY_FORGETTING = nar->memory.LAZY_FORGETTING;
+    snapshot.preconditionTablesFree = nar->memory.precondition_table_stack.stackpointer;
+    memcpy(snapshot.operation_conceptsAmount, nar->memory.operation_conceptsAmount, sizeof(snapshot.operation_conceptsAmount));
+    snapshot.conceptPriorityThreshold = nar->memory.conceptPriorityThreshold;
+    snapshot.concept_id = nar->memory.concept_id;
+    snapshot.postingsUsed = nar->invertedAtomIndex.postingsUsed;
+    snapshot.term_index = nar->narsese.term_index;
+    snapshot.conceptProcessID = nar->cycle.conceptProcessID;
+    snapshot.usefulnessUpdateIndex = nar->cycle.usefulnessUpdateIndex;
+    snapshot.decision = nar->decision;
+    snapshot.decision.preconditionCandidates = NULL;
+    snapshot.decision.anticipating_concepts = NULL;
+    snapshot.event = nar->event;
+    snapshot.stats = nar->stats; //the average amount of matched concepts is also used for control
+    snapshot.stats.Stats_rules = NULL;
+    snapshot.truth = nar->truth;
+    snapshot.globals = nar->globals;
+    snapshot.currentTime = nar->currentTime;
+    snapshot.op_k = nar->op_k;
+    return snapshot;
+}
+
+bool NAR_Save(char *path)
+{
+    assert(initialized, "NAR not initialized yet, call NAR_INIT first!");
+    FILE *file = fopen(path, "wb");
+    if(file == NULL)
+    {
+        return false;
+    }
+    NAR_SnapshotHeader header = NAR_SNAPSHOT_HEADER;
+    NAR *nar = NAR_Share(); //the instance holds the state while it's written
+    NAR_Snapshot snapshot = NAR_SnapshotOf(nar);
+    //the scratch storage of the last cycle would be written with pointers
+    memset(nar->cycle.relatedConcepts, 0, snapshot.memoryConfig.conceptsMax * sizeof(ConceptPosting));
+    memset(nar->decision.preconditionCandidates, 0, snapshot.memoryConfig.conceptsMax * sizeof(Concept*));
+    memset(nar->decision.anticipating_concepts, 0, snapshot.memoryConfig.preconditionTablesMax * sizeof(Concept*));
+    NAR_Unshare(nar);
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(&snapshot, sizeof(NAR_Snapshot), 1, file) == 1;
+    success = success && Memory_WriteArena(file);
+    success = fclose(file) == 0 && success;
+    if(success)
+    {
+        Journal_RecordSnapshot(path); //recovery can start from it
+    }
+    return success;
+}
+
+static bool NAR_SnapshotHashTableValid(NAR_SnapshotHashTable *ht, int buckets)
+{
+    return ht->itemsAmount >= 0 && ht->itemsAmount <= buckets && ht->freeSlots >= 0 && ht->freeSlots <= buckets;
+}
+
+//Whether the amounts and counters are within the capacities, before any of them is used
+static bool NAR_SnapshotValid(NAR_Snapshot *snapshot)
+{
+    Memory_Config config = snapshot->memoryConfig;
+    if(!Memory_ConfigValid(config))
+    {
+        return false;
+    }
+    bool valid = snapshot->conceptsAmount >= 0 && snapshot->conceptsAmount <= config.conceptsMax &&
+                 snapshot->cyclingBeliefEventsAmount >= 0 && snapshot->cyclingBeliefEventsAmount <= config.cyclingBeliefEventsMax &&
+                 snapshot->cyclingGoalEventsAmount >= 0 && snapshot->cyclingGoalEventsAmount <= config.cyclingGoalEventsMax &&
+                 NAR_SnapshotHashTableValid(&snapshot->HTconcepts, HASHTABLE_BUCKETS_PER_ITEM*config.conceptsMax) &&
+                 NAR_SnapshotHashTableValid(&snapshot->HTcycling_belief_events, HASHTABLE_BUCKETS_PER_ITEM*config.cyclingBeliefEventsMax) &&
+                 NAR_SnapshotHashTableValid(&snapshot->HTcycling_goal_events, HASHTABLE_BUCKETS_PER_ITEM*config.cyclingGoalEventsMax) &&
+                 NAR_SnapshotHashTableValid(&snapshot->HTatoms, HASHTABLE_BUCKETS_PER_ITEM*config.atomsMax) &&
+                 snapshot->preconditionTablesFree >= 0 && snapshot->preconditionTablesFree <= config.preconditionTablesMax &&
+                 snapshot->postingsUsed >= 0 && snapshot->postingsUsed <= POSTINGS_PER_CONCEPT*config.conceptsMax &&
+                 snapshot->term_index >= 0 && snapshot->term_index <= config.atomsMax &&
+                 snapshot->usefulnessUpdateIndex >= 0 && snapshot->usefulnessUpdateIndex < config.conceptsMax &&
+                 snapshot->op_k >= 0 && snapshot->op_k <= OPERATIONS_MAX;
+    for(int opi=0; opi<=OPERATIONS_MAX; opi++)
+    {
+        valid = valid && snapshot->operation_conceptsAmount[opi] >= 0 && snapshot->operation_conceptsAmount[opi] <= config.preconditionTablesMax;
+    }
+    for(int i=0; i<OPERATIONS_MAX; i++)
+    {
+        valid = valid && snapshot->operations[i].term.atoms[0] <= config.atomsMax; //its name is looked up
+    }
+    return valid;
+}
+
+//Take the amounts and counters over from the saved state, the pointers of the initialized memory stay
+static void NAR_RestoreState(NAR_Snapshot *saved)
+{
+    NAR *live = NAR_Share();
+    live->memory.concepts.itemsAmount = saved->conceptsAmount;
+    live->memory.cycling_belief_events.itemsAmount = saved->cyclingBeliefEventsAmount;
+    live->memory.cycling_goal_events.itemsAmount = saved->cyclingGoalEventsAmount;
+    live->memory.HTconcepts.itemsAmount = saved->HTconcepts.itemsAmount;
+    live->memory.HTconcepts.freeSlots = saved->HTconcepts.freeSlots;
+    live->memory.HTcycling_belief_events.itemsAmount = saved->HTcycling_belief_events.itemsAmount;
+    live->memory.HTcycling_belief_events.freeSlots = saved->HTcycling_belief_events.freeSlots;
+    live->memory.HTcycling_goal_events.itemsAmount = saved->HTcycling_goal_events.itemsAmount;
+    live->memory.HTcycling_goal_events.freeSlots = saved->HTcycling_goal_events.freeSlots;
+    memcpy(live->memory.operations, saved->operations, sizeof(live->memory.operations));
+    live->memory.LAZY_FORGETTING = saved->LAZY_FORGETTING;
+    live->memory.precondition_table_stack.stackpointer = saved->preconditionTablesFree;
+    memcpy(live->memory.operation_conceptsAmount, saved->operation_conceptsAmount, sizeof(live->memory.operation_conceptsAmount));
+    live->memory.conceptPriorityThreshold = saved->conceptPriorityThreshold;
+    live->memory.concept_id = saved->concept_id;
+    live->invertedAtomIndex.postingsUsed = saved->postingsUsed;
+    live->narsese.HTatoms.itemsAmount = saved->HTatoms.itemsAmount;
+    live->narsese.HTatoms.freeSlots = saved->HTatoms.freeSlots;
+    live->narsese.term_index = saved->term_index;
+    live->cycle.conceptProcessID = saved->conceptProcessID;
+    live->cycle.usefulnessUpdateIndex = saved->usefulnessUpdateIndex;
+    Decision_State decision = live->decision;
+    live->decision = saved->decision;
+    live->decision.preconditionCandidates = decision.preconditionCandidates;
+    live->decision.anticipating_concepts = decision.anticipating_concepts;
+    live->event = saved->event;
+    RuleStats *rules = live->stats.Stats_rules;
+    live->stats = saved->stats;
+    live->stats.Stats_rules = rules;
+    live->truth = saved->truth;
+    live->globals = saved->globals;
+    live->currentTime = saved->currentTime;
+    live->op_k = saved->op_k;
+    NAR_Unshare(live);
+}
+
+//Whether the snapshot was saved by a build of the same version, byte order and layout, which the state can be loaded into
+static bool NAR_SnapshotCompatible(NAR_SnapshotHeader *header)
+{
+    NAR_SnapshotHeader expected = NAR_SNAPSHOT_HEADER;
+    return !memcmp(header->magic, expected.magic, sizeof(expected.magic)) && header->version == expected.version &&
+           header->byteOrder == expected.byteOrder && !memcmp(header->layout, expected.layout, sizeof(expected.layout));
+}
+
+//Whether the rest of the file is an arena of the capacities, so that a corrupted config doesn't allocate one which is not in the file
+static bool NAR_SnapshotArenaFits(FILE *file, Memory_Config config)
+{
+    long position = ftell(file);
+    if(position < 0 || fseek(file, 0, SEEK_END) != 0)
+    {
+        return false;
+    }
+    long end = ftell(file);
+    return fseek(file, position, SEEK_SET) == 0 && end >= position && (size_t) (end - position) == Memory_ArenaSize(config);
+}
+
+static bool NAR_LoadSnapshot(char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if(file == NULL)
+    {
+        return false;
+    }
+    NAR_SnapshotHeader header;
+    NAR_Snapshot snapshot;
+    if(fread(&header, sizeof(header), 1, file) != 1 || !NAR_SnapshotCompatible(&header) || fread(&snapshot, sizeof(NAR_Snapshot), 1, file) != 1 ||
+       !NAR_SnapshotValid(&snapshot) || !NAR_SnapshotArenaFits(file, snapshot.memoryConfig))
+    {
+        fclose(file);
+        return false;
+    }
+    //procedures can't be saved, so the ones of the registered operations are kept by name
+    char names[OPERATIONS_MAX][ATOMIC_TERM_LEN_MAX] = {0};
+    Action actions[OPERATIONS_MAX] = {0};
+    for(int i=0; initialized && i<OPERATIONS_MAX && operations[i].term.atoms[0]; i++)
+    {
+        strcpy(names[i], Narsese_atomNames[operations[i].term.atoms[0]-1]);
+        actions[i] = operations[i].action;
+    }
+    NAR_INIT_Config(snapshot.memoryConfig); //the arena has the same layout with the same capacities
+    bool success = Memory_ReadArena(file);
+    fclose(file);
+    if(!success)
+    {
+        NAR_INIT();
+        return false;
+    }
+    NAR_RestoreState(&snapshot);
+    for(int i=0; i<OPERATIONS_MAX; i++)
+    {
+        operations[i].action = NULL;
+        for(int j=0; operations[i].term.atoms[0] && j<OPERATIONS_MAX; j++)
+        {
+            if(!strcmp(names[j], Narsese_atomNames[operations[i].term.atoms[0]-1]))
+            {
+                operations[i].action = actions[j];
+            }
+        }
+    }
+    return true;
+}
+
+bool NAR_Load(char *path)
+{
+    if(Journal_Enter())
+    {
+        Journal_RecordString(JOURNAL_LOAD, path);
+    }
+    bool success = NAR_LoadSnapshot(path);
+    Journal_Leave();
+    return success;
+}
+
+void NAR_INIT_Config(Memory_Config config)
+{
+    if(Journal_Enter())
+    {
+        Journal_Record(JOURNAL_INIT, &config, sizeof(Memory_Config));
+    }
     assert(pow(TRUTH_PROJECTION_DECAY_INITIAL,EVENT_BELIEF_DISTANCE) >= MIN_CONFIDENCE, "Bad params, increase projection decay or decrease event belief distance!");
+    Memory_INIT(config); //clear data structures, allocating them for the capacities
     Decision_INIT();
-    Memory_INIT(); //clear data structures
+    Cycle_INIT();
+    Stats_INIT();
     Event_INIT(); //reset base id counter
     Narsese_INIT();
     currentTime = 1; //reset time
     initialized = true;
     op_k = 0;
+    Journal_Leave();
+}
+
+void NAR_INIT()
+{
+    NAR_INIT_Config(initialized ? memoryConfig : MEMORY_CONFIG_DEFAULT);
 }
 
 void NAR_Cycles(int cycles)
 {
     assert(initialized, "NAR not initialized yet, call NAR_INIT first!");
+    if(Journal_Enter())
+    {
+        Journal_Record(JOURNAL_CYCLES, &cycles, sizeof(int));
+    }
     for(int i=0; i<cycles; i++)
     {
         IN_DEBUG( puts("\nNew system cycle:\n----------"); )
         Cycle_Perform(currentTime);
         currentTime++;
     }
+    Journal_Leave();
 }
 
-Event NAR_AddInput(Term term, char type, Truth truth, bool eternal, double occurrenceTimeOffset)
+//Adds the input, echo is whether it's printed
+static Event NAR_AddInputEchoed(Term term, char type, Truth truth, bool eternal, double occurrenceTimeOffset, bool echo)
 {
     assert(initialized, "NAR not initialized yet, call NAR_INIT first!");
+    if(Journal_Enter())
+    {
+        Journal_RecordInput(&term, type, truth, eternal, occurrenceTimeOffset);
+    }
     Event ev = Event_InputEvent(term, type, truth, occurrenceTimeOffset, currentTime);
     if(eternal)
     {
         ev.occurrenceTime = OCCURRENCE_ETERNAL;
     }
-    Memory_AddInputEvent(&ev, currentTime);
+    Memory_AddInputEvent(&ev, currentTime, echo);
     NAR_Cycles(1);
+    Journal_Leave();
     return ev;
 }
 
+Event NAR_AddInput(Term term, char type, Truth truth, bool eternal, double occurrenceTimeOffset)
+{
+    return NAR_AddInputEchoed(term, type, truth, eternal, occurrenceTimeOffset, true);
+}
+
+Event NAR_AddInputEternalBelief(Term term, Truth truth, bool echo)
+{
+    return NAR_AddInputEchoed(term, EVENT_TYPE_BELIEF, truth, true, 0, echo);
+}
+
 Event NAR_AddInputBelief(Term term)
 {
     Event ret = NAR_AddInput(term, EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false, 0);
@@ -79,6 +469,10 @@ void NAR_AddOperation(char *term_name, Action procedure)
 {
     assert(procedure != 0, "Cannot add an operation with null-procedure");
     assert(initialized, "NAR not initialized yet, call NAR_INIT first!");
+    if(Journal_Enter())
+    {
+        Journal_RecordString(JOURNAL_OPERATION, term_name);
+    }
     Term term = Narsese_AtomicTerm(term_name);
     assert(term_name[0] == '^', "This atom does not belong to an operator!");
     //check if term already exists
@@ -92,123 +486,269 @@ void NAR_AddOperation(char *term_name, Action procedure)
         op_k++;
     }
     operations[use_k-1] = (Operation) { .term = term, .action = procedure };
+    Journal_Leave();
 }
 
-void NAR_AddInputNarsese(char *narsese_sentence)
+//The question state during the sweep over the concepts
+typedef struct
 {
-    Term term;
-    Truth tv;
-    char punctuation;
-    int tense;
-    double occurrenceTimeOffset;
-    Narsese_Sentence(narsese_sentence, &term, &punctuation, &tense, &tv, &occurrenceTimeOffset);
-#if STAGE==2
-    //apply reduction rules to term:
-    term = RuleTable_Reduce(term);
-#endif    
-    if(punctuation == '?')
+    Term toCompare; //the predicate of an implication, or if it's not an implication, the term
+    bool isImplication;
+    Concept *ownConcept; //the only concept which can answer a question without query variable
+    ConceptPosting *postings; //else the concepts containing its rarest atom, or all concepts if NULL
+    int candidates;
+    Truth truthProjected;
+    int answerPosition; //queue position of the concept of the answer, -1 if none, which resolves ties independent of the order the candidates are visited in
+    bool visited;
+}QuestionCandidates;
+static THREAD_LOCAL QuestionCandidates questionCandidates[QUESTIONS_MAX];
+
+//Ties are resolved as by a scan over the concepts in their queue order: an equally expected eternal belief or implication of a later concept is taken,
+//while an equally expected event of the same time is only taken from an earlier concept
+static void NAR_ConsiderAnswer(Concept *c, Term *question, int tense, QuestionCandidates *q, Answer *answer)
+{
+    if(!Variable_Unify2(&q->toCompare, &c->term, true).success)
     {
-        //answer questions:
-        Truth best_truth = { .frequency = 0.0, .confidence = 1.0 };
-        Truth best_truth_projected = {0};
-        Term best_term = {0};
-        long answerOccurrenceTime = OCCURRENCE_ETERNAL;
-        long answerCreationTime = 0;
-        bool isImplication = Narsese_copulaEquals(term.atoms[0], TEMPORAL_IMPLICATION);
-        fputs("Input: ", stdout);
-        Narsese_PrintTerm(&term);
-        fputs("?", stdout);
-        puts(tense == 1 ? " :|:" : (tense == 2 ? " :\\:" : (tense == 3 ? " :/:" : ""))); 
-        fflush(stdout);
-        for(int i=0; i<concepts.itemsAmount; i++)
-        {
-            Concept *c = concepts.items[i].address;
-            //compare the predicate of implication, or if it's not an implication, the term
-            Term toCompare = isImplication ? Term_ExtractSubterm(&term, 2) : term; 
-            if(!Variable_Unify2(&toCompare, &c->term, true).success)
-            {
-                goto Continue;
-            }
-            if(isImplication)
-            {
-                for(int op_k = 0; op_k<OPERATIONS_MAX; op_k++)
-                {
-                    for(int j=0; j<c->precondition_beliefs[op_k].itemsAmount; j++)
-                    {
-                        Implication *imp = &c->precondition_beliefs[op_k].array[j];
-                        if(!Variable_Unify2(&term, &imp->term, true).success)
-                        {
-                            continue;
-                        }
-                        if(Truth_Expectation(imp->truth) >= Truth_Expectation(best_truth))
-                        {
-                            best_truth = imp->truth;
-                            best_term = imp->term;
-                            answerCreationTime = imp->creationTime;
-                        }
-                    }
-                }
-            }
-            else
-            if(tense)
+        return;
+    }
+    if(q->isImplication)
+    {
+        for(int op_k = 0; op_k<OPERATIONS_MAX; op_k++)
+        {
+            Table *table = c->precondition_beliefs[op_k];
+            for(int j=0; table != NULL && j<table->itemsAmount; j++)
             {
-                if(c->belief_spike.type != EVENT_TYPE_DELETED && (tense == 1 || tense == 2))
+                Implication *imp = &table->array[j];
+                if(!Variable_Unify2(question, &imp->term, true).success)
                 {
-                    Truth potential_best_truth = Truth_Projection(c->belief_spike.truth, c->belief_spike.occurrenceTime, currentTime);
-                    if( Truth_Expectation(potential_best_truth) >  Truth_Expectation(best_truth_projected) || //look at occcurrence time in case it's too far away to make a numerical distinction after truth projection:
-                       (Truth_Expectation(potential_best_truth) == Truth_Expectation(best_truth_projected) && c->belief_spike.occurrenceTime > answerOccurrenceTime))
-                    {
-                        best_truth_projected = potential_best_truth;
-                        best_truth = c->belief_spike.truth;
-                        best_term = c->belief_spike.term;
-                        answerOccurrenceTime = c->belief_spike.occurrenceTime;
-                        answerCreationTime = c->belief_spike.creationTime;
-                    }
+                    continue;
                 }
-                if(c->predicted_belief.type != EVENT_TYPE_DELETED && (tense == 1 || tense == 3))
+                if(Truth_Expectation(imp->truth) > Truth_Expectation(answer->truth) ||
+                  (Truth_Expectation(imp->truth) == Truth_Expectation(answer->truth) && c->queuePosition >= q->answerPosition))
                 {
-                    Truth potential_best_truth = Truth_Projection(c->predicted_belief.truth, c->predicted_belief.occurrenceTime, currentTime);
-                    if( Truth_Expectation(potential_best_truth) >  Truth_Expectation(best_truth_projected) || //look at occcurrence time in case it's too far away to make a numerical distinction after truth projection:
-                       (Truth_Expectation(potential_best_truth) == Truth_Expectation(best_truth_projected) && c->predicted_belief.occurrenceTime > answerOccurrenceTime))
-                    {
-                        best_truth_projected = potential_best_truth;
-                        best_truth = c->predicted_belief.truth;
-                        best_term = c->predicted_belief.term;
-                        answerOccurrenceTime = c->predicted_belief.occurrenceTime;
-                        answerCreationTime = c->predicted_belief.creationTime;
-                    }
+                    answer->truth = imp->truth;
+                    answer->term = imp->term;
+                    answer->creationTime = imp->creationTime;
+                    q->answerPosition = c->queuePosition;
                 }
             }
-            else
+        }
+    }
+    else
+    if(tense)
+    {
+        if(c->belief_spike.type != EVENT_TYPE_DELETED && (tense == 1 || tense == 2))
+        {
+            Truth potential_best_truth = Truth_Projection(c->belief_spike.truth, c->belief_spike.occurrenceTime, currentTime);
+            if( Truth_Expectation(potential_best_truth) >  Truth_Expectation(q->truthProjected) || //look at occcurrence time in case it's too far away to make a numerical distinction after truth projection:
+               (Truth_Expectation(potential_best_truth) == Truth_Expectation(q->truthProjected) && (c->belief_spike.occurrenceTime > answer->occurrenceTime ||
+               (c->belief_spike.occurrenceTime == answer->occurrenceTime && c->queuePosition < q->answerPosition))))
             {
-                if(c->belief.type != EVENT_TYPE_DELETED && Truth_Expectation(c->belief.truth) >= Truth_Expectation(best_truth))
-                {
-                    best_truth = c->belief.truth;
-                    best_term = c->belief.term;
-                    answerCreationTime = c->belief.creationTime;
-                }
+                q->truthProjected = potential_best_truth;
+                answer->truth = c->belief_spike.truth;
+                answer->term = c->belief_spike.term;
+                answer->occurrenceTime = c->belief_spike.occurrenceTime;
+                answer->creationTime = c->belief_spike.creationTime;
+                q->answerPosition = c->queuePosition;
             }
-            Continue:;
         }
-        fputs("Answer: ", stdout);
-        if(best_truth.confidence == 1.0)
+        if(c->predicted_belief.type != EVENT_TYPE_DELETED && (tense == 1 || tense == 3))
         {
-            puts("None.");
+            Truth potential_best_truth = Truth_Projection(c->predicted_belief.truth, c->predicted_belief.occurrenceTime, currentTime);
+            if( Truth_Expectation(potential_best_truth) >  Truth_Expectation(q->truthProjected) || //look at occcurrence time in case it's too far away to make a numerical distinction after truth projection:
+               (Truth_Expectation(potential_best_truth) == Truth_Expectation(q->truthProjected) && (c->predicted_belief.occurrenceTime > answer->occurrenceTime ||
+               (c->predicted_belief.occurrenceTime == answer->occurrenceTime && c->queuePosition < q->answerPosition))))
+            {
+                q->truthProjected = potential_best_truth;
+                answer->truth = c->predicted_belief.truth;
+                answer->term = c->predicted_belief.term;
+                answer->occurrenceTime = c->predicted_belief.occurrenceTime;
+                answer->creationTime = c->predicted_belief.creationTime;
+                q->answerPosition = c->queuePosition;
+            }
+        }
+    }
+    else
+    {
+        if(c->belief.type != EVENT_TYPE_DELETED && (Truth_Expectation(c->belief.truth) > Truth_Expectation(answer->truth) ||
+          (Truth_Expectation(c->belief.truth) == Truth_Expectation(answer->truth) && c->queuePosition >= q->answerPosition)))
+        {
+            answer->truth = c->belief.truth;
+            answer->term = c->belief.term;
+            answer->creationTime = c->belief.creationTime;
+            q->answerPosition = c->queuePosition;
+        }
+    }
+}
+
+void NAR_AnswerQuestions(Term *questions, int *tenses, int amount, Answer *answers)
+{
+    assert(amount <= QUESTIONS_MAX, "Too many questions in one batch, increase QUESTIONS_MAX!");
+    for(int i=0; i<amount; i++)
+    {
+        QuestionCandidates *q = &questionCandidates[i];
+        answers[i] = (Answer) { .truth = { .frequency = 0.0, .confidence = 1.0 }, .occurrenceTime = OCCURRENCE_ETERNAL };
+        q->isImplication = Narsese_copulaEquals(questions[i].atoms[0], TEMPORAL_IMPLICATION);
+        q->toCompare = q->isImplication ? Term_ExtractSubterm(&questions[i], 2) : questions[i];
+        q->ownConcept = NULL;
+        q->postings = NULL;
+        q->candidates = concepts.itemsAmount;
+        q->truthProjected = (Truth) {0};
+        q->answerPosition = -1;
+        q->visited = false;
+        if(!Variable_hasVariable(&q->toCompare, false, false, true))
+        {
+            q->ownConcept = Memory_FindConceptByTerm(&q->toCompare);
+            q->candidates = q->ownConcept != NULL;
         }
         else
         {
-            Narsese_PrintTerm(&best_term);
-            if(answerOccurrenceTime == OCCURRENCE_ETERNAL)
-            {
-                printf(". creationTime=%ld ", answerCreationTime);
-            }
-            else
+            int size;
+            q->postings = InvertedAtomIndex_GetRarestPostings(&q->toCompare, &size);
+            q->candidates = q->postings != NULL ? size : concepts.itemsAmount;
+        }
+    }
+    //visit the candidates of each question once, together with the later questions which have the same candidates
+    for(int i=0; i<amount; i++)
+    {
+        QuestionCandidates *q = &questionCandidates[i];
+        if(q->visited)
+        {
+            continue;
+        }
+        for(int k=0; k<q->candidates; k++)
+        {
+            Concept *c = q->ownConcept != NULL ? q->ownConcept : (q->postings != NULL ? q->postings[k].c : concepts.items[k].address);
+            for(int j=i; j<amount; j++)
             {
-                printf(". :|: occurrenceTime=%ld creationTime=%ld ", answerOccurrenceTime, answerCreationTime);
+                QuestionCandidates *q2 = &questionCandidates[j];
+                if(!q2->visited && q2->ownConcept == q->ownConcept && q2->postings == q->postings && q2->candidates == q->candidates)
+                {
+                    NAR_ConsiderAnswer(c, &questions[j], tenses[j], q2, &answers[j]);
+                }
             }
-            Truth_Print(&best_truth);
         }
-        fflush(stdout);
+        for(int j=i; j<amount; j++)
+        {
+            QuestionCandidates *q2 = &questionCandidates[j];
+            q2->visited = q2->visited || (q2->ownConcept == q->ownConcept && q2->postings == q->postings && q2->candidates == q->candidates);
+        }
+    }
+    for(int i=0; i<amount; i++)
+    {
+        answers[i].answered = answers[i].truth.confidence != 1.0;
+        if(!answers[i].answered)
+        {
+            answers[i].truth = (Truth) {0};
+        }
+    }
+}
+
+static void NAR_PrintQuestion(Term *question, int tense)
+{
+    if(Journal_Replaying())
+    {
+        return;
+    }
+    fputs("Input: ", stdout);
+    Narsese_PrintTerm(question);
+    fputs("?", stdout);
+    puts(tense == 1 ? " :|:" : (tense == 2 ? " :\\:" : (tense == 3 ? " :/:" : "")));
+    fflush(stdout);
+}
+
+void NAR_PrintAnswer(Answer *answer)
+{
+    if(Journal_Replaying())
+    {
+        return;
+    }
+    fputs("Answer: ", stdout);
+    if(!answer->answered)
+    {
+        puts("None.");
+    }
+    else
+    {
+        Narsese_PrintTerm(&answer->term);
+        if(answer->occurrenceTime == OCCURRENCE_ETERNAL)
+        {
+            printf(". creationTime=%ld ", answer->creationTime);
+        }
+        else
+        {
+            printf(". :|: occurrenceTime=%ld creationTime=%ld ", answer->occurrenceTime, answer->creationTime);
+        }
+        Truth_Print(&answer->truth);
+    }
+    fflush(stdout);
+}
+
+void NAR_AddInputNarseseQuestions(char *narsese_questions)
+{
+    if(Journal_Enter())
+    {
+        Journal_RecordString(JOURNAL_QUESTIONS, narsese_questions);
+    }
+    Term questions[QUESTIONS_MAX];
+    int tenses[QUESTIONS_MAX];
+    Answer answers[QUESTIONS_MAX];
+    int amount = 0;
+    int len = strlen(narsese_questions);
+    for(int start=0; start<len; )
+    {
+        //a question ends at its question mark, which unlike a query variable is not followed by its name, and the tense after it
+        int end = start;
+        for(; end<len && !(narsese_questions[end] == '?' && !isalnum(narsese_questions[end+1])); end++);
+        if(end == len)
+        {
+            assert(strspn(&narsese_questions[start], " ") == (size_t) (len - start), "Parsing error: Questions have to end with a question mark!");
+            break;
+        }
+        end++;
+        int tenseStart = end + strspn(&narsese_questions[end], " ");
+        if(!strncmp(&narsese_questions[tenseStart], ":|:", 3) || !strncmp(&narsese_questions[tenseStart], ":\\:", 3) || !strncmp(&narsese_questions[tenseStart], ":/:", 3))
+        {
+            end = tenseStart + 3;
+        }
+        assert(amount < QUESTIONS_MAX, "Too many questions in one batch, increase QUESTIONS_MAX!");
+        char narsese_sentence[NARSESE_LEN_MAX] = {0};
+        int sentenceStart = start + strspn(&narsese_questions[start], " ");
+        assert(end - sentenceStart < NARSESE_LEN_MAX, "Parsing error: Narsese string too long!");
+        memcpy(narsese_sentence, &narsese_questions[sentenceStart], end - sentenceStart);
+        Truth tv;
+        char punctuation;
+        double occurrenceTimeOffset;
+        Narsese_Sentence(narsese_sentence, &questions[amount], &punctuation, &tenses[amount], &tv, &occurrenceTimeOffset);
+#if STAGE==2
+        //apply reduction rules to term:
+        questions[amount] = RuleTable_Reduce(questions[amount]);
+#endif
+        amount++;
+        start = end;
+    }
+    NAR_AnswerQuestions(questions, tenses, amount, answers);
+    for(int i=0; i<amount; i++)
+    {
+        NAR_PrintQuestion(&questions[i], tenses[i]);
+        NAR_PrintAnswer(&answers[i]);
+    }
+    Journal_Leave();
+}
+
+static void NAR_AddInputSentence(Term term, char punctuation, int tense, Truth tv, double occurrenceTimeOffset)
+{
+#if STAGE==2
+    //apply reduction rules to term:
+    term = RuleTable_Reduce(term);
+#endif    
+    if(punctuation == '?')
+    {
+        //answer questions:
+        NAR_PrintQuestion(&term, tense);
+        Answer answer;
+        NAR_AnswerQuestions(&term, &tense, 1, &answer);
+        NAR_PrintAnswer(&answer);
     }
     //input beliefs and goals
     else
@@ -226,3 +766,44 @@ void NAR_AddInputNarsese(char *narsese_sentence)
     }
 }
 
+void NAR_AddInputNarsese(char *narsese_sentence)
+{
+    if(Journal_Enter())
+    {
+        Journal_RecordString(JOURNAL_NARSESE, narsese_sentence);
+    }
+    Term term;
+    Truth tv;
+    char punctuation;
+    int tense;
+    double occurrenceTimeOffset;
+    Narsese_Sentence(narsese_sentence, &term, &punctuation, &tense, &tv, &occurrenceTimeOffset);
+    NAR_AddInputSentence(term, punctuation, tense, tv, occurrenceTimeOffset);
+    Journal_Leave();
+}
+
+void NAR_AddInputNarseseBatch(char **narsese_sentences, int amount)
+{
+    assert(initialized, "NAR not initialized yet, call NAR_INIT first!");
+    for(int i=0; i<amount; i++)
+    {
+        Term term;
+        Truth tv;
+        char punctuation;
+        int tense;
+        double occurrenceTimeOffset;
+        Narsese_Sentence(narsese_sentences[i], &term, &punctuation, &tense, &tv, &occurrenceTimeOffset); //the journal records its new atoms and its input
+        if(punctuation == '.' && !tense)
+        {
+#if STAGE==2
+            //apply reduction rules to term:
+            term = RuleTable_Reduce(term);
+#endif
+            NAR_AddInputEternalBelief(term, tv, false); //knowledge is not echoed
+        }
+        else
+        {
+            NAR_AddInputSentence(term, punctuation, tense, tv, occurrenceTimeOffset);
+        }
+    }
+}
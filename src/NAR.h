@@ -31,14 +31,92 @@
 
 //References//
 //-----------//
+#include <ctype.h>
+#include <string.h>
+#include <pthread.h>
 #include "Cycle.h"
 #include "Narsese.h"
+#include "Journal.h"
 #include "Config.h"
 
 //Parameters//
 //----------//
 #define NAR_DEFAULT_TRUTH ((Truth) { .frequency = NAR_DEFAULT_FREQUENCY, .confidence = NAR_DEFAULT_CONFIDENCE })
-extern long currentTime;
+extern THREAD_LOCAL long currentTime;
+
+//Data structure//
+//--------------//
+typedef struct
+{
+    bool answered;
+    Term term;
+    Truth truth;
+    long occurrenceTime; //OCCURRENCE_ETERNAL for eternal answers
+    long creationTime;
+}Answer;
+//Reasoner instance, keeping the state of all modules while another instance is selected
+typedef struct
+{
+    Memory_State memory;
+    InvertedAtomIndex_State invertedAtomIndex;
+    Narsese_State narsese;
+    Cycle_State cycle;
+    Decision_State decision;
+    Event_State event;
+    Stats_State stats;
+    Truth_State truth;
+    Globals_State globals;
+    Journal_State journal;
+    long currentTime;
+    bool initialized;
+    int op_k;
+    pthread_mutex_t lock; //held by the thread which acquired the instance, not part of the state
+}NAR;
+//Header of snapshot files, which are only loaded by builds of the same version, byte order and layout
+#define NAR_SNAPSHOT_VERSION 3
+#define NAR_SNAPSHOT_BYTE_ORDER 0x01020304
+typedef struct
+{
+    char magic[8];
+    int version; //increased when the saved state changes
+    unsigned int byteOrder; //NAR_SNAPSHOT_BYTE_ORDER, which reads as another value on a machine of other endianness
+    int layout[8]; //sizes the binary layout depends on, which have to be the same to load it
+}NAR_SnapshotHeader;
+//Amounts of a hashtable, its slots are in the arena
+typedef struct
+{
+    int itemsAmount;
+    int freeSlots;
+}NAR_SnapshotHashTable;
+//State of the modules in a snapshot besides the arena, the amounts and counters without the pointers, which are only valid in the process which saved it
+typedef struct
+{
+    Memory_Config memoryConfig;
+    int conceptsAmount;
+    int cyclingBeliefEventsAmount;
+    int cyclingGoalEventsAmount;
+    NAR_SnapshotHashTable HTconcepts;
+    NAR_SnapshotHashTable HTcycling_belief_events;
+    NAR_SnapshotHashTable HTcycling_goal_events;
+    NAR_SnapshotHashTable HTatoms;
+    Operation operations[OPERATIONS_MAX]; //without their procedures
+    bool LAZY_FORGETTING;
+    int preconditionTablesFree; //the stackpointer of the precondition table pool
+    int operation_conceptsAmount[OPERATIONS_MAX+1];
+    double conceptPriorityThreshold;
+    int concept_id;
+    int postingsUsed;
+    int term_index;
+    long conceptProcessID;
+    int usefulnessUpdateIndex;
+    Decision_State decision; //without its scratch storage
+    Event_State event;
+    Stats_State stats; //without the rule stats
+    Truth_State truth;
+    Globals_State globals;
+    long currentTime;
+    int op_k;
+}NAR_Snapshot;
 
 //Callback function types//
 //-----------------------//
@@ -46,17 +124,54 @@ extern long currentTime;
 
 //Methods//
 //-------//
-//Init/Reset system
+//The NAR_* methods below act on the selected instance of the calling thread, which is the thread's default instance unless another one was selected
+//Instances selected on different threads run at the same time, an instance must not be selected on two threads at once
+//Create a reasoner instance with its own memory of the given capacities, the selected instance stays selected
+NAR *NAR_New(Memory_Config config);
+//Delete a reasoner instance and its memory, selecting the default instance if it was the selected one
+void NAR_Delete(NAR *nar);
+//Select the instance the NAR_* methods act on, NULL for the default instance of the thread
+void NAR_Select(NAR *nar);
+//The selected instance
+NAR *NAR_Selected();
+//Select an instance of NAR_New which multiple threads use, they get it one at a time until NAR_Release selects the thread's default instance again
+void NAR_Acquire(NAR *nar);
+void NAR_Release();
+//Hand the selected instance to the worker threads of a parallel region, the state is kept in it until NAR_Unshare
+NAR *NAR_Share();
+void NAR_Unshare(NAR *nar);
+//Bind the thread to a copy of the state of the shared instance until NAR_Unbind, the storage it refers to is the instance's, changes of the copy itself are dropped
+//The lock of the binding is not used, it's left uninitialized
+void NAR_Bind(NAR *binding, NAR *shared);
+void NAR_Unbind(NAR *binding);
+//Save the reasoner state to a snapshot file, false on failure
+bool NAR_Save(char *path);
+//Load the reasoner state from a snapshot file of the same build, replacing the current one, false on failure
+//Operations keep the procedures registered under the same name before, others have to be registered again
+bool NAR_Load(char *path);
+//Init/Reset system, with the memory capacities it was initialized with before, else the defaults of Config.h
 void NAR_INIT();
+//Init/Reset system with the given memory capacities
+void NAR_INIT_Config(Memory_Config config);
 //Run the system for a certain amount of cycles
 void NAR_Cycles(int cycles);
 //Add input
 Event NAR_AddInput(Term term, char type, Truth truth, bool eternal, double occurrenceTimeOffset);
 Event NAR_AddInputBelief(Term term);
+//Add an eternal belief like NAR_AddInput, echo is whether it's printed, which is skipped when adding knowledge in bulk
+Event NAR_AddInputEternalBelief(Term term, Truth truth, bool echo);
 Event NAR_AddInputGoal(Term term);
 //Add an operation
 void NAR_AddOperation(char *atomname, Action procedure);
 //Add an Narsese sentence:
 void NAR_AddInputNarsese(char *narsese_sentence);
+//Add Narsese sentences in their order like NAR_AddInputNarsese, eternal beliefs without printing them
+void NAR_AddInputNarseseBatch(char **narsese_sentences, int amount);
+//Answer a batch of questions in one sweep over the concepts which can answer them
+void NAR_AnswerQuestions(Term *questions, int *tenses, int amount, Answer *answers);
+//Print an answer the same way as for Narsese questions
+void NAR_PrintAnswer(Answer *answer);
+//Add a line of Narsese questions like "<a --> b>? <?1 --> c>? :|:" and answer them as a batch
+void NAR_AddInputNarseseQuestions(char *narsese_questions);
 
 #endif
@@ -25,268 +25,116 @@
 #include "Narsese.h"
 #include "NAR.h"
 
-//Atomic term names:
-char Narsese_atomNames[ATOMS_MAX][ATOMIC_TERM_LEN_MAX];
-char Narsese_operatorNames[OPERATIONS_MAX][ATOMIC_TERM_LEN_MAX];
-//upper bound of multplier 3 given by [ becoming "(' " replacement
-#define REPLACEMENT_LEN 3*NARSESE_LEN_MAX
-//size for the expanded array with spaces for tokenization, has at most 3 times the amount of chars as the replacement array
-#define EXPANSION_LEN REPLACEMENT_LEN*3
+//Atomic term names, taken from the memory arena:
+THREAD_LOCAL char (*Narsese_atomNames)[ATOMIC_TERM_LEN_MAX];
+THREAD_LOCAL char Narsese_operatorNames[OPERATIONS_MAX][ATOMIC_TERM_LEN_MAX];
 //whether the package is initialized
-static bool initialized = false;
+static THREAD_LOCAL bool initialized = false;
 //SELF atom, avoids strcmp for checking operator format
-Atom SELF;
+THREAD_LOCAL Atom SELF;
 
-//Replace copulas with canonical single-char copulas, including sets and set elements!
-char* replaceWithCanonicalCopulas(char *narsese, int n)
+int Narsese_CanonicalCopula(char *narsese, int n, int *i, char *replaced)
 {
-    static char narsese_replaced[REPLACEMENT_LEN]; 
-    memset(narsese_replaced, ' ', REPLACEMENT_LEN);
-    //upper bound of 3 increment given by max. look-ahead of --> becoming :, plus 0 at the end
-    assert(n+3 <= NARSESE_LEN_MAX, "NARSESE_LEN_MAX too small, consider increasing or split input into multiple statements! \n");
-    int j=0;
-    for(int i=0; i<n; )
-    {
-        if(narsese[i] == ',') //, becomes " "
-        {
-            narsese_replaced[j] = ' '; 
-            i++; j++;
-        }
-        else
-        if(narsese[i] == '[') // [ becomes "(' "
-        {
-            narsese_replaced[j] = '('; 
-            narsese_replaced[j+1] = '\''; 
-            narsese_replaced[j+2] = ' '; 
-            i++; j+=3;
-        }
-        else
-        if(narsese[i] == '{') // { becomes '(" '
-        {
-            narsese_replaced[j] = '('; 
-            narsese_replaced[j+1] = '"'; 
-            narsese_replaced[j+2] = ' '; 
-            i++; j+=3;
-        }
-        else
-        if(narsese[i] == '}' || narsese[i] == ']' || narsese[i] == '>') // }, ], > becomes )
-        {
-            narsese_replaced[j] = ')';
-            i++; j++; 
-        }
-        else
-        if(narsese[i] == '<' && narsese[i+1] != '-' && narsese[i+1] != '=') // < becomes (
-        {
-            narsese_replaced[j] = '(';
-            i++; j++; 
-        }
-        else
-        if(i+1 < n)
-        {
-            if(narsese[i] == '&' && narsese[i+1] == '/') // &/ becomes +
-            {
-                narsese_replaced[j] = '+';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '&' && narsese[i+1] == '&') // && becomes ;
-            {
-                narsese_replaced[j] = ';';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '|' && narsese[i+1] == '|') // || becomes _
-            {
-                narsese_replaced[j] = '_';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '/' && narsese[i+1] == '1') // /1 becomes /
-            {
-                narsese_replaced[j] = '/';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '/' && narsese[i+1] == '2') // /2 becomes %
-            {
-                narsese_replaced[j] = '%';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '\\' && narsese[i+1] == '1') // \1 becomes backslash
-            {
-                narsese_replaced[j] = '\\';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '\\' && narsese[i+1] == '2') // \2 becomes #
-            {
-                narsese_replaced[j] = '#';
-                i+=2; j++;
-            }
-            else
-            if(i+2 < n)
-            {
-                if(narsese[i] == '-' && narsese[i+1] == '-' && narsese[i+2] == '>') // --> becomes :
-                {
-                    narsese_replaced[j] = ':';
-                    i+=3; j++;
-                }
-                else
-                if(narsese[i] == '<' && narsese[i+1] == '-' && narsese[i+2] == '>') // <-> becomes =
-                {
-                    narsese_replaced[j] = '=';
-                    i+=3; j++;
-                }
-                else
-                if(narsese[i] == '=' && narsese[i+1] == '/' && narsese[i+2] == '>') // =/> becomes $
-                {
-                    narsese_replaced[j] = '$';
-                    i+=3; j++;
-                }
-                else
-                if(narsese[i] == '=' && narsese[i+1] == '=' && narsese[i+2] == '>') // ==> becomes ?
-                {
-                    narsese_replaced[j] = '?';
-                    i+=3; j++;
-                }
-                else
-                if(narsese[i] == '<' && narsese[i+1] == '=' && narsese[i+2] == '>') // <=> becomes ^
-                {
-                    narsese_replaced[j] = '^';
-                    i+=3; j++;
-                }
-                else
-                if(narsese[i] == '-' && narsese[i+1] == '-' && narsese[i+2] != '>') // -- becomes !
-                {
-                    narsese_replaced[j] = '!';
-                    i+=2; j++;
-                }
-                else
-                {
-                    goto DEFAULT;
-                }
-            }
-            else
-            {
-                goto DEFAULT;
-            }
-        }
-        else
-        {
-            goto DEFAULT;
-        }
-        continue;
-        DEFAULT:
-        narsese_replaced[j] = narsese[i]; //default
-        i++; j++;
+    char c = narsese[*i], c1 = *i+1 < n ? narsese[*i+1] : 0, c2 = *i+2 < n ? narsese[*i+2] : 0;
+    int consumed = 1, written = 1;
+    if(c == ',') //, becomes " "
+    {
+        replaced[0] = ' ';
     }
-    narsese_replaced[j] = 0;
-    return narsese_replaced;
-}
-
-char* Narsese_Expand(char *narsese)
-{
-    //upper bound being 3* the multiplier of the previous upper bound
-    static char narsese_expanded[EXPANSION_LEN]; 
-    memset(narsese_expanded, ' ', EXPANSION_LEN);
-    char *narsese_replaced = replaceWithCanonicalCopulas(narsese, strlen(narsese));
-    int k = 0, n = strlen(narsese_replaced);
-    for(int i=0; i<n; i++)
-    {
-        bool opener_closer = false;
-        if(narsese_replaced[i] == '(' || narsese_replaced[i] == ')')
-        {
-            k+=1;
-            opener_closer = true;
-        }
-        narsese_expanded[k] = narsese_replaced[i];
-        if(narsese_replaced[i] == 0)
-        {
-            break;
-        }
-        if(opener_closer)
-        {
-            k+=1;
-        }
-        k+=1;
+    else
+    if(c == '[' || c == '{') // [ becomes "(' " and { becomes '(" '
+    {
+        replaced[0] = '(';
+        replaced[1] = c == '[' ? '\'' : '"';
+        replaced[2] = ' ';
+        written = 3;
     }
-    narsese_expanded[k] = 0;
-    return narsese_expanded;
-}
-
-//skips one compound term by counting parenthesis (1 for "(", -1 for ")") till counter becomes zero again, returning the component index right after it
-int skipCompound(char** tokens, int i, int nt)
-{
-    int parenthesis_cnt = 0; //incremented for each (, decremented for each ), count will be zero after the compound again
-    for(; i<nt; i++)
+    else
+    if(c == '}' || c == ']' || c == '>') // }, ], > becomes )
     {
-        if(tokens[i][0] == '(' && tokens[i][1] == 0)
-        {
-            parenthesis_cnt += 1;
-        }
-        if(tokens[i][0] == ')' && tokens[i][1] == 0)
-        {
-            parenthesis_cnt -= 1;
-        }
-        if(parenthesis_cnt==0)
-        {
-            return i+1;
-        }
+        replaced[0] = ')';
     }
-    return i;
-}
-
-char** Narsese_PrefixTransform(char* narsese_expanded)
-{
-    static char* tokens[NARSESE_LEN_MAX+1]; //there cannot be more tokens than chars
-    memset(tokens, 0, (NARSESE_LEN_MAX+1)*sizeof(char*)); //and last one stays NULL for sure
-    char* token = strtok(narsese_expanded, " ");
-    int nt = 0, nc = NUM_ELEMENTS(Naresese_CanonicalCopulas) - 1;
-    while(token)
+    else
+    if(c == '<' && c1 != '-' && c1 != '=') // < becomes (
+    {
+        replaced[0] = '(';
+    }
+    else
+    if(c == '&' && c1 == '/') // &/ becomes +
     {
-        tokens[nt] = token;
-        token = strtok(NULL, " ");
-        nt++;
+        replaced[0] = '+'; consumed = 2;
     }
-    for(int i=0; i<nt-2; i++)
+    else
+    if(c == '&' && c1 == '&') // && becomes ;
     {
-        if(tokens[i][0] == '(' && tokens[i][1] == 0)   //see if it's in prefix form
-        {
-            for(int k=0; k<nc; k++)
-            {
-                if(tokens[i+1][0] == (int) Naresese_CanonicalCopulas[k] && tokens[i+1][1] == 0)
-                {
-                    goto Continue;
-                }
-            }
-            //it's not a copula, so its in infix form, we need to find its copula and put it before tokens[i+1]
-            int i2 = skipCompound(tokens, i+1, nt);
-            if(i2 < nt)
-            {
-                //1. backup copula token
-                char copula = tokens[i2][0];
-                //2. shift all tokens forward up to copula position and set the copula to be at i+1 instead
-                for(int j=i2; j>=i+2; j--)
-                {
-                    char *temp = tokens[j];
-                    tokens[j] = tokens[j-1];
-                    tokens[j-1] = temp;
-                }
-                tokens[i+1][0] = copula;
-                tokens[i+1][1] = 0;
-            }
-        }
-        Continue:;
+        replaced[0] = ';'; consumed = 2;
     }
-    return tokens;
+    else
+    if(c == '|' && c1 == '|') // || becomes _
+    {
+        replaced[0] = '_'; consumed = 2;
+    }
+    else
+    if(c == '/' && c1 == '1') // /1 becomes /
+    {
+        replaced[0] = '/'; consumed = 2;
+    }
+    else
+    if(c == '/' && c1 == '2') // /2 becomes %
+    {
+        replaced[0] = '%'; consumed = 2;
+    }
+    else
+    if(c == '\\' && c1 == '1') // \1 becomes backslash
+    {
+        replaced[0] = '\\'; consumed = 2;
+    }
+    else
+    if(c == '\\' && c1 == '2') // \2 becomes #
+    {
+        replaced[0] = '#'; consumed = 2;
+    }
+    else
+    if(c == '-' && c1 == '-' && c2 == '>') // --> becomes :
+    {
+        replaced[0] = ':'; consumed = 3;
+    }
+    else
+    if(c == '<' && c1 == '-' && c2 == '>') // <-> becomes =
+    {
+        replaced[0] = '='; consumed = 3;
+    }
+    else
+    if(c == '=' && c1 == '/' && c2 == '>') // =/> becomes $
+    {
+        replaced[0] = '$'; consumed = 3;
+    }
+    else
+    if(c == '=' && c1 == '=' && c2 == '>') // ==> becomes ?
+    {
+        replaced[0] = '?'; consumed = 3;
+    }
+    else
+    if(c == '<' && c1 == '=' && c2 == '>') // <=> becomes ^
+    {
+        replaced[0] = '^'; consumed = 3;
+    }
+    else
+    if(c == '-' && c1 == '-' && c2) // -- becomes !, unless at the end
+    {
+        replaced[0] = '!'; consumed = 2;
+    }
+    else
+    {
+        replaced[0] = c; //default
+    }
+    *i += consumed;
+    return written;
 }
 
-HashTable HTatoms;
-VMItem* HTatoms_storageptrs[ATOMS_MAX];
-VMItem HTatoms_storage[ATOMS_MAX];
-VMItem* HTatoms_HT[ATOMS_HASHTABLE_BUCKETS];
-int term_index = 0;
+THREAD_LOCAL HashTable HTatoms;
+THREAD_LOCAL HashTableSlot *HTatoms_slots;
+THREAD_LOCAL int term_index = 0;
 
 //Returns the memoized index of an already seen atomic term
 int Narsese_AtomicTermIndex(char *name)
@@ -294,17 +142,19 @@ int Narsese_AtomicTermIndex(char *name)
     char blockname[ATOMIC_TERM_LEN_MAX] = {0};
     strncpy(blockname, name, ATOMIC_TERM_LEN_MAX-1);
     long ret_index = -1;
-    void* retptr = HashTable_Get(&HTatoms, blockname);
+    HASH_TYPE hash = Globals_Hash((HASH_TYPE*) blockname, ATOMIC_TERM_LEN_MAX / HASH_TYPE_SIZE); //hashed once for both lookup and insertion, as Narsese_StringHash does
+    void* retptr = HashTable_GetWithHash(&HTatoms, blockname, hash);
     if(retptr != NULL)
     {
         ret_index = (long) retptr; //we got the value
     }
     if(ret_index == -1)
     {
-        assert(term_index < ATOMS_MAX, "Too many terms for NAR");
+        assert(term_index < memoryConfig.atomsMax, "Too many terms for NAR");
+        Journal_RecordAtom(name);
         ret_index = term_index+1;
         strncpy(Narsese_atomNames[term_index], name, ATOMIC_TERM_LEN_MAX-1);
-        HashTable_Set(&HTatoms, (HASH_TYPE*) Narsese_atomNames[term_index], (void*) ret_index);
+        HashTable_SetWithHash(&HTatoms, (HASH_TYPE*) Narsese_atomNames[term_index], hash, (void*) ret_index);
         term_index++;
     }
     return ret_index;
@@ -317,50 +167,120 @@ int Narsese_CopulaIndex(char name)
     return Narsese_AtomicTermIndex(copname);
 }
 
-//Encodes a binary tree in an array, based on the the S-expression tokenization with prefix order
-void buildBinaryTree(Term *bintree, char** tokens_prefix, int i1, int tree_index, int nt)
+//Single-pass parsing state: the input, its canonical chars which were not consumed yet, and the current token
+static THREAD_LOCAL char *parse_narsese;
+static THREAD_LOCAL int parse_len, parse_i;
+static THREAD_LOCAL char parse_replaced[3];
+static THREAD_LOCAL int parse_replaced_amount, parse_replaced_i;
+static THREAD_LOCAL char parse_token[NARSESE_LEN_MAX];
+static THREAD_LOCAL bool parse_variables; //whether normalization is needed
+
+//The next canonical char, or 0 at the end of the input
+static char Narsese_PeekChar()
 {
-    if(tokens_prefix[i1][0] == '(' && tokens_prefix[i1][1] == 0)
-    {
-        int icop = i1+1;
-        //first argument is given by the copula
-        i1 = i1+2;
-        //second argument has to be searched for
-        int i2 = skipCompound(tokens_prefix, i1, nt);
-        bintree->atoms[tree_index-1] = Narsese_AtomicTermIndex(tokens_prefix[icop]);
-        if(i1<nt)
-        {
-            buildBinaryTree(bintree, tokens_prefix, i1, tree_index*2, nt); //left child of tree index
-        }
-        if(i2<nt)
+    if(parse_replaced_i == parse_replaced_amount)
+    {
+        if(parse_i >= parse_len)
         {
-            buildBinaryTree(bintree, tokens_prefix, i2, tree_index*2+1, nt); //right child of tree index
+            return 0;
         }
+        parse_replaced_amount = Narsese_CanonicalCopula(parse_narsese, parse_len, &parse_i, parse_replaced);
+        parse_replaced_i = 0;
+    }
+    return parse_replaced[parse_replaced_i];
+}
+
+//Reads the next token, separated by spaces and parentheses, an empty token marks the end of the input
+static void Narsese_NextToken()
+{
+    int len = 0;
+    while(Narsese_PeekChar() == ' ')
+    {
+        parse_replaced_i++;
+    }
+    char c = Narsese_PeekChar();
+    if(c == '(' || c == ')')
+    {
+        parse_token[len++] = c;
+        parse_replaced_i++;
     }
     else
     {
-        assert(tree_index-1 < COMPOUND_TERM_SIZE_MAX, "COMPOUND_TERM_SIZE_MAX too small, consider increasing or split input into multiple statements!");
-        if(!(tokens_prefix[i1][0] == ')' && tokens_prefix[i1][1] == 0))
+        for(; c != 0 && c != ' ' && c != '(' && c != ')'; c = Narsese_PeekChar())
         {
-            bintree->atoms[tree_index-1] = Narsese_AtomicTermIndex(tokens_prefix[i1]);
+            parse_token[len++] = c;
+            parse_replaced_i++;
         }
-        else
+    }
+    parse_token[len] = 0;
+}
+
+static bool Narsese_TokenIs(char c)
+{
+    return parse_token[0] == c && parse_token[1] == 0;
+}
+
+//Encodes the term starting at the current token into the binary tree at tree_index, interning the atoms in prefix order
+//the copula of an infix compound is known after its first argument, it is written to its position then, no reordering needed
+static void Narsese_ParseTerm(Term *term, int tree_index)
+{
+    if(!parse_token[0])
+    {
+        return;
+    }
+    assert(tree_index-1 < COMPOUND_TERM_SIZE_MAX, "COMPOUND_TERM_SIZE_MAX too small, consider increasing or split input into multiple statements!");
+    if(Narsese_TokenIs(')'))
+    {
+        term->atoms[tree_index-1] = Narsese_CopulaIndex(SET_TERMINATOR); //just use "@" for second element as terminator, while "." acts for "deeper" sets than 2
+        return; //the parenthesis closes the compound it is in
+    }
+    if(!Narsese_TokenIs('('))
+    {
+        parse_variables = parse_variables || (parse_token[1] && (parse_token[0] == '$' || parse_token[0] == '#' || parse_token[0] == '?'));
+        term->atoms[tree_index-1] = Narsese_AtomicTermIndex(parse_token);
+        Narsese_NextToken();
+        return;
+    }
+    Narsese_NextToken();
+    if(parse_token[0] && !parse_token[1] && strchr(Naresese_CanonicalCopulas, parse_token[0])) //prefix form
+    {
+        term->atoms[tree_index-1] = Narsese_AtomicTermIndex(parse_token);
+        Narsese_NextToken();
+        Narsese_ParseTerm(term, tree_index*2); //left child of tree index
+    }
+    else //infix form
+    {
+        Narsese_ParseTerm(term, tree_index*2);
+        if(parse_token[0] && !Narsese_TokenIs(')'))
         {
-            bintree->atoms[tree_index-1] = Narsese_CopulaIndex(SET_TERMINATOR); //just use "@" for second element as terminator, while "." acts for "deeper" sets than 2
+            term->atoms[tree_index-1] = Narsese_CopulaIndex(parse_token[0]);
+            Narsese_NextToken();
         }
     }
+    Narsese_ParseTerm(term, tree_index*2+1); //right child of tree index
+    //arguments after the second one are skipped, till the parenthesis which closes the compound
+    for(int parenthesis_cnt = 1; parse_token[0] && parenthesis_cnt > 0; Narsese_NextToken())
+    {
+        parenthesis_cnt += Narsese_TokenIs('(') ? 1 : (Narsese_TokenIs(')') ? -1 : 0);
+    }
 }
 
 Term Narsese_Term(char *narsese)
 {
     assert(initialized, "Narsese not initialized, call Narsese_INIT first!");
-    //parse Narsese by expanding it, bringing into prefix form, then building a binary tree, and normalizing variables
+    //parse Narsese in a single pass, building the binary tree while tokenizing, then normalize variables
     Term ret = {0};
-    char *narsese_expanded = Narsese_Expand(narsese);
-    char** tokens_prefix = Narsese_PrefixTransform(narsese_expanded);
-    int nt = 0; for(;tokens_prefix[nt] != NULL; nt++){}
-    buildBinaryTree(&ret, tokens_prefix, 0, 1, nt);
-    Variable_Normalize(&ret);
+    parse_narsese = narsese;
+    parse_len = strlen(narsese);
+    assert(parse_len+3 <= NARSESE_LEN_MAX, "NARSESE_LEN_MAX too small, consider increasing or split input into multiple statements! \n");
+    parse_i = parse_replaced_amount = parse_replaced_i = 0;
+    parse_variables = false;
+    Narsese_NextToken();
+    Narsese_ParseTerm(&ret, 1);
+    if(parse_variables)
+    {
+        Variable_Normalize(&ret);
+    }
     Term_Hash(&ret);
     return ret;
 }
@@ -630,9 +550,11 @@ bool Narsese_StringEqual(char *name1, char *name2)
 
 void Narsese_INIT()
 {
-    HashTable_INIT(&HTatoms, HTatoms_storage, HTatoms_storageptrs, HTatoms_HT, ATOMS_HASHTABLE_BUCKETS, ATOMS_MAX, (Equal) Narsese_StringEqual, (Hash) Narsese_StringHash);
+    Narsese_atomNames = Memory_ArenaTake(memoryConfig.atomsMax, ATOMIC_TERM_LEN_MAX);
+    HTatoms_slots = Memory_ArenaTake(HASHTABLE_BUCKETS_PER_ITEM*memoryConfig.atomsMax, sizeof(HashTableSlot));
+    HashTable_INIT(&HTatoms, HTatoms_slots, HASHTABLE_BUCKETS_PER_ITEM*memoryConfig.atomsMax, (Equal) Narsese_StringEqual, (Hash) Narsese_StringHash);
     term_index = 0;
-    for(int i=0; i<ATOMS_MAX; i++)
+    for(int i=0; i<memoryConfig.atomsMax; i++)
     {
         memset(&Narsese_atomNames[i], 0, ATOMIC_TERM_LEN_MAX);
     }
@@ -669,6 +591,17 @@ void Narsese_INIT()
     initialized = true;
 }
 
+void Narsese_SwapState(Narsese_State *state)
+{
+    SWAP_STATE(Narsese_atomNames, state->Narsese_atomNames);
+    SWAP_STATE(Narsese_operatorNames, state->Narsese_operatorNames);
+    SWAP_STATE(initialized, state->initialized);
+    SWAP_STATE(SELF, state->SELF);
+    SWAP_STATE(HTatoms, state->HTatoms);
+    SWAP_STATE(HTatoms_slots, state->HTatoms_slots);
+    SWAP_STATE(term_index, state->term_index);
+}
+
 bool Narsese_copulaEquals(Atom atom, char name)
 {
     return atom>0 && Narsese_atomNames[(int) atom-1][0] == name && Narsese_atomNames[(int) atom-1][1] == 0;
@@ -760,9 +693,9 @@ bool Narsese_IsSimpleAtom(Atom atom)
 
 bool Narsese_HasSimpleAtom(Term *term)
 {
-    for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+    for(uint64_t mask = Term_AtomsMask(term); mask; mask &= mask - 1) //only visit the atoms which are there
     {
-        if(Narsese_IsSimpleAtom(term->atoms[i]))
+        if(Narsese_IsSimpleAtom(term->atoms[Term_LowestAtom(mask)]))
         {
             return true;
         }
@@ -36,15 +36,29 @@
 #include <string.h>
 #include <stdio.h>
 #include "Term.h"
+#include "HashTable.h"
 #include "Globals.h"
 #include "Config.h"
 
 //Data structure//
 //--------------//
 //Atomic term names:
-extern char Narsese_atomNames[ATOMS_MAX][ATOMIC_TERM_LEN_MAX];
-extern char Narsese_operatorNames[OPERATIONS_MAX][ATOMIC_TERM_LEN_MAX];
-extern Atom SELF;
+extern THREAD_LOCAL char (*Narsese_atomNames)[ATOMIC_TERM_LEN_MAX];
+extern THREAD_LOCAL char Narsese_operatorNames[OPERATIONS_MAX][ATOMIC_TERM_LEN_MAX];
+extern THREAD_LOCAL Atom SELF;
+//Hashtable of the atoms, from name to index:
+extern THREAD_LOCAL HashTable HTatoms;
+//Atom table of a reasoner instance
+typedef struct
+{
+    char (*Narsese_atomNames)[ATOMIC_TERM_LEN_MAX];
+    char Narsese_operatorNames[OPERATIONS_MAX][ATOMIC_TERM_LEN_MAX];
+    bool initialized;
+    Atom SELF;
+    HashTable HTatoms;
+    HashTableSlot *HTatoms_slots;
+    int term_index;
+}Narsese_State;
 #define Narsese_RuleTableVars "ABCMRSPXYZ"
 #define Naresese_CanonicalCopulas "@*&|;:=$'\"/\\.-%#~+!?^_"
 #define PRODUCT '*'
@@ -72,13 +86,14 @@ extern Atom SELF;
 
 //Methods//
 //-------//
-//Initializes encoder
+//Initializes encoder, after Memory_INIT as its atom table is taken from the memory arena
 void Narsese_INIT();
-//Expands Narsese into by strtok(str," ") tokenizable string with canonical copulas
-char* Narsese_Expand(char *narsese);
-//Tokenize expanded Narsese in prefix copula order
-char** Narsese_PrefixTransform(char* narsese_expanded);
-//Parses a Narsese string to a compound term
+//Exchange the atom table with the one kept for a reasoner instance
+void Narsese_SwapState(Narsese_State *state);
+//Writes the canonical single-char copula of the copula or bracket at narsese[*i] into replaced, including sets and set elements!
+//Returns the amount of written chars, and advances *i after the replaced chars
+int Narsese_CanonicalCopula(char *narsese, int n, int *i, char *replaced);
+//Parses a Narsese string to a compound term, tokenizing and encoding it in a single pass
 Term Narsese_Term(char *narsese);
 //Parses a Narsese string to a compound term and a tv, tv is default if not present
 void Narsese_Sentence(char *narsese, Term *destTerm, char *punctuation, int *tense, Truth *destTv, double *occurrenceTimeOffset);
@@ -35,9 +35,14 @@
 #include "Metric.h"
 
 static int graphite_sockfd = 0;
+bool SEND_METRICS = true;
 
 void Metric_send( const char* path, int value)
 {
+    if(!SEND_METRICS)
+    {
+        return;
+    }
     char message[GRAPHITE_MAX_MSG_LEN] = {0};
     if(graphite_sockfd == 0)
     {
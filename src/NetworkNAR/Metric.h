@@ -40,6 +40,8 @@
 #define GRAPHITE_IP_ADDRESS "127.00.1"
 #define GRAPHITE_STATSD_PORT 8125
 #define GRAPHITE_MAX_MSG_LEN 130
+//Whether metrics are sent, journal replay suppresses them
+extern bool SEND_METRICS;
 
 //Methods//
 //-------//
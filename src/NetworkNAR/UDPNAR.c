@@ -27,7 +27,7 @@
 volatile bool Stopped = false;
 pthread_cond_t start_cond = PTHREAD_COND_INITIALIZER;
 pthread_mutex_t start_mutex = PTHREAD_MUTEX_INITIALIZER;
-pthread_mutex_t nar_mutex = PTHREAD_MUTEX_INITIALIZER;
+NAR *UDPNAR_instance = NULL;
 
 void* Reasoner_Thread_Run(void* timestep_address)
 {
@@ -38,9 +38,9 @@ void* Reasoner_Thread_Run(void* timestep_address)
     assert(timestep >= 0, "Nonsensical timestep for UDPNAR!");
     while(!Stopped)
     {
-        pthread_mutex_lock(&nar_mutex);
+        NAR_Acquire(UDPNAR_instance);
         NAR_Cycles(1);
-        pthread_mutex_unlock(&nar_mutex);
+        NAR_Release();
         if(timestep >= 0)
         {
             nanosleep((struct timespec[]){{0, timestep}}, NULL); //POSIX sleep for timestep nanoseconds
@@ -63,13 +63,13 @@ void* Receive_Thread_Run(void *sockfd_address)
         {
             break;
         }
-        pthread_mutex_lock(&nar_mutex);
+        NAR_Acquire(UDPNAR_instance);
         int cmd = Shell_ProcessInput(buffer);
         if(cmd == SHELL_RESET) //reset?
         {
             Shell_NARInit();
         }
-        pthread_mutex_unlock(&nar_mutex);
+        NAR_Release();
     }
     return NULL;
 }
@@ -80,7 +80,10 @@ int receiver_sockfd;
 void UDPNAR_Start(char *ip, int port, long timestep)
 {
     assert(!Stopped, "UDPNAR was already started!");
+    UDPNAR_instance = NAR_New(MEMORY_CONFIG_DEFAULT);
+    NAR_Acquire(UDPNAR_instance);
     Shell_NARInit();
+    NAR_Release();
     receiver_sockfd = UDP_INIT_Receiver(ip, port);
     //Create reasoner thread and wait for its creation
     pthread_mutex_lock(&start_mutex);
@@ -105,5 +108,6 @@ void UDPNAR_Stop()
     close(receiver_sockfd); //sufficient on Mac to get out of blocking ops on socket, insufficient on Linux (hence, use both!)
     pthread_join(thread_reasoner, NULL);
     pthread_join(thread_receiver, NULL);
+    NAR_Select(UDPNAR_instance);
     Stats_Print(currentTime);
 }
@@ -39,11 +39,16 @@
 #include <unistd.h>
 #include <pthread.h> 
 
+//Global vars//
+//-----------//
+//The instance the UDPNAR threads take turns on, which other threads use with NAR_Acquire while it runs
+extern NAR *UDPNAR_instance;
+
 //Methods//
 //-------//
-//Starts the UDPNAR with a reasoning speed given by timestep, example: 10000000L = 10ms
+//Starts the UDPNAR on an instance of its own with a reasoning speed given by timestep, example: 10000000L = 10ms
 void UDPNAR_Start(char *ip, int port, long timestep);
-//Stops the UDPNAR, cancelling its threads
+//Stops the UDPNAR, cancelling its threads, and selects its instance on the calling thread
 void UDPNAR_Stop();
 
 #endif
@@ -29,15 +29,24 @@ void PriorityQueue_INIT(PriorityQueue *queue, Item *items, int maxElements)
     queue->items = items;
     queue->maxElements = maxElements;
     queue->itemsAmount = 0;
+    queue->positionOffset = -1;
+}
+
+void PriorityQueue_KeepPositions(PriorityQueue *queue, int positionOffset)
+{
+    queue->positionOffset = positionOffset;
 }
 
 #define at(i) (queue->items[i])
+#define keepPosition(i) if(queue->positionOffset >= 0) { *(int*) ((char*) at(i).address + queue->positionOffset) = (i); }
 
 static void swap(PriorityQueue *queue, int index1, int index2)
 {
     Item temp = at(index1);
     at(index1) = at(index2);
     at(index2) = temp;
+    keepPosition(index1)
+    keepPosition(index2)
 }
 
 static bool isOnMaxLevel(int i)
@@ -229,6 +238,7 @@ PriorityQueue_Push_Feedback PriorityQueue_Push(PriorityQueue *queue, double prio
     }
     feedback.added = true;
     feedback.addedItem = at(queue->itemsAmount);
+    keepPosition(queue->itemsAmount)
     queue->itemsAmount++;
     bubbleUp(queue, queue->itemsAmount-1);
     return feedback;
@@ -243,7 +253,11 @@ bool PriorityQueue_PopAt(PriorityQueue *queue, int i, void** returnItemAddress)
     Item item = at(i);
     swap(queue, i, queue->itemsAmount-1); 
     queue->itemsAmount--;
-    trickleDown(queue, i, true); //enforce minmax heap property
+    if(i < queue->itemsAmount)
+    {
+        trickleDown(queue, i, isOnMaxLevel(i)); //enforce minmax heap property below i
+        bubbleUp(queue, i); //and above i
+    }
     if(returnItemAddress != NULL)
     {
         *returnItemAddress = item.address; 
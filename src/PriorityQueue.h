@@ -49,6 +49,7 @@ typedef struct
     Item *items;
     int itemsAmount;
     int maxElements;
+    int positionOffset; //offset of the int in the data of the items where their position is kept, -1 if they don't keep it
 } PriorityQueue;
 typedef struct
 {
@@ -62,6 +63,8 @@ typedef struct
 //-------//
 //Resets the priority queue
 void PriorityQueue_INIT(PriorityQueue *queue, Item *items, int maxElements);
+//Let the items keep their position in the queue in an int at positionOffset of their data, so that they can be found by address
+void PriorityQueue_KeepPositions(PriorityQueue *queue, int positionOffset);
 //Push element of a certain priority into the queue.
 //If successful, addedItem will point to the item in the data structure, with address of the evicted item, if eviction happened
 PriorityQueue_Push_Feedback PriorityQueue_Push(PriorityQueue *queue, double priority);
@@ -0,0 +1,10535 @@
+#include "RuleTable.h"
+void RuleTable_Apply(Term term1, Term term2, Truth truth1, Truth truth2, long conclusionOccurrence, double occurrenceTimeOffset, Stamp conclusionStamp, long currentTime, double parentPriority, double conceptPriority, bool doublePremise, Concept *validation_concept, long validation_cid)
+{
+unsigned long long ruleStart = 0;
+int ruleClass = 0;
+if(doublePremise)
+{
+switch(term1.atoms[0])
+{
+case 44:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 111; goto RULE_0;
+case 45: ruleClass = 112; goto RULE_15;
+case 43: ruleClass = 113; goto RULE_127;
+case 60: ruleClass = 114; goto RULE_129;
+case 58: ruleClass = 115; goto RULE_185;
+case 59: ruleClass = 116; goto RULE_264;
+case 57: ruleClass = 117; goto RULE_193;
+case 46: ruleClass = 118; goto RULE_241;
+case 56: ruleClass = 119; goto RULE_264;
+default: ruleClass = 110; goto RULE_264;
+}
+case 45:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 121; goto RULE_16;
+case 45: ruleClass = 122; goto RULE_9;
+case 43: ruleClass = 123; goto RULE_127;
+case 60: ruleClass = 124; goto RULE_129;
+case 58: ruleClass = 125; goto RULE_185;
+case 59: ruleClass = 126; goto RULE_264;
+case 57: ruleClass = 127; goto RULE_264;
+case 46: ruleClass = 128; goto RULE_205;
+case 56: ruleClass = 129; goto RULE_264;
+default: ruleClass = 120; goto RULE_264;
+}
+case 57:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 131; goto RULE_192;
+case 45: ruleClass = 132; goto RULE_264;
+case 43: ruleClass = 133; goto RULE_127;
+case 60: ruleClass = 134; goto RULE_129;
+case 58: ruleClass = 135; goto RULE_185;
+case 59: ruleClass = 136; goto RULE_264;
+case 57: ruleClass = 137; goto RULE_264;
+case 46: ruleClass = 138; goto RULE_264;
+case 56: ruleClass = 139; goto RULE_264;
+default: ruleClass = 130; goto RULE_264;
+}
+case 43:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 141; goto RULE_128;
+case 45: ruleClass = 142; goto RULE_128;
+case 43: ruleClass = 143; goto RULE_127;
+case 60: ruleClass = 144; goto RULE_128;
+case 58: ruleClass = 145; goto RULE_128;
+case 59: ruleClass = 146; goto RULE_128;
+case 57: ruleClass = 147; goto RULE_128;
+case 46: ruleClass = 148; goto RULE_128;
+case 56: ruleClass = 149; goto RULE_128;
+default: ruleClass = 140; goto RULE_128;
+}
+case 60:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 151; goto RULE_130;
+case 45: ruleClass = 152; goto RULE_130;
+case 43: ruleClass = 153; goto RULE_127;
+case 60: ruleClass = 154; goto RULE_129;
+case 58: ruleClass = 155; goto RULE_130;
+case 59: ruleClass = 156; goto RULE_130;
+case 57: ruleClass = 157; goto RULE_130;
+case 46: ruleClass = 158; goto RULE_130;
+case 56: ruleClass = 159; goto RULE_130;
+default: ruleClass = 150; goto RULE_130;
+}
+case 58:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 161; goto RULE_184;
+case 45: ruleClass = 162; goto RULE_184;
+case 43: ruleClass = 163; goto RULE_127;
+case 60: ruleClass = 164; goto RULE_129;
+case 58: ruleClass = 165; goto RULE_135;
+case 59: ruleClass = 166; goto RULE_166;
+case 57: ruleClass = 167; goto RULE_184;
+case 46: ruleClass = 168; goto RULE_184;
+case 56: ruleClass = 169; goto RULE_184;
+default: ruleClass = 160; goto RULE_184;
+}
+case 59:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 171; goto RULE_264;
+case 45: ruleClass = 172; goto RULE_264;
+case 43: ruleClass = 173; goto RULE_127;
+case 60: ruleClass = 174; goto RULE_129;
+case 58: ruleClass = 175; goto RULE_167;
+case 59: ruleClass = 176; goto RULE_170;
+case 57: ruleClass = 177; goto RULE_264;
+case 46: ruleClass = 178; goto RULE_203;
+case 56: ruleClass = 179; goto RULE_264;
+default: ruleClass = 170; goto RULE_264;
+}
+case 46:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 181; goto RULE_240;
+case 45: ruleClass = 182; goto RULE_204;
+case 43: ruleClass = 183; goto RULE_127;
+case 60: ruleClass = 184; goto RULE_129;
+case 58: ruleClass = 185; goto RULE_185;
+case 59: ruleClass = 186; goto RULE_202;
+case 57: ruleClass = 187; goto RULE_264;
+case 46: ruleClass = 188; goto RULE_264;
+case 56: ruleClass = 189; goto RULE_252;
+default: ruleClass = 180; goto RULE_264;
+}
+case 56:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 191; goto RULE_264;
+case 45: ruleClass = 192; goto RULE_264;
+case 43: ruleClass = 193; goto RULE_127;
+case 60: ruleClass = 194; goto RULE_129;
+case 58: ruleClass = 195; goto RULE_185;
+case 59: ruleClass = 196; goto RULE_264;
+case 57: ruleClass = 197; goto RULE_264;
+case 46: ruleClass = 198; goto RULE_253;
+case 56: ruleClass = 199; goto RULE_228;
+default: ruleClass = 190; goto RULE_264;
+}
+default:
+switch(term2.atoms[0])
+{
+case 44: ruleClass = 101; goto RULE_264;
+case 45: ruleClass = 102; goto RULE_264;
+case 43: ruleClass = 103; goto RULE_127;
+case 60: ruleClass = 104; goto RULE_129;
+case 58: ruleClass = 105; goto RULE_185;
+case 59: ruleClass = 106; goto RULE_264;
+case 57: ruleClass = 107; goto RULE_264;
+case 46: ruleClass = 108; goto RULE_264;
+case 56: ruleClass = 109; goto RULE_264;
+default: ruleClass = 100; goto RULE_264;
+}
+}
+}
+switch(term1.atoms[0])
+{
+case 44:
+ruleClass = 10; goto RULE_19;
+case 45:
+ruleClass = 20; goto RULE_8;
+case 57:
+ruleClass = 30; goto RULE_123;
+case 43:
+ruleClass = 40; goto RULE_124;
+case 60:
+ruleClass = 50; goto RULE_264;
+case 58:
+ruleClass = 60; goto RULE_264;
+case 59:
+ruleClass = 70; goto RULE_159;
+case 46:
+ruleClass = 80; goto RULE_264;
+case 56:
+ruleClass = 90; goto RULE_264;
+default:
+ruleClass = 0; goto RULE_264;
+}
+RULE_0:
+{
+RULE_STATS_ATTEMPT(0)
+if(!doublePremise) { goto NEXT_0; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_0; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_0; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_0; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_0; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_0; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_0; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(0)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_0; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_0; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 0);}
+NEXT_0:
+RULE_STATS_END(0)
+switch(ruleClass)
+{
+}
+RULE_1:
+{
+RULE_STATS_ATTEMPT(1)
+if(!doublePremise) { goto NEXT_1; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_1; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_1; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_1; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_1; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_1; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_1; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(1)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_1; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_1; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 1);}
+NEXT_1:
+RULE_STATS_END(1)
+switch(ruleClass)
+{
+}
+RULE_2:
+{
+RULE_STATS_ATTEMPT(2)
+if(!doublePremise) { goto NEXT_2; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_2; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_2; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_2; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_2; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_2; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_2; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(2)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_2; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_2; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 2);}
+NEXT_2:
+RULE_STATS_END(2)
+switch(ruleClass)
+{
+}
+RULE_3:
+{
+RULE_STATS_ATTEMPT(3)
+if(!doublePremise) { goto NEXT_3; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_3; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_3; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_3; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_3; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_3; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_3; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(3)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_3; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_3; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 3);}
+NEXT_3:
+RULE_STATS_END(3)
+switch(ruleClass)
+{
+}
+RULE_4:
+{
+RULE_STATS_ATTEMPT(4)
+if(!doublePremise) { goto NEXT_4; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_4; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_4; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_4; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_4; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_4; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_4; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(4)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_4; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_4; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 4);}
+NEXT_4:
+RULE_STATS_END(4)
+switch(ruleClass)
+{
+}
+RULE_5:
+{
+RULE_STATS_ATTEMPT(5)
+if(!doublePremise) { goto NEXT_5; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_5; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_5; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_5; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_5; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_5; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_5; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(5)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_5; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_5; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 5);}
+NEXT_5:
+RULE_STATS_END(5)
+switch(ruleClass)
+{
+}
+RULE_6:
+{
+RULE_STATS_ATTEMPT(6)
+if(!doublePremise) { goto NEXT_6; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_6; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_6; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_6; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_6; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_6; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_6; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(6)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_6; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_6; }
+Truth conclusionTruth = Truth_Exemplification(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 6);}
+NEXT_6:
+RULE_STATS_END(6)
+switch(ruleClass)
+{
+}
+RULE_7:
+{
+RULE_STATS_ATTEMPT(7)
+if(!doublePremise) { goto NEXT_7; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_7; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_7; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_7; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_7; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_7; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_7; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(7)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_7; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_7; }
+Truth conclusionTruth = Truth_Exemplification(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 7);}
+NEXT_7:
+RULE_STATS_END(7)
+switch(ruleClass)
+{
+case 111: goto RULE_11;
+}
+RULE_8:
+{
+RULE_STATS_ATTEMPT(8)
+if(doublePremise) { goto NEXT_8; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_8; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_8; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_8; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(8)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_8; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_8; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 8);}
+NEXT_8:
+RULE_STATS_END(8)
+switch(ruleClass)
+{
+case 20: goto RULE_25;
+}
+RULE_9:
+{
+RULE_STATS_ATTEMPT(9)
+if(!doublePremise) { goto NEXT_9; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_9; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_9; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_9; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_9; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_9; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_9; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(9)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_9; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_9; }
+Truth conclusionTruth = Truth_Resemblance(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 9);}
+NEXT_9:
+RULE_STATS_END(9)
+switch(ruleClass)
+{
+}
+RULE_10:
+{
+RULE_STATS_ATTEMPT(10)
+if(!doublePremise) { goto NEXT_10; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_10; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_10; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_10; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_10; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_10; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_10; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(10)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_10; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_10; }
+Truth conclusionTruth = Truth_Resemblance(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 10);}
+NEXT_10:
+RULE_STATS_END(10)
+switch(ruleClass)
+{
+case 122: goto RULE_264;
+}
+RULE_11:
+{
+RULE_STATS_ATTEMPT(11)
+if(!doublePremise) { goto NEXT_11; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_11; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_11; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_11; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_11; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_11; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_11; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(11)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_11; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_11; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 11);}
+NEXT_11:
+RULE_STATS_END(11)
+switch(ruleClass)
+{
+}
+RULE_12:
+{
+RULE_STATS_ATTEMPT(12)
+if(!doublePremise) { goto NEXT_12; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_12; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_12; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_12; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_12; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_12; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_12; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(12)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_12; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_12; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 12);}
+NEXT_12:
+RULE_STATS_END(12)
+switch(ruleClass)
+{
+}
+RULE_13:
+{
+RULE_STATS_ATTEMPT(13)
+if(!doublePremise) { goto NEXT_13; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_13; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_13; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_13; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_13; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_13; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_13; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(13)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_13; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_13; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 13);}
+NEXT_13:
+RULE_STATS_END(13)
+switch(ruleClass)
+{
+}
+RULE_14:
+{
+RULE_STATS_ATTEMPT(14)
+if(!doublePremise) { goto NEXT_14; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_14; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_14; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_14; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_14; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_14; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_14; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(14)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_14; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_14; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 14);}
+NEXT_14:
+RULE_STATS_END(14)
+switch(ruleClass)
+{
+case 111: goto RULE_39;
+}
+RULE_15:
+{
+RULE_STATS_ATTEMPT(15)
+if(!doublePremise) { goto NEXT_15; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_15; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_15; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_15; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_15; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_15; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_15; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(15)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_15; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_15; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 15);}
+NEXT_15:
+RULE_STATS_END(15)
+switch(ruleClass)
+{
+case 112: goto RULE_17;
+}
+RULE_16:
+{
+RULE_STATS_ATTEMPT(16)
+if(!doublePremise) { goto NEXT_16; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_16; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_16; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_16; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_16; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_16; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_16; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(16)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_16; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_16; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 16);}
+NEXT_16:
+RULE_STATS_END(16)
+switch(ruleClass)
+{
+case 121: goto RULE_18;
+}
+RULE_17:
+{
+RULE_STATS_ATTEMPT(17)
+if(!doublePremise) { goto NEXT_17; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_17; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_17; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_17; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_17; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_17; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_17; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(17)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_17; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_17; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 17);}
+NEXT_17:
+RULE_STATS_END(17)
+switch(ruleClass)
+{
+case 112: goto RULE_21;
+}
+RULE_18:
+{
+RULE_STATS_ATTEMPT(18)
+if(!doublePremise) { goto NEXT_18; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_18; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_18; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_18; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_18; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_18; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_18; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(18)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_18; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_18; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 18);}
+NEXT_18:
+RULE_STATS_END(18)
+switch(ruleClass)
+{
+case 121: goto RULE_22;
+}
+RULE_19:
+{
+RULE_STATS_ATTEMPT(19)
+if(doublePremise) { goto NEXT_19; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_19; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_19; }
+substitutions[33] = subtree;
+if(term1.atoms[2] != 48){ goto NEXT_19; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_19; }
+substitutions[34] = subtree;
+if(term1.atoms[6] != 39){ goto NEXT_19; }
+RULE_STATS_UNIFICATION(19)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_19; }
+conclusion.atoms[2] = 48;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[34])){ goto NEXT_19; }
+conclusion.atoms[6] = 39;
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 19);}
+NEXT_19:
+RULE_STATS_END(19)
+switch(ruleClass)
+{
+}
+RULE_20:
+{
+RULE_STATS_ATTEMPT(20)
+if(doublePremise) { goto NEXT_20; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_20; }
+if(term1.atoms[1] != 47){ goto NEXT_20; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_20; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_20; }
+substitutions[33] = subtree;
+if(term1.atoms[4] != 39){ goto NEXT_20; }
+RULE_STATS_UNIFICATION(20)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+conclusion.atoms[1] = 47;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_20; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_20; }
+conclusion.atoms[4] = 39;
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 20);}
+NEXT_20:
+RULE_STATS_END(20)
+switch(ruleClass)
+{
+case 10: goto RULE_27;
+}
+RULE_21:
+{
+RULE_STATS_ATTEMPT(21)
+if(!doublePremise) { goto NEXT_21; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_21; }
+if(term1.atoms[1] != 48){ goto NEXT_21; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_21; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_21; }
+substitutions[31] = subtree;
+if(term1.atoms[4] != 39){ goto NEXT_21; }
+if(term2.atoms[0] != 45){ goto NEXT_21; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_21; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_21; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(21)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 48;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_21; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_21; }
+conclusion.atoms[4] = 39;
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 21);}
+NEXT_21:
+RULE_STATS_END(21)
+switch(ruleClass)
+{
+case 112: goto RULE_23;
+}
+RULE_22:
+{
+RULE_STATS_ATTEMPT(22)
+if(!doublePremise) { goto NEXT_22; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_22; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_22; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_22; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_22; }
+if(term2.atoms[1] != 48){ goto NEXT_22; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_22; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_22; }
+substitutions[31] = subtree;
+if(term2.atoms[4] != 39){ goto NEXT_22; }
+RULE_STATS_UNIFICATION(22)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 48;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_22; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_22; }
+conclusion.atoms[4] = 39;
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 22);}
+NEXT_22:
+RULE_STATS_END(22)
+switch(ruleClass)
+{
+case 121: goto RULE_24;
+}
+RULE_23:
+{
+RULE_STATS_ATTEMPT(23)
+if(!doublePremise) { goto NEXT_23; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_23; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_23; }
+substitutions[34] = subtree;
+if(term1.atoms[2] != 47){ goto NEXT_23; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_23; }
+substitutions[31] = subtree;
+if(term1.atoms[6] != 39){ goto NEXT_23; }
+if(term2.atoms[0] != 45){ goto NEXT_23; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_23; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_23; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(23)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_23; }
+conclusion.atoms[2] = 47;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_23; }
+conclusion.atoms[6] = 39;
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 23);}
+NEXT_23:
+RULE_STATS_END(23)
+switch(ruleClass)
+{
+case 112: goto RULE_95;
+}
+RULE_24:
+{
+RULE_STATS_ATTEMPT(24)
+if(!doublePremise) { goto NEXT_24; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_24; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_24; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_24; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_24; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_24; }
+substitutions[34] = subtree;
+if(term2.atoms[2] != 47){ goto NEXT_24; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_24; }
+substitutions[31] = subtree;
+if(term2.atoms[6] != 39){ goto NEXT_24; }
+RULE_STATS_UNIFICATION(24)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_24; }
+conclusion.atoms[2] = 47;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_24; }
+conclusion.atoms[6] = 39;
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 24);}
+NEXT_24:
+RULE_STATS_END(24)
+switch(ruleClass)
+{
+case 121: goto RULE_96;
+}
+RULE_25:
+{
+RULE_STATS_ATTEMPT(25)
+if(doublePremise) { goto NEXT_25; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_25; }
+if(term1.atoms[1] != 48){ goto NEXT_25; }
+if(term1.atoms[2] != 48){ goto NEXT_25; }
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_25; }
+substitutions[28] = subtree;
+if(term1.atoms[4] != 39){ goto NEXT_25; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_25; }
+substitutions[29] = subtree;
+if(term1.atoms[6] != 39){ goto NEXT_25; }
+RULE_STATS_UNIFICATION(25)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_25; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_25; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 25);}
+NEXT_25:
+RULE_STATS_END(25)
+switch(ruleClass)
+{
+}
+RULE_26:
+{
+RULE_STATS_ATTEMPT(26)
+if(doublePremise) { goto NEXT_26; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_26; }
+if(term1.atoms[1] != 47){ goto NEXT_26; }
+if(term1.atoms[2] != 47){ goto NEXT_26; }
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_26; }
+substitutions[28] = subtree;
+if(term1.atoms[4] != 39){ goto NEXT_26; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_26; }
+substitutions[29] = subtree;
+if(term1.atoms[6] != 39){ goto NEXT_26; }
+RULE_STATS_UNIFICATION(26)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_26; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_26; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 26);}
+NEXT_26:
+RULE_STATS_END(26)
+switch(ruleClass)
+{
+case 20: goto RULE_264;
+}
+RULE_27:
+{
+RULE_STATS_ATTEMPT(27)
+if(doublePremise) { goto NEXT_27; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_27; }
+if(term1.atoms[1] != 48){ goto NEXT_27; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_27; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_27; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_27; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(27)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 48;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_27; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_27; }
+conclusion.atoms[4] = 39;
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 27);}
+NEXT_27:
+RULE_STATS_END(27)
+switch(ruleClass)
+{
+}
+RULE_28:
+{
+RULE_STATS_ATTEMPT(28)
+if(doublePremise) { goto NEXT_28; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_28; }
+if(term1.atoms[1] != 48){ goto NEXT_28; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_28; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_28; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_28; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(28)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 48;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_28; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[29])){ goto NEXT_28; }
+conclusion.atoms[4] = 39;
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 28);}
+NEXT_28:
+RULE_STATS_END(28)
+switch(ruleClass)
+{
+}
+RULE_29:
+{
+RULE_STATS_ATTEMPT(29)
+if(doublePremise) { goto NEXT_29; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_29; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_29; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 47){ goto NEXT_29; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_29; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_29; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(29)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_29; }
+conclusion.atoms[2] = 47;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_29; }
+conclusion.atoms[6] = 39;
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 29);}
+NEXT_29:
+RULE_STATS_END(29)
+switch(ruleClass)
+{
+}
+RULE_30:
+{
+RULE_STATS_ATTEMPT(30)
+if(doublePremise) { goto NEXT_30; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_30; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_30; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 47){ goto NEXT_30; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_30; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_30; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(30)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_30; }
+conclusion.atoms[2] = 47;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[29])){ goto NEXT_30; }
+conclusion.atoms[6] = 39;
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 30);}
+NEXT_30:
+RULE_STATS_END(30)
+switch(ruleClass)
+{
+}
+RULE_31:
+{
+RULE_STATS_ATTEMPT(31)
+if(doublePremise) { goto NEXT_31; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_31; }
+if(term1.atoms[1] != 42){ goto NEXT_31; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_31; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_31; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_31; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(31)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_31; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_31; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 31);}
+NEXT_31:
+RULE_STATS_END(31)
+switch(ruleClass)
+{
+}
+RULE_32:
+{
+RULE_STATS_ATTEMPT(32)
+if(doublePremise) { goto NEXT_32; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_32; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_32; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 41){ goto NEXT_32; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_32; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_32; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(32)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_32; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_32; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 32);}
+NEXT_32:
+RULE_STATS_END(32)
+switch(ruleClass)
+{
+}
+RULE_33:
+{
+RULE_STATS_ATTEMPT(33)
+if(doublePremise) { goto NEXT_33; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_33; }
+if(term1.atoms[1] != 42){ goto NEXT_33; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_33; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_33; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_33; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(33)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_33; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_33; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 33);}
+NEXT_33:
+RULE_STATS_END(33)
+switch(ruleClass)
+{
+}
+RULE_34:
+{
+RULE_STATS_ATTEMPT(34)
+if(doublePremise) { goto NEXT_34; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_34; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_34; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 41){ goto NEXT_34; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_34; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_34; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(34)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_34; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_34; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 34);}
+NEXT_34:
+RULE_STATS_END(34)
+switch(ruleClass)
+{
+}
+RULE_35:
+{
+RULE_STATS_ATTEMPT(35)
+if(doublePremise) { goto NEXT_35; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_35; }
+if(term1.atoms[1] != 55){ goto NEXT_35; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_35; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_35; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_35; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(35)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_35; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_35; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 35);}
+NEXT_35:
+RULE_STATS_END(35)
+switch(ruleClass)
+{
+}
+RULE_36:
+{
+RULE_STATS_ATTEMPT(36)
+if(doublePremise) { goto NEXT_36; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_36; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_36; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 52){ goto NEXT_36; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_36; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_36; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(36)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_36; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_36; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 36);}
+NEXT_36:
+RULE_STATS_END(36)
+switch(ruleClass)
+{
+}
+RULE_37:
+{
+RULE_STATS_ATTEMPT(37)
+if(doublePremise) { goto NEXT_37; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_37; }
+if(term1.atoms[1] != 55){ goto NEXT_37; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_37; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_37; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_37; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(37)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_37; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_37; }
+Truth conclusionTruth = Truth_StructuralDeductionNegated(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 37);}
+NEXT_37:
+RULE_STATS_END(37)
+switch(ruleClass)
+{
+}
+RULE_38:
+{
+RULE_STATS_ATTEMPT(38)
+if(doublePremise) { goto NEXT_38; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_38; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_38; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 52){ goto NEXT_38; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_38; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_38; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(38)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_38; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_38; }
+Truth conclusionTruth = Truth_StructuralDeductionNegated(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 38);}
+NEXT_38:
+RULE_STATS_END(38)
+switch(ruleClass)
+{
+case 10: goto RULE_75;
+}
+RULE_39:
+{
+RULE_STATS_ATTEMPT(39)
+if(!doublePremise) { goto NEXT_39; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_39; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_39; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_39; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_39; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_39; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_39; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(39)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 42;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_39; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[34])){ goto NEXT_39; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_39; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 39);}
+NEXT_39:
+RULE_STATS_END(39)
+switch(ruleClass)
+{
+}
+RULE_40:
+{
+RULE_STATS_ATTEMPT(40)
+if(!doublePremise) { goto NEXT_40; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_40; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_40; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_40; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_40; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_40; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_40; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(40)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 42;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_40; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[34])){ goto NEXT_40; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_40; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 40);}
+NEXT_40:
+RULE_STATS_END(40)
+switch(ruleClass)
+{
+}
+RULE_41:
+{
+RULE_STATS_ATTEMPT(41)
+if(!doublePremise) { goto NEXT_41; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_41; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_41; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_41; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_41; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_41; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_41; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(41)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 41;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_41; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[34])){ goto NEXT_41; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_41; }
+Truth conclusionTruth = Truth_Union(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 41);}
+NEXT_41:
+RULE_STATS_END(41)
+switch(ruleClass)
+{
+}
+RULE_42:
+{
+RULE_STATS_ATTEMPT(42)
+if(!doublePremise) { goto NEXT_42; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_42; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_42; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_42; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_42; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_42; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_42; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(42)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 41;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_42; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[34])){ goto NEXT_42; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_42; }
+Truth conclusionTruth = Truth_Union(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 42);}
+NEXT_42:
+RULE_STATS_END(42)
+switch(ruleClass)
+{
+}
+RULE_43:
+{
+RULE_STATS_ATTEMPT(43)
+if(!doublePremise) { goto NEXT_43; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_43; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_43; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_43; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_43; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_43; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_43; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(43)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 55;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_43; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[34])){ goto NEXT_43; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_43; }
+Truth conclusionTruth = Truth_Difference(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 43);}
+NEXT_43:
+RULE_STATS_END(43)
+switch(ruleClass)
+{
+}
+RULE_44:
+{
+RULE_STATS_ATTEMPT(44)
+if(!doublePremise) { goto NEXT_44; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_44; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_44; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_44; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_44; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_44; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_44; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(44)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 55;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_44; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[34])){ goto NEXT_44; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_44; }
+Truth conclusionTruth = Truth_Difference(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 44);}
+NEXT_44:
+RULE_STATS_END(44)
+switch(ruleClass)
+{
+}
+RULE_45:
+{
+RULE_STATS_ATTEMPT(45)
+if(!doublePremise) { goto NEXT_45; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_45; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_45; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_45; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_45; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_45; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_45; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(45)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_45; }
+conclusion.atoms[2] = 41;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[34])){ goto NEXT_45; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_45; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 45);}
+NEXT_45:
+RULE_STATS_END(45)
+switch(ruleClass)
+{
+}
+RULE_46:
+{
+RULE_STATS_ATTEMPT(46)
+if(!doublePremise) { goto NEXT_46; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_46; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_46; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_46; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_46; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_46; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_46; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(46)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_46; }
+conclusion.atoms[2] = 41;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[34])){ goto NEXT_46; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_46; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 46);}
+NEXT_46:
+RULE_STATS_END(46)
+switch(ruleClass)
+{
+}
+RULE_47:
+{
+RULE_STATS_ATTEMPT(47)
+if(!doublePremise) { goto NEXT_47; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_47; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_47; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_47; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_47; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_47; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_47; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(47)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_47; }
+conclusion.atoms[2] = 42;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[34])){ goto NEXT_47; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_47; }
+Truth conclusionTruth = Truth_Union(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 47);}
+NEXT_47:
+RULE_STATS_END(47)
+switch(ruleClass)
+{
+}
+RULE_48:
+{
+RULE_STATS_ATTEMPT(48)
+if(!doublePremise) { goto NEXT_48; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_48; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_48; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_48; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_48; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_48; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_48; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(48)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_48; }
+conclusion.atoms[2] = 42;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[34])){ goto NEXT_48; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_48; }
+Truth conclusionTruth = Truth_Union(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 48);}
+NEXT_48:
+RULE_STATS_END(48)
+switch(ruleClass)
+{
+}
+RULE_49:
+{
+RULE_STATS_ATTEMPT(49)
+if(!doublePremise) { goto NEXT_49; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_49; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_49; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_49; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_49; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_49; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_49; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(49)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_49; }
+conclusion.atoms[2] = 52;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[34])){ goto NEXT_49; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_49; }
+Truth conclusionTruth = Truth_Difference(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 49);}
+NEXT_49:
+RULE_STATS_END(49)
+switch(ruleClass)
+{
+}
+RULE_50:
+{
+RULE_STATS_ATTEMPT(50)
+if(!doublePremise) { goto NEXT_50; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_50; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_50; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_50; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_50; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_50; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_50; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(50)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_50; }
+conclusion.atoms[2] = 52;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[34])){ goto NEXT_50; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_50; }
+Truth conclusionTruth = Truth_Difference(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 50);}
+NEXT_50:
+RULE_STATS_END(50)
+switch(ruleClass)
+{
+}
+RULE_51:
+{
+RULE_STATS_ATTEMPT(51)
+if(!doublePremise) { goto NEXT_51; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_51; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_51; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_51; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_51; }
+if(term2.atoms[1] != 42){ goto NEXT_51; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_51; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_51; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_51; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(51)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_51; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_51; }
+Truth conclusionTruth = Truth_DecomposePNN(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 51);}
+NEXT_51:
+RULE_STATS_END(51)
+switch(ruleClass)
+{
+}
+RULE_52:
+{
+RULE_STATS_ATTEMPT(52)
+if(!doublePremise) { goto NEXT_52; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_52; }
+if(term1.atoms[1] != 42){ goto NEXT_52; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_52; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_52; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_52; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_52; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_52; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_52; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(52)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_52; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_52; }
+Truth conclusionTruth = Truth_DecomposePNN(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 52);}
+NEXT_52:
+RULE_STATS_END(52)
+switch(ruleClass)
+{
+}
+RULE_53:
+{
+RULE_STATS_ATTEMPT(53)
+if(!doublePremise) { goto NEXT_53; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_53; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_53; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_53; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_53; }
+if(term2.atoms[1] != 42){ goto NEXT_53; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_53; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_53; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_53; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(53)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_53; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_53; }
+Truth conclusionTruth = Truth_DecomposePNN(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 53);}
+NEXT_53:
+RULE_STATS_END(53)
+switch(ruleClass)
+{
+}
+RULE_54:
+{
+RULE_STATS_ATTEMPT(54)
+if(!doublePremise) { goto NEXT_54; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_54; }
+if(term1.atoms[1] != 42){ goto NEXT_54; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_54; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_54; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_54; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_54; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_54; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_54; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(54)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_54; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_54; }
+Truth conclusionTruth = Truth_DecomposePNN(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 54);}
+NEXT_54:
+RULE_STATS_END(54)
+switch(ruleClass)
+{
+}
+RULE_55:
+{
+RULE_STATS_ATTEMPT(55)
+if(!doublePremise) { goto NEXT_55; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_55; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_55; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_55; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_55; }
+if(term2.atoms[1] != 41){ goto NEXT_55; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_55; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_55; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_55; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(55)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_55; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_55; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 55);}
+NEXT_55:
+RULE_STATS_END(55)
+switch(ruleClass)
+{
+}
+RULE_56:
+{
+RULE_STATS_ATTEMPT(56)
+if(!doublePremise) { goto NEXT_56; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_56; }
+if(term1.atoms[1] != 41){ goto NEXT_56; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_56; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_56; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_56; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_56; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_56; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_56; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(56)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_56; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_56; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 56);}
+NEXT_56:
+RULE_STATS_END(56)
+switch(ruleClass)
+{
+}
+RULE_57:
+{
+RULE_STATS_ATTEMPT(57)
+if(!doublePremise) { goto NEXT_57; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_57; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_57; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_57; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_57; }
+if(term2.atoms[1] != 41){ goto NEXT_57; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_57; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_57; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_57; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(57)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_57; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_57; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 57);}
+NEXT_57:
+RULE_STATS_END(57)
+switch(ruleClass)
+{
+}
+RULE_58:
+{
+RULE_STATS_ATTEMPT(58)
+if(!doublePremise) { goto NEXT_58; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_58; }
+if(term1.atoms[1] != 41){ goto NEXT_58; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_58; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_58; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_58; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_58; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_58; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_58; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(58)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_58; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_58; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 58);}
+NEXT_58:
+RULE_STATS_END(58)
+switch(ruleClass)
+{
+}
+RULE_59:
+{
+RULE_STATS_ATTEMPT(59)
+if(!doublePremise) { goto NEXT_59; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_59; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_59; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_59; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_59; }
+if(term2.atoms[1] != 55){ goto NEXT_59; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_59; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_59; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_59; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(59)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_59; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_59; }
+Truth conclusionTruth = Truth_DecomposePNP(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 59);}
+NEXT_59:
+RULE_STATS_END(59)
+switch(ruleClass)
+{
+}
+RULE_60:
+{
+RULE_STATS_ATTEMPT(60)
+if(!doublePremise) { goto NEXT_60; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_60; }
+if(term1.atoms[1] != 55){ goto NEXT_60; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_60; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_60; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_60; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_60; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_60; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_60; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(60)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_60; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_60; }
+Truth conclusionTruth = Truth_DecomposePNP(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 60);}
+NEXT_60:
+RULE_STATS_END(60)
+switch(ruleClass)
+{
+}
+RULE_61:
+{
+RULE_STATS_ATTEMPT(61)
+if(!doublePremise) { goto NEXT_61; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_61; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_61; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_61; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_61; }
+if(term2.atoms[1] != 55){ goto NEXT_61; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_61; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_61; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_61; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(61)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_61; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_61; }
+Truth conclusionTruth = Truth_DecomposeNNN(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 61);}
+NEXT_61:
+RULE_STATS_END(61)
+switch(ruleClass)
+{
+}
+RULE_62:
+{
+RULE_STATS_ATTEMPT(62)
+if(!doublePremise) { goto NEXT_62; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_62; }
+if(term1.atoms[1] != 55){ goto NEXT_62; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_62; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_62; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_62; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_62; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_62; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_62; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(62)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_62; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_62; }
+Truth conclusionTruth = Truth_DecomposeNNN(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 62);}
+NEXT_62:
+RULE_STATS_END(62)
+switch(ruleClass)
+{
+}
+RULE_63:
+{
+RULE_STATS_ATTEMPT(63)
+if(!doublePremise) { goto NEXT_63; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_63; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_63; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_63; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_63; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_63; }
+substitutions[31] = subtree;
+if(term2.atoms[2] != 41){ goto NEXT_63; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_63; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_63; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(63)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_63; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_63; }
+Truth conclusionTruth = Truth_DecomposePNN(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 63);}
+NEXT_63:
+RULE_STATS_END(63)
+switch(ruleClass)
+{
+}
+RULE_64:
+{
+RULE_STATS_ATTEMPT(64)
+if(!doublePremise) { goto NEXT_64; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_64; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_64; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 41){ goto NEXT_64; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_64; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_64; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_64; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_64; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_64; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(64)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_64; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_64; }
+Truth conclusionTruth = Truth_DecomposePNN(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 64);}
+NEXT_64:
+RULE_STATS_END(64)
+switch(ruleClass)
+{
+}
+RULE_65:
+{
+RULE_STATS_ATTEMPT(65)
+if(!doublePremise) { goto NEXT_65; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_65; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_65; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_65; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_65; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_65; }
+substitutions[31] = subtree;
+if(term2.atoms[2] != 41){ goto NEXT_65; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_65; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_65; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(65)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_65; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_65; }
+Truth conclusionTruth = Truth_DecomposePNN(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 65);}
+NEXT_65:
+RULE_STATS_END(65)
+switch(ruleClass)
+{
+}
+RULE_66:
+{
+RULE_STATS_ATTEMPT(66)
+if(!doublePremise) { goto NEXT_66; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_66; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_66; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 41){ goto NEXT_66; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_66; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_66; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_66; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_66; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_66; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(66)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_66; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_66; }
+Truth conclusionTruth = Truth_DecomposePNN(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 66);}
+NEXT_66:
+RULE_STATS_END(66)
+switch(ruleClass)
+{
+}
+RULE_67:
+{
+RULE_STATS_ATTEMPT(67)
+if(!doublePremise) { goto NEXT_67; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_67; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_67; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_67; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_67; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_67; }
+substitutions[31] = subtree;
+if(term2.atoms[2] != 42){ goto NEXT_67; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_67; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_67; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(67)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_67; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_67; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 67);}
+NEXT_67:
+RULE_STATS_END(67)
+switch(ruleClass)
+{
+}
+RULE_68:
+{
+RULE_STATS_ATTEMPT(68)
+if(!doublePremise) { goto NEXT_68; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_68; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_68; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 42){ goto NEXT_68; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_68; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_68; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_68; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_68; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_68; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(68)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_68; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_68; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 68);}
+NEXT_68:
+RULE_STATS_END(68)
+switch(ruleClass)
+{
+}
+RULE_69:
+{
+RULE_STATS_ATTEMPT(69)
+if(!doublePremise) { goto NEXT_69; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_69; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_69; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_69; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_69; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_69; }
+substitutions[31] = subtree;
+if(term2.atoms[2] != 42){ goto NEXT_69; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_69; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_69; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(69)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_69; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_69; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 69);}
+NEXT_69:
+RULE_STATS_END(69)
+switch(ruleClass)
+{
+}
+RULE_70:
+{
+RULE_STATS_ATTEMPT(70)
+if(!doublePremise) { goto NEXT_70; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_70; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_70; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 42){ goto NEXT_70; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_70; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_70; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_70; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_70; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_70; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(70)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_70; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_70; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 70);}
+NEXT_70:
+RULE_STATS_END(70)
+switch(ruleClass)
+{
+}
+RULE_71:
+{
+RULE_STATS_ATTEMPT(71)
+if(!doublePremise) { goto NEXT_71; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_71; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_71; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_71; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_71; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_71; }
+substitutions[31] = subtree;
+if(term2.atoms[2] != 52){ goto NEXT_71; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_71; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_71; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(71)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_71; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_71; }
+Truth conclusionTruth = Truth_DecomposePNP(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 71);}
+NEXT_71:
+RULE_STATS_END(71)
+switch(ruleClass)
+{
+}
+RULE_72:
+{
+RULE_STATS_ATTEMPT(72)
+if(!doublePremise) { goto NEXT_72; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_72; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_72; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 52){ goto NEXT_72; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_72; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_72; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_72; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_72; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_72; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(72)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_72; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_72; }
+Truth conclusionTruth = Truth_DecomposePNP(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 72);}
+NEXT_72:
+RULE_STATS_END(72)
+switch(ruleClass)
+{
+}
+RULE_73:
+{
+RULE_STATS_ATTEMPT(73)
+if(!doublePremise) { goto NEXT_73; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_73; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_73; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_73; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_73; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_73; }
+substitutions[31] = subtree;
+if(term2.atoms[2] != 52){ goto NEXT_73; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_73; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_73; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(73)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_73; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_73; }
+Truth conclusionTruth = Truth_DecomposeNNN(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 73);}
+NEXT_73:
+RULE_STATS_END(73)
+switch(ruleClass)
+{
+}
+RULE_74:
+{
+RULE_STATS_ATTEMPT(74)
+if(!doublePremise) { goto NEXT_74; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_74; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_74; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 52){ goto NEXT_74; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_74; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_74; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_74; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_74; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_74; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(74)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_74; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_74; }
+Truth conclusionTruth = Truth_DecomposeNNN(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 74);}
+NEXT_74:
+RULE_STATS_END(74)
+switch(ruleClass)
+{
+case 111: goto RULE_83;
+}
+RULE_75:
+{
+RULE_STATS_ATTEMPT(75)
+if(doublePremise) { goto NEXT_75; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_75; }
+if(term1.atoms[1] != 40){ goto NEXT_75; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_75; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_75; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_75; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(75)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_75; }
+conclusion.atoms[2] = 49;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[32])){ goto NEXT_75; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_75; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 75);}
+NEXT_75:
+RULE_STATS_END(75)
+switch(ruleClass)
+{
+}
+RULE_76:
+{
+RULE_STATS_ATTEMPT(76)
+if(doublePremise) { goto NEXT_76; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_76; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_76; }
+substitutions[28] = subtree;
+if(term1.atoms[2] != 49){ goto NEXT_76; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_76; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_76; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(76)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_76; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_76; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_76; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 76);}
+NEXT_76:
+RULE_STATS_END(76)
+switch(ruleClass)
+{
+}
+RULE_77:
+{
+RULE_STATS_ATTEMPT(77)
+if(doublePremise) { goto NEXT_77; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_77; }
+if(term1.atoms[1] != 40){ goto NEXT_77; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_77; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_77; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_77; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(77)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_77; }
+conclusion.atoms[2] = 53;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[32])){ goto NEXT_77; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[28])){ goto NEXT_77; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 77);}
+NEXT_77:
+RULE_STATS_END(77)
+switch(ruleClass)
+{
+}
+RULE_78:
+{
+RULE_STATS_ATTEMPT(78)
+if(doublePremise) { goto NEXT_78; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_78; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_78; }
+substitutions[29] = subtree;
+if(term1.atoms[2] != 53){ goto NEXT_78; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_78; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_78; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(78)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_78; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_78; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_78; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 78);}
+NEXT_78:
+RULE_STATS_END(78)
+switch(ruleClass)
+{
+}
+RULE_79:
+{
+RULE_STATS_ATTEMPT(79)
+if(doublePremise) { goto NEXT_79; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_79; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_79; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_79; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_79; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_79; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(79)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 50;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_79; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[32])){ goto NEXT_79; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_79; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 79);}
+NEXT_79:
+RULE_STATS_END(79)
+switch(ruleClass)
+{
+}
+RULE_80:
+{
+RULE_STATS_ATTEMPT(80)
+if(doublePremise) { goto NEXT_80; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_80; }
+if(term1.atoms[1] != 50){ goto NEXT_80; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_80; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_80; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_80; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(80)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_80; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_80; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_80; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 80);}
+NEXT_80:
+RULE_STATS_END(80)
+switch(ruleClass)
+{
+}
+RULE_81:
+{
+RULE_STATS_ATTEMPT(81)
+if(doublePremise) { goto NEXT_81; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_81; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_81; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_81; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_81; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_81; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(81)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 54;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_81; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[32])){ goto NEXT_81; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[28])){ goto NEXT_81; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 81);}
+NEXT_81:
+RULE_STATS_END(81)
+switch(ruleClass)
+{
+}
+RULE_82:
+{
+RULE_STATS_ATTEMPT(82)
+if(doublePremise) { goto NEXT_82; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_82; }
+if(term1.atoms[1] != 54){ goto NEXT_82; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_82; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_82; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_82; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(82)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_82; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_82; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_82; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 82);}
+NEXT_82:
+RULE_STATS_END(82)
+switch(ruleClass)
+{
+case 10: goto RULE_264;
+}
+RULE_83:
+{
+RULE_STATS_ATTEMPT(83)
+if(!doublePremise) { goto NEXT_83; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_83; }
+if(term1.atoms[1] != 40){ goto NEXT_83; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_83; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_83; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_83; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_83; }
+if(term2.atoms[1] != 40){ goto NEXT_83; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_83; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_83; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_83; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(83)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_83; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_83; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 83);}
+NEXT_83:
+RULE_STATS_END(83)
+switch(ruleClass)
+{
+}
+RULE_84:
+{
+RULE_STATS_ATTEMPT(84)
+if(!doublePremise) { goto NEXT_84; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_84; }
+if(term1.atoms[1] != 40){ goto NEXT_84; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_84; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_84; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_84; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_84; }
+if(term2.atoms[1] != 40){ goto NEXT_84; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_84; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_84; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_84; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(84)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_84; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_84; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 84);}
+NEXT_84:
+RULE_STATS_END(84)
+switch(ruleClass)
+{
+}
+RULE_85:
+{
+RULE_STATS_ATTEMPT(85)
+if(!doublePremise) { goto NEXT_85; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_85; }
+if(term1.atoms[1] != 40){ goto NEXT_85; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_85; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_85; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_85; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_85; }
+if(term2.atoms[1] != 40){ goto NEXT_85; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_85; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_85; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_85; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(85)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_85; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_85; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 85);}
+NEXT_85:
+RULE_STATS_END(85)
+switch(ruleClass)
+{
+}
+RULE_86:
+{
+RULE_STATS_ATTEMPT(86)
+if(!doublePremise) { goto NEXT_86; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_86; }
+if(term1.atoms[1] != 40){ goto NEXT_86; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_86; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_86; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_86; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_86; }
+if(term2.atoms[1] != 40){ goto NEXT_86; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_86; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_86; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_86; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(86)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_86; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_86; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 86);}
+NEXT_86:
+RULE_STATS_END(86)
+switch(ruleClass)
+{
+}
+RULE_87:
+{
+RULE_STATS_ATTEMPT(87)
+if(!doublePremise) { goto NEXT_87; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_87; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_87; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_87; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_87; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_87; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_87; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_87; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_87; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_87; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_87; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(87)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_87; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_87; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 87);}
+NEXT_87:
+RULE_STATS_END(87)
+switch(ruleClass)
+{
+}
+RULE_88:
+{
+RULE_STATS_ATTEMPT(88)
+if(!doublePremise) { goto NEXT_88; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_88; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_88; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_88; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_88; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_88; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_88; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_88; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_88; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_88; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_88; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(88)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_88; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_88; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 88);}
+NEXT_88:
+RULE_STATS_END(88)
+switch(ruleClass)
+{
+}
+RULE_89:
+{
+RULE_STATS_ATTEMPT(89)
+if(!doublePremise) { goto NEXT_89; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_89; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_89; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_89; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_89; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_89; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_89; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_89; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_89; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_89; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_89; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(89)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_89; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_89; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 89);}
+NEXT_89:
+RULE_STATS_END(89)
+switch(ruleClass)
+{
+}
+RULE_90:
+{
+RULE_STATS_ATTEMPT(90)
+if(!doublePremise) { goto NEXT_90; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_90; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_90; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_90; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_90; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_90; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_90; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_90; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_90; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_90; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_90; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(90)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_90; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_90; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 90);}
+NEXT_90:
+RULE_STATS_END(90)
+switch(ruleClass)
+{
+}
+RULE_91:
+{
+RULE_STATS_ATTEMPT(91)
+if(!doublePremise) { goto NEXT_91; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_91; }
+if(term1.atoms[1] != 40){ goto NEXT_91; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_91; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_91; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_91; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_91; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_91; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_91; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(91)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_91; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_91; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_91; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 91);}
+NEXT_91:
+RULE_STATS_END(91)
+switch(ruleClass)
+{
+}
+RULE_92:
+{
+RULE_STATS_ATTEMPT(92)
+if(!doublePremise) { goto NEXT_92; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_92; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_92; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_92; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_92; }
+if(term2.atoms[1] != 40){ goto NEXT_92; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_92; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_92; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_92; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(92)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_92; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_92; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_92; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 92);}
+NEXT_92:
+RULE_STATS_END(92)
+switch(ruleClass)
+{
+}
+RULE_93:
+{
+RULE_STATS_ATTEMPT(93)
+if(!doublePremise) { goto NEXT_93; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_93; }
+if(term1.atoms[1] != 40){ goto NEXT_93; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_93; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_93; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_93; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_93; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_93; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_93; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(93)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_93; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_93; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_93; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 93);}
+NEXT_93:
+RULE_STATS_END(93)
+switch(ruleClass)
+{
+}
+RULE_94:
+{
+RULE_STATS_ATTEMPT(94)
+if(!doublePremise) { goto NEXT_94; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_94; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_94; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_94; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_94; }
+if(term2.atoms[1] != 40){ goto NEXT_94; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_94; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_94; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_94; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(94)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_94; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_94; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_94; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 94);}
+NEXT_94:
+RULE_STATS_END(94)
+switch(ruleClass)
+{
+case 111: goto RULE_97;
+}
+RULE_95:
+{
+RULE_STATS_ATTEMPT(95)
+if(!doublePremise) { goto NEXT_95; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_95; }
+if(term1.atoms[1] != 40){ goto NEXT_95; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_95; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_95; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_95; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_95; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_95; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_95; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(95)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_95; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_95; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_95; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 95);}
+NEXT_95:
+RULE_STATS_END(95)
+switch(ruleClass)
+{
+case 112: goto RULE_101;
+}
+RULE_96:
+{
+RULE_STATS_ATTEMPT(96)
+if(!doublePremise) { goto NEXT_96; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_96; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_96; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_96; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_96; }
+if(term2.atoms[1] != 40){ goto NEXT_96; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_96; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_96; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_96; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(96)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_96; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_96; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_96; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 96);}
+NEXT_96:
+RULE_STATS_END(96)
+switch(ruleClass)
+{
+case 121: goto RULE_102;
+}
+RULE_97:
+{
+RULE_STATS_ATTEMPT(97)
+if(!doublePremise) { goto NEXT_97; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_97; }
+if(term1.atoms[1] != 40){ goto NEXT_97; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_97; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_97; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_97; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_97; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_97; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_97; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(97)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_97; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_97; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_97; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 97);}
+NEXT_97:
+RULE_STATS_END(97)
+switch(ruleClass)
+{
+}
+RULE_98:
+{
+RULE_STATS_ATTEMPT(98)
+if(!doublePremise) { goto NEXT_98; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_98; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_98; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_98; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_98; }
+if(term2.atoms[1] != 40){ goto NEXT_98; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_98; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_98; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_98; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(98)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_98; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_98; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_98; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 98);}
+NEXT_98:
+RULE_STATS_END(98)
+switch(ruleClass)
+{
+}
+RULE_99:
+{
+RULE_STATS_ATTEMPT(99)
+if(!doublePremise) { goto NEXT_99; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_99; }
+if(term1.atoms[1] != 40){ goto NEXT_99; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_99; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_99; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_99; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_99; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_99; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_99; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(99)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_99; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_99; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_99; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 99);}
+NEXT_99:
+RULE_STATS_END(99)
+switch(ruleClass)
+{
+}
+RULE_100:
+{
+RULE_STATS_ATTEMPT(100)
+if(!doublePremise) { goto NEXT_100; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_100; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_100; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_100; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_100; }
+if(term2.atoms[1] != 40){ goto NEXT_100; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_100; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_100; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_100; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(100)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_100; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_100; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_100; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 100);}
+NEXT_100:
+RULE_STATS_END(100)
+switch(ruleClass)
+{
+case 111: goto RULE_103;
+}
+RULE_101:
+{
+RULE_STATS_ATTEMPT(101)
+if(!doublePremise) { goto NEXT_101; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_101; }
+if(term1.atoms[1] != 40){ goto NEXT_101; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_101; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_101; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_101; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_101; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_101; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_101; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(101)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_101; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_101; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_101; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 101);}
+NEXT_101:
+RULE_STATS_END(101)
+switch(ruleClass)
+{
+case 112: goto RULE_107;
+}
+RULE_102:
+{
+RULE_STATS_ATTEMPT(102)
+if(!doublePremise) { goto NEXT_102; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_102; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_102; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_102; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_102; }
+if(term2.atoms[1] != 40){ goto NEXT_102; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_102; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_102; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_102; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(102)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 40;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[32])){ goto NEXT_102; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_102; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_102; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 102);}
+NEXT_102:
+RULE_STATS_END(102)
+switch(ruleClass)
+{
+case 121: goto RULE_108;
+}
+RULE_103:
+{
+RULE_STATS_ATTEMPT(103)
+if(!doublePremise) { goto NEXT_103; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_103; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_103; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_103; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_103; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_103; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_103; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_103; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_103; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(103)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_103; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_103; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_103; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 103);}
+NEXT_103:
+RULE_STATS_END(103)
+switch(ruleClass)
+{
+}
+RULE_104:
+{
+RULE_STATS_ATTEMPT(104)
+if(!doublePremise) { goto NEXT_104; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_104; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_104; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_104; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_104; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_104; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_104; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_104; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_104; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(104)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_104; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_104; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_104; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 104);}
+NEXT_104:
+RULE_STATS_END(104)
+switch(ruleClass)
+{
+}
+RULE_105:
+{
+RULE_STATS_ATTEMPT(105)
+if(!doublePremise) { goto NEXT_105; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_105; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_105; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_105; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_105; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_105; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_105; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_105; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_105; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(105)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_105; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_105; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_105; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 105);}
+NEXT_105:
+RULE_STATS_END(105)
+switch(ruleClass)
+{
+}
+RULE_106:
+{
+RULE_STATS_ATTEMPT(106)
+if(!doublePremise) { goto NEXT_106; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_106; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_106; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_106; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_106; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_106; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_106; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_106; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_106; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(106)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_106; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_106; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_106; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 106);}
+NEXT_106:
+RULE_STATS_END(106)
+switch(ruleClass)
+{
+case 111: goto RULE_109;
+}
+RULE_107:
+{
+RULE_STATS_ATTEMPT(107)
+if(!doublePremise) { goto NEXT_107; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_107; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_107; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_107; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_107; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_107; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_107; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_107; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_107; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(107)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_107; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_107; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_107; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 107);}
+NEXT_107:
+RULE_STATS_END(107)
+switch(ruleClass)
+{
+case 112: goto RULE_113;
+}
+RULE_108:
+{
+RULE_STATS_ATTEMPT(108)
+if(!doublePremise) { goto NEXT_108; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_108; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_108; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_108; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_108; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_108; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_108; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_108; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_108; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(108)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_108; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_108; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_108; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 108);}
+NEXT_108:
+RULE_STATS_END(108)
+switch(ruleClass)
+{
+case 121: goto RULE_114;
+}
+RULE_109:
+{
+RULE_STATS_ATTEMPT(109)
+if(!doublePremise) { goto NEXT_109; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_109; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_109; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_109; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_109; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_109; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_109; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_109; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_109; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(109)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_109; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_109; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_109; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 109);}
+NEXT_109:
+RULE_STATS_END(109)
+switch(ruleClass)
+{
+}
+RULE_110:
+{
+RULE_STATS_ATTEMPT(110)
+if(!doublePremise) { goto NEXT_110; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_110; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_110; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_110; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_110; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_110; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_110; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_110; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_110; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(110)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_110; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_110; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_110; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 110);}
+NEXT_110:
+RULE_STATS_END(110)
+switch(ruleClass)
+{
+}
+RULE_111:
+{
+RULE_STATS_ATTEMPT(111)
+if(!doublePremise) { goto NEXT_111; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_111; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_111; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_111; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_111; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_111; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_111; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_111; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_111; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(111)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_111; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_111; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_111; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 111);}
+NEXT_111:
+RULE_STATS_END(111)
+switch(ruleClass)
+{
+}
+RULE_112:
+{
+RULE_STATS_ATTEMPT(112)
+if(!doublePremise) { goto NEXT_112; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_112; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_112; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_112; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_112; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_112; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_112; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_112; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_112; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(112)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_112; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_112; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_112; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 112);}
+NEXT_112:
+RULE_STATS_END(112)
+switch(ruleClass)
+{
+case 111: goto RULE_115;
+}
+RULE_113:
+{
+RULE_STATS_ATTEMPT(113)
+if(!doublePremise) { goto NEXT_113; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_113; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_113; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_113; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_113; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_113; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_113; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_113; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_113; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(113)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_113; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_113; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_113; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 113);}
+NEXT_113:
+RULE_STATS_END(113)
+switch(ruleClass)
+{
+case 112: goto RULE_264;
+}
+RULE_114:
+{
+RULE_STATS_ATTEMPT(114)
+if(!doublePremise) { goto NEXT_114; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_114; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_114; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_114; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_114; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_114; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_114; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_114; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_114; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(114)
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[32])){ goto NEXT_114; }
+conclusion.atoms[2] = 40;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_114; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_114; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 114);}
+NEXT_114:
+RULE_STATS_END(114)
+switch(ruleClass)
+{
+case 121: goto RULE_264;
+}
+RULE_115:
+{
+RULE_STATS_ATTEMPT(115)
+if(!doublePremise) { goto NEXT_115; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_115; }
+if(term1.atoms[1] != 40){ goto NEXT_115; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_115; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_115; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_115; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_115; }
+if(term2.atoms[1] != 40){ goto NEXT_115; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_115; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_115; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_115; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(115)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_115; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_115; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 115);}
+NEXT_115:
+RULE_STATS_END(115)
+switch(ruleClass)
+{
+}
+RULE_116:
+{
+RULE_STATS_ATTEMPT(116)
+if(!doublePremise) { goto NEXT_116; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_116; }
+if(term1.atoms[1] != 40){ goto NEXT_116; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_116; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_116; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_116; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_116; }
+if(term2.atoms[1] != 40){ goto NEXT_116; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_116; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_116; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_116; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(116)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_116; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_116; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 116);}
+NEXT_116:
+RULE_STATS_END(116)
+switch(ruleClass)
+{
+}
+RULE_117:
+{
+RULE_STATS_ATTEMPT(117)
+if(!doublePremise) { goto NEXT_117; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_117; }
+if(term1.atoms[1] != 40){ goto NEXT_117; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_117; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_117; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_117; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_117; }
+if(term2.atoms[1] != 40){ goto NEXT_117; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_117; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_117; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_117; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(117)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_117; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_117; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 117);}
+NEXT_117:
+RULE_STATS_END(117)
+switch(ruleClass)
+{
+}
+RULE_118:
+{
+RULE_STATS_ATTEMPT(118)
+if(!doublePremise) { goto NEXT_118; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_118; }
+if(term1.atoms[1] != 40){ goto NEXT_118; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_118; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_118; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_118; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_118; }
+if(term2.atoms[1] != 40){ goto NEXT_118; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_118; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_118; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_118; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(118)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_118; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_118; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 118);}
+NEXT_118:
+RULE_STATS_END(118)
+switch(ruleClass)
+{
+}
+RULE_119:
+{
+RULE_STATS_ATTEMPT(119)
+if(!doublePremise) { goto NEXT_119; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_119; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_119; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_119; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_119; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_119; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_119; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_119; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_119; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_119; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_119; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(119)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_119; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_119; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 119);}
+NEXT_119:
+RULE_STATS_END(119)
+switch(ruleClass)
+{
+}
+RULE_120:
+{
+RULE_STATS_ATTEMPT(120)
+if(!doublePremise) { goto NEXT_120; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_120; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_120; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_120; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_120; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_120; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_120; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_120; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_120; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_120; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_120; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(120)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_120; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_120; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 120);}
+NEXT_120:
+RULE_STATS_END(120)
+switch(ruleClass)
+{
+}
+RULE_121:
+{
+RULE_STATS_ATTEMPT(121)
+if(!doublePremise) { goto NEXT_121; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_121; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_121; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_121; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_121; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_121; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_121; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_121; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_121; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_121; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_121; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(121)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_121; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_121; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 121);}
+NEXT_121:
+RULE_STATS_END(121)
+switch(ruleClass)
+{
+}
+RULE_122:
+{
+RULE_STATS_ATTEMPT(122)
+if(!doublePremise) { goto NEXT_122; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_122; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_122; }
+substitutions[32] = subtree;
+if(term1.atoms[2] != 40){ goto NEXT_122; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_122; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_122; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_122; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_122; }
+substitutions[32] = subtree;
+if(term2.atoms[2] != 40){ goto NEXT_122; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_122; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_122; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(122)
+Term conclusion = {0};
+conclusion.atoms[0] = 45;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_122; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_122; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 122);}
+NEXT_122:
+RULE_STATS_END(122)
+switch(ruleClass)
+{
+case 111: goto RULE_172;
+}
+RULE_123:
+{
+RULE_STATS_ATTEMPT(123)
+if(doublePremise) { goto NEXT_123; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 57){ goto NEXT_123; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_123; }
+substitutions[28] = subtree;
+if(term1.atoms[2] != 39){ goto NEXT_123; }
+RULE_STATS_UNIFICATION(123)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_123; }
+Truth conclusionTruth = Truth_Negation(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 123);}
+NEXT_123:
+RULE_STATS_END(123)
+switch(ruleClass)
+{
+case 30: goto RULE_264;
+}
+RULE_124:
+{
+RULE_STATS_ATTEMPT(124)
+if(doublePremise) { goto NEXT_124; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 43){ goto NEXT_124; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_124; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_124; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(124)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_124; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 124);}
+NEXT_124:
+RULE_STATS_END(124)
+switch(ruleClass)
+{
+}
+RULE_125:
+{
+RULE_STATS_ATTEMPT(125)
+if(doublePremise) { goto NEXT_125; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 43){ goto NEXT_125; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_125; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_125; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(125)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[29])){ goto NEXT_125; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 125);}
+NEXT_125:
+RULE_STATS_END(125)
+switch(ruleClass)
+{
+}
+RULE_126:
+{
+RULE_STATS_ATTEMPT(126)
+if(doublePremise) { goto NEXT_126; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 43){ goto NEXT_126; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_126; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_126; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(126)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_126; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_126; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 126);}
+NEXT_126:
+RULE_STATS_END(126)
+switch(ruleClass)
+{
+case 40: goto RULE_264;
+}
+RULE_127:
+{
+RULE_STATS_ATTEMPT(127)
+if(!doublePremise) { goto NEXT_127; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+subtree = Term_ExtractSubterm(&term1, 0);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_127; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 43){ goto NEXT_127; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_127; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_127; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(127)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_127; }
+Truth conclusionTruth = Truth_DecomposePNN(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 127);}
+NEXT_127:
+RULE_STATS_END(127)
+switch(ruleClass)
+{
+case 103: goto RULE_131;
+case 113: goto RULE_131;
+case 123: goto RULE_131;
+case 133: goto RULE_131;
+case 153: goto RULE_130;
+case 163: goto RULE_131;
+case 173: goto RULE_131;
+case 183: goto RULE_131;
+case 193: goto RULE_131;
+}
+RULE_128:
+{
+RULE_STATS_ATTEMPT(128)
+if(!doublePremise) { goto NEXT_128; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 43){ goto NEXT_128; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_128; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_128; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 0);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_128; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(128)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_128; }
+Truth conclusionTruth = Truth_DecomposePNN(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 128);}
+NEXT_128:
+RULE_STATS_END(128)
+switch(ruleClass)
+{
+case 140: goto RULE_132;
+case 141: goto RULE_132;
+case 142: goto RULE_132;
+case 143: goto RULE_131;
+case 145: goto RULE_132;
+case 146: goto RULE_132;
+case 147: goto RULE_132;
+case 148: goto RULE_132;
+case 149: goto RULE_132;
+}
+RULE_129:
+{
+RULE_STATS_ATTEMPT(129)
+if(!doublePremise) { goto NEXT_129; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+subtree = Term_ExtractSubterm(&term1, 0);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_129; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 60){ goto NEXT_129; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_129; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_129; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(129)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_129; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 129);}
+NEXT_129:
+RULE_STATS_END(129)
+switch(ruleClass)
+{
+case 104: goto RULE_133;
+case 114: goto RULE_133;
+case 124: goto RULE_133;
+case 134: goto RULE_133;
+case 144: goto RULE_132;
+case 164: goto RULE_133;
+case 174: goto RULE_133;
+case 184: goto RULE_133;
+case 194: goto RULE_133;
+}
+RULE_130:
+{
+RULE_STATS_ATTEMPT(130)
+if(!doublePremise) { goto NEXT_130; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 60){ goto NEXT_130; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_130; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_130; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 0);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_130; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(130)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_130; }
+Truth conclusionTruth = Truth_DecomposeNPP(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 130);}
+NEXT_130:
+RULE_STATS_END(130)
+switch(ruleClass)
+{
+case 150: goto RULE_134;
+case 151: goto RULE_134;
+case 152: goto RULE_134;
+case 154: goto RULE_133;
+case 155: goto RULE_134;
+case 156: goto RULE_134;
+case 157: goto RULE_134;
+case 158: goto RULE_134;
+case 159: goto RULE_134;
+}
+RULE_131:
+{
+RULE_STATS_ATTEMPT(131)
+if(!doublePremise) { goto NEXT_131; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+subtree = Term_ExtractSubterm(&term1, 0);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_131; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 43){ goto NEXT_131; }
+if(term2.atoms[1] != 57){ goto NEXT_131; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_131; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_131; }
+substitutions[33] = subtree;
+if(term2.atoms[4] != 39){ goto NEXT_131; }
+RULE_STATS_UNIFICATION(131)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_131; }
+Truth conclusionTruth = Truth_DecomposeNNN(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 131);}
+NEXT_131:
+RULE_STATS_END(131)
+switch(ruleClass)
+{
+case 103: goto RULE_187;
+case 113: goto RULE_187;
+case 123: goto RULE_187;
+case 133: goto RULE_187;
+case 153: goto RULE_134;
+case 163: goto RULE_184;
+case 173: goto RULE_187;
+case 183: goto RULE_187;
+case 193: goto RULE_187;
+}
+RULE_132:
+{
+RULE_STATS_ATTEMPT(132)
+if(!doublePremise) { goto NEXT_132; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 43){ goto NEXT_132; }
+if(term1.atoms[1] != 57){ goto NEXT_132; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_132; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_132; }
+substitutions[33] = subtree;
+if(term1.atoms[4] != 39){ goto NEXT_132; }
+subtree = Term_ExtractSubterm(&term2, 0);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_132; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(132)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_132; }
+Truth conclusionTruth = Truth_DecomposeNNN(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 132);}
+NEXT_132:
+RULE_STATS_END(132)
+switch(ruleClass)
+{
+case 140: goto RULE_186;
+case 141: goto RULE_186;
+case 142: goto RULE_186;
+case 143: goto RULE_186;
+case 145: goto RULE_185;
+case 146: goto RULE_186;
+case 147: goto RULE_186;
+case 148: goto RULE_186;
+case 149: goto RULE_186;
+}
+RULE_133:
+{
+RULE_STATS_ATTEMPT(133)
+if(!doublePremise) { goto NEXT_133; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+subtree = Term_ExtractSubterm(&term1, 0);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_133; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 60){ goto NEXT_133; }
+if(term2.atoms[1] != 57){ goto NEXT_133; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_133; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_133; }
+substitutions[33] = subtree;
+if(term2.atoms[4] != 39){ goto NEXT_133; }
+RULE_STATS_UNIFICATION(133)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_133; }
+Truth conclusionTruth = Truth_DecomposePPP(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 133);}
+NEXT_133:
+RULE_STATS_END(133)
+switch(ruleClass)
+{
+case 104: goto RULE_264;
+case 114: goto RULE_264;
+case 124: goto RULE_264;
+case 134: goto RULE_264;
+case 144: goto RULE_186;
+case 164: goto RULE_184;
+case 174: goto RULE_264;
+case 184: goto RULE_264;
+case 194: goto RULE_264;
+}
+RULE_134:
+{
+RULE_STATS_ATTEMPT(134)
+if(!doublePremise) { goto NEXT_134; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 60){ goto NEXT_134; }
+if(term1.atoms[1] != 57){ goto NEXT_134; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_134; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_134; }
+substitutions[33] = subtree;
+if(term1.atoms[4] != 39){ goto NEXT_134; }
+subtree = Term_ExtractSubterm(&term2, 0);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_134; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(134)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_134; }
+Truth conclusionTruth = Truth_DecomposePPP(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 134);}
+NEXT_134:
+RULE_STATS_END(134)
+switch(ruleClass)
+{
+case 150: goto RULE_264;
+case 151: goto RULE_264;
+case 152: goto RULE_264;
+case 153: goto RULE_187;
+case 154: goto RULE_264;
+case 155: goto RULE_185;
+case 156: goto RULE_264;
+case 157: goto RULE_264;
+case 158: goto RULE_264;
+case 159: goto RULE_264;
+}
+RULE_135:
+{
+RULE_STATS_ATTEMPT(135)
+if(!doublePremise) { goto NEXT_135; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_135; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_135; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_135; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_135; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_135; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_135; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(135)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_135; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_135; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 135);}
+NEXT_135:
+RULE_STATS_END(135)
+switch(ruleClass)
+{
+}
+RULE_136:
+{
+RULE_STATS_ATTEMPT(136)
+if(!doublePremise) { goto NEXT_136; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_136; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_136; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_136; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_136; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_136; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_136; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(136)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_136; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_136; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 136);}
+NEXT_136:
+RULE_STATS_END(136)
+switch(ruleClass)
+{
+}
+RULE_137:
+{
+RULE_STATS_ATTEMPT(137)
+if(!doublePremise) { goto NEXT_137; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_137; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_137; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_137; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_137; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_137; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_137; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(137)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_137; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_137; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 137);}
+NEXT_137:
+RULE_STATS_END(137)
+switch(ruleClass)
+{
+}
+RULE_138:
+{
+RULE_STATS_ATTEMPT(138)
+if(!doublePremise) { goto NEXT_138; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_138; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_138; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_138; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_138; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_138; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_138; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(138)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_138; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[29])){ goto NEXT_138; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 138);}
+NEXT_138:
+RULE_STATS_END(138)
+switch(ruleClass)
+{
+}
+RULE_139:
+{
+RULE_STATS_ATTEMPT(139)
+if(!doublePremise) { goto NEXT_139; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_139; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_139; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_139; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_139; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_139; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_139; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(139)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_139; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_139; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 139);}
+NEXT_139:
+RULE_STATS_END(139)
+switch(ruleClass)
+{
+}
+RULE_140:
+{
+RULE_STATS_ATTEMPT(140)
+if(!doublePremise) { goto NEXT_140; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_140; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_140; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_140; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_140; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_140; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_140; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(140)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[29])){ goto NEXT_140; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_140; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 140);}
+NEXT_140:
+RULE_STATS_END(140)
+switch(ruleClass)
+{
+}
+RULE_141:
+{
+RULE_STATS_ATTEMPT(141)
+if(!doublePremise) { goto NEXT_141; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_141; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_141; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_141; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_141; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_141; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_141; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(141)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_141; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_141; }
+Truth conclusionTruth = Truth_Exemplification(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 141);}
+NEXT_141:
+RULE_STATS_END(141)
+switch(ruleClass)
+{
+}
+RULE_142:
+{
+RULE_STATS_ATTEMPT(142)
+if(!doublePremise) { goto NEXT_142; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_142; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_142; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_142; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_142; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_142; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_142; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(142)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_142; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_142; }
+Truth conclusionTruth = Truth_Exemplification(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 142);}
+NEXT_142:
+RULE_STATS_END(142)
+switch(ruleClass)
+{
+}
+RULE_143:
+{
+RULE_STATS_ATTEMPT(143)
+if(!doublePremise) { goto NEXT_143; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_143; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_143; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_143; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_143; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_143; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_143; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(143)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_143; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_143; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_143; }
+Truth conclusionTruth = Truth_Union(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 143);}
+NEXT_143:
+RULE_STATS_END(143)
+switch(ruleClass)
+{
+}
+RULE_144:
+{
+RULE_STATS_ATTEMPT(144)
+if(!doublePremise) { goto NEXT_144; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_144; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_144; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_144; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_144; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_144; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_144; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(144)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_144; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_144; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_144; }
+Truth conclusionTruth = Truth_Union(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 144);}
+NEXT_144:
+RULE_STATS_END(144)
+switch(ruleClass)
+{
+}
+RULE_145:
+{
+RULE_STATS_ATTEMPT(145)
+if(!doublePremise) { goto NEXT_145; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_145; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_145; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_145; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_145; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_145; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_145; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(145)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 60;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_145; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_145; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_145; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 145);}
+NEXT_145:
+RULE_STATS_END(145)
+switch(ruleClass)
+{
+}
+RULE_146:
+{
+RULE_STATS_ATTEMPT(146)
+if(!doublePremise) { goto NEXT_146; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_146; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_146; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_146; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_146; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_146; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_146; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(146)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 60;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_146; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_146; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_146; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 146);}
+NEXT_146:
+RULE_STATS_END(146)
+switch(ruleClass)
+{
+}
+RULE_147:
+{
+RULE_STATS_ATTEMPT(147)
+if(!doublePremise) { goto NEXT_147; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_147; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_147; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_147; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_147; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_147; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_147; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(147)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_147; }
+conclusion.atoms[2] = 43;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_147; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_147; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 147);}
+NEXT_147:
+RULE_STATS_END(147)
+switch(ruleClass)
+{
+}
+RULE_148:
+{
+RULE_STATS_ATTEMPT(148)
+if(!doublePremise) { goto NEXT_148; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_148; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_148; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_148; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_148; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_148; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_148; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(148)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_148; }
+conclusion.atoms[2] = 43;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_148; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_148; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 148);}
+NEXT_148:
+RULE_STATS_END(148)
+switch(ruleClass)
+{
+}
+RULE_149:
+{
+RULE_STATS_ATTEMPT(149)
+if(!doublePremise) { goto NEXT_149; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_149; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_149; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_149; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_149; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_149; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_149; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(149)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_149; }
+conclusion.atoms[2] = 60;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_149; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_149; }
+Truth conclusionTruth = Truth_Union(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 149);}
+NEXT_149:
+RULE_STATS_END(149)
+switch(ruleClass)
+{
+}
+RULE_150:
+{
+RULE_STATS_ATTEMPT(150)
+if(!doublePremise) { goto NEXT_150; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_150; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_150; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_150; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_150; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_150; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_150; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(150)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[30])){ goto NEXT_150; }
+conclusion.atoms[2] = 60;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_150; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_150; }
+Truth conclusionTruth = Truth_Union(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 150);}
+NEXT_150:
+RULE_STATS_END(150)
+switch(ruleClass)
+{
+}
+RULE_151:
+{
+RULE_STATS_ATTEMPT(151)
+if(!doublePremise) { goto NEXT_151; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_151; }
+if(term1.atoms[1] != 43){ goto NEXT_151; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_151; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_151; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_151; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_151; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_151; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_151; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(151)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[34])){ goto NEXT_151; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 151);}
+NEXT_151:
+RULE_STATS_END(151)
+switch(ruleClass)
+{
+}
+RULE_152:
+{
+RULE_STATS_ATTEMPT(152)
+if(!doublePremise) { goto NEXT_152; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_152; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_152; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_152; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_152; }
+if(term2.atoms[1] != 43){ goto NEXT_152; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_152; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_152; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_152; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(152)
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[34])){ goto NEXT_152; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 152);}
+NEXT_152:
+RULE_STATS_END(152)
+switch(ruleClass)
+{
+}
+RULE_153:
+{
+RULE_STATS_ATTEMPT(153)
+if(!doublePremise) { goto NEXT_153; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_153; }
+if(term1.atoms[1] != 43){ goto NEXT_153; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_153; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_153; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_153; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_153; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_153; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_153; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(153)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_153; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_153; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_153; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 153);}
+NEXT_153:
+RULE_STATS_END(153)
+switch(ruleClass)
+{
+}
+RULE_154:
+{
+RULE_STATS_ATTEMPT(154)
+if(!doublePremise) { goto NEXT_154; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_154; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_154; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_154; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_154; }
+if(term2.atoms[1] != 43){ goto NEXT_154; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_154; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_154; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_154; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(154)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_154; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_154; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_154; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 154);}
+NEXT_154:
+RULE_STATS_END(154)
+switch(ruleClass)
+{
+}
+RULE_155:
+{
+RULE_STATS_ATTEMPT(155)
+if(!doublePremise) { goto NEXT_155; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_155; }
+if(term1.atoms[1] != 43){ goto NEXT_155; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_155; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_155; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_155; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_155; }
+if(term2.atoms[1] != 43){ goto NEXT_155; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_155; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_155; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_155; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(155)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_155; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_155; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 155);}
+NEXT_155:
+RULE_STATS_END(155)
+switch(ruleClass)
+{
+}
+RULE_156:
+{
+RULE_STATS_ATTEMPT(156)
+if(!doublePremise) { goto NEXT_156; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_156; }
+if(term1.atoms[1] != 43){ goto NEXT_156; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_156; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_156; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_156; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_156; }
+if(term2.atoms[1] != 43){ goto NEXT_156; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_156; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_156; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_156; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(156)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_156; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_156; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 156);}
+NEXT_156:
+RULE_STATS_END(156)
+switch(ruleClass)
+{
+}
+RULE_157:
+{
+RULE_STATS_ATTEMPT(157)
+if(!doublePremise) { goto NEXT_157; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_157; }
+if(term1.atoms[1] != 43){ goto NEXT_157; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_157; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_157; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_157; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_157; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_157; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_157; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(157)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_157; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_157; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_157; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 157);}
+NEXT_157:
+RULE_STATS_END(157)
+switch(ruleClass)
+{
+}
+RULE_158:
+{
+RULE_STATS_ATTEMPT(158)
+if(!doublePremise) { goto NEXT_158; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_158; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_158; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_158; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_158; }
+if(term2.atoms[1] != 43){ goto NEXT_158; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_158; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_158; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_158; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(158)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_158; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_158; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_158; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 158);}
+NEXT_158:
+RULE_STATS_END(158)
+switch(ruleClass)
+{
+case 165: goto RULE_160;
+}
+RULE_159:
+{
+RULE_STATS_ATTEMPT(159)
+if(doublePremise) { goto NEXT_159; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 59){ goto NEXT_159; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_159; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_159; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(159)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_159; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_159; }
+Truth conclusionTruth = Truth_StructuralDeduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 159);}
+NEXT_159:
+RULE_STATS_END(159)
+switch(ruleClass)
+{
+case 70: goto RULE_264;
+}
+RULE_160:
+{
+RULE_STATS_ATTEMPT(160)
+if(!doublePremise) { goto NEXT_160; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_160; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_160; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_160; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_160; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_160; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_160; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(160)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_160; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_160; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 160);}
+NEXT_160:
+RULE_STATS_END(160)
+switch(ruleClass)
+{
+}
+RULE_161:
+{
+RULE_STATS_ATTEMPT(161)
+if(!doublePremise) { goto NEXT_161; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_161; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_161; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_161; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_161; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_161; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_161; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(161)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_161; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_161; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 161);}
+NEXT_161:
+RULE_STATS_END(161)
+switch(ruleClass)
+{
+}
+RULE_162:
+{
+RULE_STATS_ATTEMPT(162)
+if(!doublePremise) { goto NEXT_162; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_162; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_162; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_162; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_162; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_162; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_162; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(162)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_162; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_162; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 162);}
+NEXT_162:
+RULE_STATS_END(162)
+switch(ruleClass)
+{
+}
+RULE_163:
+{
+RULE_STATS_ATTEMPT(163)
+if(!doublePremise) { goto NEXT_163; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_163; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_163; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_163; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_163; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_163; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_163; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(163)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_163; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_163; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 163);}
+NEXT_163:
+RULE_STATS_END(163)
+switch(ruleClass)
+{
+}
+RULE_164:
+{
+RULE_STATS_ATTEMPT(164)
+if(!doublePremise) { goto NEXT_164; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_164; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_164; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_164; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_164; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_164; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_164; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(164)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_164; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_164; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 164);}
+NEXT_164:
+RULE_STATS_END(164)
+switch(ruleClass)
+{
+}
+RULE_165:
+{
+RULE_STATS_ATTEMPT(165)
+if(!doublePremise) { goto NEXT_165; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_165; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_165; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_165; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_165; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_165; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_165; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(165)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_165; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_165; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 165);}
+NEXT_165:
+RULE_STATS_END(165)
+switch(ruleClass)
+{
+case 165: goto RULE_184;
+}
+RULE_166:
+{
+RULE_STATS_ATTEMPT(166)
+if(!doublePremise) { goto NEXT_166; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_166; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_166; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_166; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 59){ goto NEXT_166; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_166; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_166; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(166)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_166; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_166; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 166);}
+NEXT_166:
+RULE_STATS_END(166)
+switch(ruleClass)
+{
+case 166: goto RULE_168;
+}
+RULE_167:
+{
+RULE_STATS_ATTEMPT(167)
+if(!doublePremise) { goto NEXT_167; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 59){ goto NEXT_167; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_167; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_167; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_167; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_167; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_167; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(167)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_167; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_167; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 167);}
+NEXT_167:
+RULE_STATS_END(167)
+switch(ruleClass)
+{
+case 175: goto RULE_169;
+}
+RULE_168:
+{
+RULE_STATS_ATTEMPT(168)
+if(!doublePremise) { goto NEXT_168; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_168; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_168; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_168; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 59){ goto NEXT_168; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_168; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_168; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(168)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_168; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_168; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 168);}
+NEXT_168:
+RULE_STATS_END(168)
+switch(ruleClass)
+{
+case 166: goto RULE_184;
+}
+RULE_169:
+{
+RULE_STATS_ATTEMPT(169)
+if(!doublePremise) { goto NEXT_169; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 59){ goto NEXT_169; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_169; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_169; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_169; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_169; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_169; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(169)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[34])){ goto NEXT_169; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_169; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 169);}
+NEXT_169:
+RULE_STATS_END(169)
+switch(ruleClass)
+{
+case 175: goto RULE_185;
+}
+RULE_170:
+{
+RULE_STATS_ATTEMPT(170)
+if(!doublePremise) { goto NEXT_170; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 59){ goto NEXT_170; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_170; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_170; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 59){ goto NEXT_170; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_170; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_170; }
+substitutions[31] = subtree;
+RULE_STATS_UNIFICATION(170)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_170; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_170; }
+Truth conclusionTruth = Truth_Resemblance(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 170);}
+NEXT_170:
+RULE_STATS_END(170)
+switch(ruleClass)
+{
+}
+RULE_171:
+{
+RULE_STATS_ATTEMPT(171)
+if(!doublePremise) { goto NEXT_171; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 59){ goto NEXT_171; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_171; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_171; }
+substitutions[31] = subtree;
+if(term2.atoms[0] != 59){ goto NEXT_171; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_171; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_171; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(171)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[33])){ goto NEXT_171; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[34])){ goto NEXT_171; }
+Truth conclusionTruth = Truth_Resemblance(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 171);}
+NEXT_171:
+RULE_STATS_END(171)
+switch(ruleClass)
+{
+case 176: goto RULE_264;
+}
+RULE_172:
+{
+RULE_STATS_ATTEMPT(172)
+if(!doublePremise) { goto NEXT_172; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_172; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_172; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_172; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_172; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_172; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_172; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(172)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_172; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_172; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_172; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[28])){ goto NEXT_172; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 172);}
+NEXT_172:
+RULE_STATS_END(172)
+switch(ruleClass)
+{
+}
+RULE_173:
+{
+RULE_STATS_ATTEMPT(173)
+if(!doublePremise) { goto NEXT_173; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_173; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_173; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_173; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_173; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_173; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_173; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(173)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_173; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_173; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_173; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[28])){ goto NEXT_173; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 173);}
+NEXT_173:
+RULE_STATS_END(173)
+switch(ruleClass)
+{
+}
+RULE_174:
+{
+RULE_STATS_ATTEMPT(174)
+if(!doublePremise) { goto NEXT_174; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_174; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_174; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_174; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_174; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_174; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_174; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(174)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[29])){ goto NEXT_174; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_174; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_174; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_174; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 174);}
+NEXT_174:
+RULE_STATS_END(174)
+switch(ruleClass)
+{
+}
+RULE_175:
+{
+RULE_STATS_ATTEMPT(175)
+if(!doublePremise) { goto NEXT_175; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_175; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_175; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_175; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_175; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_175; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_175; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(175)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[29])){ goto NEXT_175; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_175; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_175; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_175; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 175);}
+NEXT_175:
+RULE_STATS_END(175)
+switch(ruleClass)
+{
+}
+RULE_176:
+{
+RULE_STATS_ATTEMPT(176)
+if(!doublePremise) { goto NEXT_176; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_176; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_176; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_176; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_176; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_176; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_176; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(176)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_176; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_176; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_176; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[28])){ goto NEXT_176; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 176);}
+NEXT_176:
+RULE_STATS_END(176)
+switch(ruleClass)
+{
+}
+RULE_177:
+{
+RULE_STATS_ATTEMPT(177)
+if(!doublePremise) { goto NEXT_177; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_177; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_177; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_177; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_177; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_177; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_177; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(177)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_177; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_177; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_177; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[28])){ goto NEXT_177; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 177);}
+NEXT_177:
+RULE_STATS_END(177)
+switch(ruleClass)
+{
+}
+RULE_178:
+{
+RULE_STATS_ATTEMPT(178)
+if(!doublePremise) { goto NEXT_178; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_178; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_178; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_178; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_178; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_178; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_178; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(178)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[29])){ goto NEXT_178; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_178; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_178; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_178; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 178);}
+NEXT_178:
+RULE_STATS_END(178)
+switch(ruleClass)
+{
+}
+RULE_179:
+{
+RULE_STATS_ATTEMPT(179)
+if(!doublePremise) { goto NEXT_179; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_179; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_179; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_179; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_179; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_179; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_179; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(179)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[29])){ goto NEXT_179; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_179; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_179; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_179; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 179);}
+NEXT_179:
+RULE_STATS_END(179)
+switch(ruleClass)
+{
+}
+RULE_180:
+{
+RULE_STATS_ATTEMPT(180)
+if(!doublePremise) { goto NEXT_180; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_180; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_180; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_180; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_180; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_180; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_180; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(180)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_180; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_180; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_180; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[28])){ goto NEXT_180; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 180);}
+NEXT_180:
+RULE_STATS_END(180)
+switch(ruleClass)
+{
+}
+RULE_181:
+{
+RULE_STATS_ATTEMPT(181)
+if(!doublePremise) { goto NEXT_181; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_181; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_181; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_181; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_181; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_181; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_181; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(181)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_181; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_181; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_181; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[28])){ goto NEXT_181; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 181);}
+NEXT_181:
+RULE_STATS_END(181)
+switch(ruleClass)
+{
+}
+RULE_182:
+{
+RULE_STATS_ATTEMPT(182)
+if(!doublePremise) { goto NEXT_182; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_182; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_182; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_182; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_182; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_182; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_182; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(182)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[29])){ goto NEXT_182; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_182; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_182; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_182; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 182);}
+NEXT_182:
+RULE_STATS_END(182)
+switch(ruleClass)
+{
+}
+RULE_183:
+{
+RULE_STATS_ATTEMPT(183)
+if(!doublePremise) { goto NEXT_183; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_183; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_183; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_183; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_183; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_183; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_183; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(183)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[29])){ goto NEXT_183; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_183; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_183; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_183; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 183);}
+NEXT_183:
+RULE_STATS_END(183)
+switch(ruleClass)
+{
+case 111: goto RULE_190;
+}
+RULE_184:
+{
+RULE_STATS_ATTEMPT(184)
+if(!doublePremise) { goto NEXT_184; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_184; }
+if(term1.atoms[1] != 44){ goto NEXT_184; }
+if(term1.atoms[2] != 44){ goto NEXT_184; }
+if(term1.atoms[3] != 2){ goto NEXT_184; }
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_184; }
+substitutions[29] = subtree;
+if(term1.atoms[5] != 2){ goto NEXT_184; }
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_184; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 0);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_184; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(184)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_184; }
+conclusion.atoms[2] = 58;
+conclusion.atoms[5] = 44;
+conclusion.atoms[6] = 44;
+conclusion.atoms[11] = 2;
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[29])){ goto NEXT_184; }
+conclusion.atoms[13] = 2;
+if(!Term_OverrideSubterm(&conclusion,14,&substitutions[30])){ goto NEXT_184; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 184);}
+NEXT_184:
+RULE_STATS_END(184)
+switch(ruleClass)
+{
+case 160: goto RULE_188;
+case 161: goto RULE_188;
+case 162: goto RULE_188;
+case 163: goto RULE_187;
+case 164: goto RULE_188;
+case 166: goto RULE_188;
+case 167: goto RULE_188;
+case 168: goto RULE_188;
+case 169: goto RULE_188;
+}
+RULE_185:
+{
+RULE_STATS_ATTEMPT(185)
+if(!doublePremise) { goto NEXT_185; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+subtree = Term_ExtractSubterm(&term1, 0);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_185; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_185; }
+if(term2.atoms[1] != 44){ goto NEXT_185; }
+if(term2.atoms[2] != 44){ goto NEXT_185; }
+if(term2.atoms[3] != 2){ goto NEXT_185; }
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_185; }
+substitutions[29] = subtree;
+if(term2.atoms[5] != 2){ goto NEXT_185; }
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_185; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(185)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_185; }
+conclusion.atoms[2] = 58;
+conclusion.atoms[5] = 44;
+conclusion.atoms[6] = 44;
+conclusion.atoms[11] = 2;
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[29])){ goto NEXT_185; }
+conclusion.atoms[13] = 2;
+if(!Term_OverrideSubterm(&conclusion,14,&substitutions[30])){ goto NEXT_185; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 185);}
+NEXT_185:
+RULE_STATS_END(185)
+switch(ruleClass)
+{
+case 105: goto RULE_189;
+case 115: goto RULE_189;
+case 125: goto RULE_189;
+case 135: goto RULE_189;
+case 155: goto RULE_189;
+case 165: goto RULE_188;
+case 175: goto RULE_189;
+case 185: goto RULE_189;
+case 195: goto RULE_189;
+}
+RULE_186:
+{
+RULE_STATS_ATTEMPT(186)
+if(!doublePremise) { goto NEXT_186; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 43){ goto NEXT_186; }
+if(term1.atoms[1] != 44){ goto NEXT_186; }
+if(term1.atoms[2] != 44){ goto NEXT_186; }
+if(term1.atoms[3] != 1){ goto NEXT_186; }
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_186; }
+substitutions[29] = subtree;
+if(term1.atoms[5] != 1){ goto NEXT_186; }
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_186; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 0);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_186; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(186)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_186; }
+conclusion.atoms[2] = 43;
+conclusion.atoms[5] = 44;
+conclusion.atoms[6] = 44;
+conclusion.atoms[11] = 1;
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[29])){ goto NEXT_186; }
+conclusion.atoms[13] = 1;
+if(!Term_OverrideSubterm(&conclusion,14,&substitutions[30])){ goto NEXT_186; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 186);}
+NEXT_186:
+RULE_STATS_END(186)
+switch(ruleClass)
+{
+case 140: goto RULE_264;
+case 141: goto RULE_197;
+case 142: goto RULE_264;
+case 144: goto RULE_264;
+case 145: goto RULE_189;
+case 146: goto RULE_264;
+case 147: goto RULE_264;
+case 148: goto RULE_264;
+case 149: goto RULE_264;
+}
+RULE_187:
+{
+RULE_STATS_ATTEMPT(187)
+if(!doublePremise) { goto NEXT_187; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+subtree = Term_ExtractSubterm(&term1, 0);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_187; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 43){ goto NEXT_187; }
+if(term2.atoms[1] != 44){ goto NEXT_187; }
+if(term2.atoms[2] != 44){ goto NEXT_187; }
+if(term2.atoms[3] != 1){ goto NEXT_187; }
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_187; }
+substitutions[29] = subtree;
+if(term2.atoms[5] != 1){ goto NEXT_187; }
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_187; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(187)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_187; }
+conclusion.atoms[2] = 43;
+conclusion.atoms[5] = 44;
+conclusion.atoms[6] = 44;
+conclusion.atoms[11] = 1;
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[29])){ goto NEXT_187; }
+conclusion.atoms[13] = 1;
+if(!Term_OverrideSubterm(&conclusion,14,&substitutions[30])){ goto NEXT_187; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 187);}
+NEXT_187:
+RULE_STATS_END(187)
+switch(ruleClass)
+{
+case 103: goto RULE_264;
+case 113: goto RULE_196;
+case 123: goto RULE_264;
+case 133: goto RULE_264;
+case 143: goto RULE_264;
+case 153: goto RULE_264;
+case 173: goto RULE_264;
+case 183: goto RULE_264;
+case 193: goto RULE_264;
+}
+RULE_188:
+{
+RULE_STATS_ATTEMPT(188)
+if(!doublePremise) { goto NEXT_188; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_188; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_188; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_188; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 0);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_188; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(188)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_188; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_188; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_188; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 188);}
+NEXT_188:
+RULE_STATS_END(188)
+switch(ruleClass)
+{
+case 160: goto RULE_264;
+case 161: goto RULE_264;
+case 162: goto RULE_264;
+case 163: goto RULE_264;
+case 164: goto RULE_264;
+case 166: goto RULE_264;
+case 167: goto RULE_264;
+case 168: goto RULE_199;
+case 169: goto RULE_264;
+}
+RULE_189:
+{
+RULE_STATS_ATTEMPT(189)
+if(!doublePremise) { goto NEXT_189; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+subtree = Term_ExtractSubterm(&term1, 0);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_189; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_189; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_189; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_189; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(189)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_189; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_189; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_189; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 189);}
+NEXT_189:
+RULE_STATS_END(189)
+switch(ruleClass)
+{
+case 105: goto RULE_264;
+case 115: goto RULE_264;
+case 125: goto RULE_264;
+case 135: goto RULE_264;
+case 145: goto RULE_264;
+case 155: goto RULE_264;
+case 165: goto RULE_264;
+case 175: goto RULE_264;
+case 185: goto RULE_198;
+case 195: goto RULE_264;
+}
+RULE_190:
+{
+RULE_STATS_ATTEMPT(190)
+if(!doublePremise) { goto NEXT_190; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_190; }
+if(term1.atoms[1] != 40){ goto NEXT_190; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_190; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_190; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_190; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_190; }
+if(term2.atoms[1] != 40){ goto NEXT_190; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_190; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_190; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_190; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(190)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 40;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_190; }
+conclusion.atoms[5] = 40;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[32])){ goto NEXT_190; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_190; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[29])){ goto NEXT_190; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[29])){ goto NEXT_190; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[28])){ goto NEXT_190; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 190);}
+NEXT_190:
+RULE_STATS_END(190)
+switch(ruleClass)
+{
+}
+RULE_191:
+{
+RULE_STATS_ATTEMPT(191)
+if(!doublePremise) { goto NEXT_191; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_191; }
+if(term1.atoms[1] != 40){ goto NEXT_191; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_191; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_191; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_191; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_191; }
+if(term2.atoms[1] != 40){ goto NEXT_191; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_191; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_191; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_191; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(191)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 40;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_191; }
+conclusion.atoms[5] = 40;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[32])){ goto NEXT_191; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_191; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[29])){ goto NEXT_191; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[29])){ goto NEXT_191; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[28])){ goto NEXT_191; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 191);}
+NEXT_191:
+RULE_STATS_END(191)
+switch(ruleClass)
+{
+case 111: goto RULE_194;
+}
+RULE_192:
+{
+RULE_STATS_ATTEMPT(192)
+if(!doublePremise) { goto NEXT_192; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 57){ goto NEXT_192; }
+if(term1.atoms[1] != 44){ goto NEXT_192; }
+if(term1.atoms[2] != 39){ goto NEXT_192; }
+if(term1.atoms[3] != 40){ goto NEXT_192; }
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_192; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_192; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 8);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_192; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_192; }
+if(term2.atoms[1] != 40){ goto NEXT_192; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_192; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_192; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_192; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(192)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 57;
+conclusion.atoms[3] = 40;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_192; }
+conclusion.atoms[5] = 44;
+conclusion.atoms[6] = 39;
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_192; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[29])){ goto NEXT_192; }
+conclusion.atoms[11] = 40;
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[32])){ goto NEXT_192; }
+if(!Term_OverrideSubterm(&conclusion,23,&substitutions[29])){ goto NEXT_192; }
+if(!Term_OverrideSubterm(&conclusion,24,&substitutions[28])){ goto NEXT_192; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 192);}
+NEXT_192:
+RULE_STATS_END(192)
+switch(ruleClass)
+{
+case 131: goto RULE_264;
+}
+RULE_193:
+{
+RULE_STATS_ATTEMPT(193)
+if(!doublePremise) { goto NEXT_193; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_193; }
+if(term1.atoms[1] != 40){ goto NEXT_193; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_193; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_193; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_193; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 57){ goto NEXT_193; }
+if(term2.atoms[1] != 44){ goto NEXT_193; }
+if(term2.atoms[2] != 39){ goto NEXT_193; }
+if(term2.atoms[3] != 40){ goto NEXT_193; }
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_193; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 7);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_193; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 8);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_193; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(193)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 57;
+conclusion.atoms[3] = 40;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_193; }
+conclusion.atoms[5] = 44;
+conclusion.atoms[6] = 39;
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_193; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[29])){ goto NEXT_193; }
+conclusion.atoms[11] = 40;
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[32])){ goto NEXT_193; }
+if(!Term_OverrideSubterm(&conclusion,23,&substitutions[29])){ goto NEXT_193; }
+if(!Term_OverrideSubterm(&conclusion,24,&substitutions[28])){ goto NEXT_193; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 193);}
+NEXT_193:
+RULE_STATS_END(193)
+switch(ruleClass)
+{
+case 117: goto RULE_264;
+}
+RULE_194:
+{
+RULE_STATS_ATTEMPT(194)
+if(!doublePremise) { goto NEXT_194; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_194; }
+if(term1.atoms[1] != 40){ goto NEXT_194; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_194; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_194; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_194; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_194; }
+if(term2.atoms[1] != 40){ goto NEXT_194; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_194; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_194; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_194; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(194)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 40;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[32])){ goto NEXT_194; }
+conclusion.atoms[5] = 40;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_194; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_194; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[29])){ goto NEXT_194; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[29])){ goto NEXT_194; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[30])){ goto NEXT_194; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 194);}
+NEXT_194:
+RULE_STATS_END(194)
+switch(ruleClass)
+{
+}
+RULE_195:
+{
+RULE_STATS_ATTEMPT(195)
+if(!doublePremise) { goto NEXT_195; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_195; }
+if(term1.atoms[1] != 40){ goto NEXT_195; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_195; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_195; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_195; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_195; }
+if(term2.atoms[1] != 40){ goto NEXT_195; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_195; }
+substitutions[32] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_195; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_195; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(195)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 40;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[32])){ goto NEXT_195; }
+conclusion.atoms[5] = 40;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_195; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_195; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[29])){ goto NEXT_195; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[29])){ goto NEXT_195; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[30])){ goto NEXT_195; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 195);}
+NEXT_195:
+RULE_STATS_END(195)
+switch(ruleClass)
+{
+case 111: goto RULE_264;
+}
+RULE_196:
+{
+RULE_STATS_ATTEMPT(196)
+if(!doublePremise) { goto NEXT_196; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_196; }
+if(term1.atoms[1] != 40){ goto NEXT_196; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_196; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_196; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_196; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 43){ goto NEXT_196; }
+if(term2.atoms[1] != 44){ goto NEXT_196; }
+if(term2.atoms[2] != 44){ goto NEXT_196; }
+if(term2.atoms[3] != 40){ goto NEXT_196; }
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_196; }
+substitutions[32] = subtree;
+if(term2.atoms[5] != 40){ goto NEXT_196; }
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_196; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_196; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 8);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_196; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 11);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_196; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 12);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_196; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(196)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 44;
+conclusion.atoms[4] = 44;
+conclusion.atoms[5] = 40;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[31])){ goto NEXT_196; }
+conclusion.atoms[7] = 40;
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[32])){ goto NEXT_196; }
+conclusion.atoms[9] = 40;
+if(!Term_OverrideSubterm(&conclusion,10,&substitutions[33])){ goto NEXT_196; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_196; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[30])){ goto NEXT_196; }
+if(!Term_OverrideSubterm(&conclusion,15,&substitutions[28])){ goto NEXT_196; }
+if(!Term_OverrideSubterm(&conclusion,16,&substitutions[29])){ goto NEXT_196; }
+if(!Term_OverrideSubterm(&conclusion,19,&substitutions[29])){ goto NEXT_196; }
+if(!Term_OverrideSubterm(&conclusion,20,&substitutions[30])){ goto NEXT_196; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 196);}
+NEXT_196:
+RULE_STATS_END(196)
+switch(ruleClass)
+{
+case 113: goto RULE_264;
+}
+RULE_197:
+{
+RULE_STATS_ATTEMPT(197)
+if(!doublePremise) { goto NEXT_197; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 43){ goto NEXT_197; }
+if(term1.atoms[1] != 44){ goto NEXT_197; }
+if(term1.atoms[2] != 44){ goto NEXT_197; }
+if(term1.atoms[3] != 40){ goto NEXT_197; }
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[32].atoms[0]!=0 && !Term_Equal(&substitutions[32], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_197; }
+substitutions[32] = subtree;
+if(term1.atoms[5] != 40){ goto NEXT_197; }
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_197; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_197; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 8);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_197; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 11);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_197; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 12);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_197; }
+substitutions[30] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_197; }
+if(term2.atoms[1] != 40){ goto NEXT_197; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_197; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_197; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_197; }
+substitutions[30] = subtree;
+RULE_STATS_UNIFICATION(197)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 43;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 44;
+conclusion.atoms[4] = 44;
+conclusion.atoms[5] = 40;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[31])){ goto NEXT_197; }
+conclusion.atoms[7] = 40;
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[32])){ goto NEXT_197; }
+conclusion.atoms[9] = 40;
+if(!Term_OverrideSubterm(&conclusion,10,&substitutions[33])){ goto NEXT_197; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_197; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[30])){ goto NEXT_197; }
+if(!Term_OverrideSubterm(&conclusion,15,&substitutions[28])){ goto NEXT_197; }
+if(!Term_OverrideSubterm(&conclusion,16,&substitutions[29])){ goto NEXT_197; }
+if(!Term_OverrideSubterm(&conclusion,19,&substitutions[29])){ goto NEXT_197; }
+if(!Term_OverrideSubterm(&conclusion,20,&substitutions[30])){ goto NEXT_197; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 197);}
+NEXT_197:
+RULE_STATS_END(197)
+switch(ruleClass)
+{
+case 141: goto RULE_264;
+}
+RULE_198:
+{
+RULE_STATS_ATTEMPT(198)
+if(!doublePremise) { goto NEXT_198; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_198; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_198; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_198; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_198; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_198; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_198; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(198)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_198; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_198; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 198);}
+NEXT_198:
+RULE_STATS_END(198)
+switch(ruleClass)
+{
+case 185: goto RULE_200;
+}
+RULE_199:
+{
+RULE_STATS_ATTEMPT(199)
+if(!doublePremise) { goto NEXT_199; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_199; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_199; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_199; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_199; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_199; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_199; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(199)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_199; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_199; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 199);}
+NEXT_199:
+RULE_STATS_END(199)
+switch(ruleClass)
+{
+case 168: goto RULE_201;
+}
+RULE_200:
+{
+RULE_STATS_ATTEMPT(200)
+if(!doublePremise) { goto NEXT_200; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_200; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_200; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_200; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_200; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_200; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_200; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(200)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_200; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_200; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 200);}
+NEXT_200:
+RULE_STATS_END(200)
+switch(ruleClass)
+{
+case 185: goto RULE_208;
+}
+RULE_201:
+{
+RULE_STATS_ATTEMPT(201)
+if(!doublePremise) { goto NEXT_201; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_201; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_201; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_201; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_201; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_201; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_201; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(201)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_201; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_201; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 201);}
+NEXT_201:
+RULE_STATS_END(201)
+switch(ruleClass)
+{
+case 168: goto RULE_209;
+}
+RULE_202:
+{
+RULE_STATS_ATTEMPT(202)
+if(!doublePremise) { goto NEXT_202; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_202; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_202; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_202; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 59){ goto NEXT_202; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_202; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_202; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(202)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_202; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_202; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 202);}
+NEXT_202:
+RULE_STATS_END(202)
+switch(ruleClass)
+{
+case 186: goto RULE_212;
+}
+RULE_203:
+{
+RULE_STATS_ATTEMPT(203)
+if(!doublePremise) { goto NEXT_203; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 59){ goto NEXT_203; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_203; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_203; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_203; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_203; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_203; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(203)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_203; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[33])){ goto NEXT_203; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 203);}
+NEXT_203:
+RULE_STATS_END(203)
+switch(ruleClass)
+{
+case 178: goto RULE_213;
+}
+RULE_204:
+{
+RULE_STATS_ATTEMPT(204)
+if(!doublePremise) { goto NEXT_204; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_204; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_204; }
+substitutions[28] = subtree;
+if(term1.atoms[2] != 44){ goto NEXT_204; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_204; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_204; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_204; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_204; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_204; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(204)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_204; }
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_204; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_204; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 204);}
+NEXT_204:
+RULE_STATS_END(204)
+switch(ruleClass)
+{
+case 182: goto RULE_206;
+}
+RULE_205:
+{
+RULE_STATS_ATTEMPT(205)
+if(!doublePremise) { goto NEXT_205; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_205; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_205; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_205; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_205; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_205; }
+substitutions[28] = subtree;
+if(term2.atoms[2] != 44){ goto NEXT_205; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_205; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_205; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(205)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_205; }
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_205; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_205; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 205);}
+NEXT_205:
+RULE_STATS_END(205)
+switch(ruleClass)
+{
+case 128: goto RULE_207;
+}
+RULE_206:
+{
+RULE_STATS_ATTEMPT(206)
+if(!doublePremise) { goto NEXT_206; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_206; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_206; }
+substitutions[28] = subtree;
+if(term1.atoms[2] != 44){ goto NEXT_206; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_206; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_206; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_206; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_206; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_206; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(206)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_206; }
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[29])){ goto NEXT_206; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_206; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 206);}
+NEXT_206:
+RULE_STATS_END(206)
+switch(ruleClass)
+{
+case 182: goto RULE_214;
+}
+RULE_207:
+{
+RULE_STATS_ATTEMPT(207)
+if(!doublePremise) { goto NEXT_207; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_207; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_207; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_207; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_207; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_207; }
+substitutions[28] = subtree;
+if(term2.atoms[2] != 44){ goto NEXT_207; }
+subtree = Term_ExtractSubterm(&term2, 5);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_207; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 6);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_207; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(207)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_207; }
+conclusion.atoms[2] = 44;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[29])){ goto NEXT_207; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[33])){ goto NEXT_207; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 207);}
+NEXT_207:
+RULE_STATS_END(207)
+switch(ruleClass)
+{
+case 128: goto RULE_215;
+}
+RULE_208:
+{
+RULE_STATS_ATTEMPT(208)
+if(!doublePremise) { goto NEXT_208; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_208; }
+if(term1.atoms[1] != 56){ goto NEXT_208; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_208; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_208; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_208; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_208; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_208; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_208; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(208)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_208; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_208; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_208; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 208);}
+NEXT_208:
+RULE_STATS_END(208)
+switch(ruleClass)
+{
+case 185: goto RULE_210;
+}
+RULE_209:
+{
+RULE_STATS_ATTEMPT(209)
+if(!doublePremise) { goto NEXT_209; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_209; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_209; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_209; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_209; }
+if(term2.atoms[1] != 56){ goto NEXT_209; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_209; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_209; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_209; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(209)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_209; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_209; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_209; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 209);}
+NEXT_209:
+RULE_STATS_END(209)
+switch(ruleClass)
+{
+case 168: goto RULE_211;
+}
+RULE_210:
+{
+RULE_STATS_ATTEMPT(210)
+if(!doublePremise) { goto NEXT_210; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_210; }
+if(term1.atoms[1] != 56){ goto NEXT_210; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_210; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_210; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_210; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_210; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_210; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_210; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(210)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_210; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_210; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_210; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 210);}
+NEXT_210:
+RULE_STATS_END(210)
+switch(ruleClass)
+{
+case 185: goto RULE_218;
+}
+RULE_211:
+{
+RULE_STATS_ATTEMPT(211)
+if(!doublePremise) { goto NEXT_211; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_211; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_211; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_211; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_211; }
+if(term2.atoms[1] != 56){ goto NEXT_211; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_211; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_211; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_211; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(211)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_211; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_211; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_211; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 211);}
+NEXT_211:
+RULE_STATS_END(211)
+switch(ruleClass)
+{
+case 168: goto RULE_219;
+}
+RULE_212:
+{
+RULE_STATS_ATTEMPT(212)
+if(!doublePremise) { goto NEXT_212; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_212; }
+if(term1.atoms[1] != 56){ goto NEXT_212; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_212; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_212; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_212; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 59){ goto NEXT_212; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_212; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_212; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(212)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_212; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_212; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_212; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 212);}
+NEXT_212:
+RULE_STATS_END(212)
+switch(ruleClass)
+{
+case 186: goto RULE_222;
+}
+RULE_213:
+{
+RULE_STATS_ATTEMPT(213)
+if(!doublePremise) { goto NEXT_213; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 59){ goto NEXT_213; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_213; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_213; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_213; }
+if(term2.atoms[1] != 56){ goto NEXT_213; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_213; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_213; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_213; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(213)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_213; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_213; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_213; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 213);}
+NEXT_213:
+RULE_STATS_END(213)
+switch(ruleClass)
+{
+case 178: goto RULE_223;
+}
+RULE_214:
+{
+RULE_STATS_ATTEMPT(214)
+if(!doublePremise) { goto NEXT_214; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_214; }
+if(term1.atoms[1] != 56){ goto NEXT_214; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_214; }
+substitutions[30] = subtree;
+if(term1.atoms[3] != 44){ goto NEXT_214; }
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_214; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_214; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 8);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_214; }
+substitutions[28] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_214; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_214; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_214; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(214)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_214; }
+conclusion.atoms[3] = 44;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_214; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[34])){ goto NEXT_214; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[33])){ goto NEXT_214; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 214);}
+NEXT_214:
+RULE_STATS_END(214)
+switch(ruleClass)
+{
+case 182: goto RULE_216;
+}
+RULE_215:
+{
+RULE_STATS_ATTEMPT(215)
+if(!doublePremise) { goto NEXT_215; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_215; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_215; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_215; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_215; }
+if(term2.atoms[1] != 56){ goto NEXT_215; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_215; }
+substitutions[30] = subtree;
+if(term2.atoms[3] != 44){ goto NEXT_215; }
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_215; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 7);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_215; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 8);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_215; }
+substitutions[28] = subtree;
+RULE_STATS_UNIFICATION(215)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_215; }
+conclusion.atoms[3] = 44;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_215; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[34])){ goto NEXT_215; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[33])){ goto NEXT_215; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 215);}
+NEXT_215:
+RULE_STATS_END(215)
+switch(ruleClass)
+{
+case 128: goto RULE_217;
+}
+RULE_216:
+{
+RULE_STATS_ATTEMPT(216)
+if(!doublePremise) { goto NEXT_216; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_216; }
+if(term1.atoms[1] != 56){ goto NEXT_216; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_216; }
+substitutions[30] = subtree;
+if(term1.atoms[3] != 44){ goto NEXT_216; }
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_216; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_216; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 8);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_216; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_216; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_216; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_216; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(216)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_216; }
+conclusion.atoms[3] = 44;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_216; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[33])){ goto NEXT_216; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[34])){ goto NEXT_216; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 216);}
+NEXT_216:
+RULE_STATS_END(216)
+switch(ruleClass)
+{
+case 182: goto RULE_224;
+}
+RULE_217:
+{
+RULE_STATS_ATTEMPT(217)
+if(!doublePremise) { goto NEXT_217; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_217; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_217; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_217; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_217; }
+if(term2.atoms[1] != 56){ goto NEXT_217; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_217; }
+substitutions[30] = subtree;
+if(term2.atoms[3] != 44){ goto NEXT_217; }
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_217; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_217; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 8);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_217; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(217)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_217; }
+conclusion.atoms[3] = 44;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_217; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[33])){ goto NEXT_217; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[34])){ goto NEXT_217; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 217);}
+NEXT_217:
+RULE_STATS_END(217)
+switch(ruleClass)
+{
+case 128: goto RULE_225;
+}
+RULE_218:
+{
+RULE_STATS_ATTEMPT(218)
+if(!doublePremise) { goto NEXT_218; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_218; }
+if(term1.atoms[1] != 56){ goto NEXT_218; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_218; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_218; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_218; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_218; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_218; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_218; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(218)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_218; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_218; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_218; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 218);}
+NEXT_218:
+RULE_STATS_END(218)
+switch(ruleClass)
+{
+case 185: goto RULE_220;
+}
+RULE_219:
+{
+RULE_STATS_ATTEMPT(219)
+if(!doublePremise) { goto NEXT_219; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_219; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_219; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_219; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_219; }
+if(term2.atoms[1] != 56){ goto NEXT_219; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_219; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_219; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_219; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(219)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_219; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_219; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_219; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 219);}
+NEXT_219:
+RULE_STATS_END(219)
+switch(ruleClass)
+{
+case 168: goto RULE_221;
+}
+RULE_220:
+{
+RULE_STATS_ATTEMPT(220)
+if(!doublePremise) { goto NEXT_220; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_220; }
+if(term1.atoms[1] != 56){ goto NEXT_220; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_220; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_220; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_220; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 58){ goto NEXT_220; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_220; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_220; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(220)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_220; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_220; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_220; }
+Truth conclusionTruth = Truth_Deduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 220);}
+NEXT_220:
+RULE_STATS_END(220)
+switch(ruleClass)
+{
+case 185: goto RULE_264;
+}
+RULE_221:
+{
+RULE_STATS_ATTEMPT(221)
+if(!doublePremise) { goto NEXT_221; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 58){ goto NEXT_221; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_221; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_221; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_221; }
+if(term2.atoms[1] != 56){ goto NEXT_221; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_221; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_221; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_221; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(221)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_221; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_221; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_221; }
+Truth conclusionTruth = Truth_Deduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 221);}
+NEXT_221:
+RULE_STATS_END(221)
+switch(ruleClass)
+{
+case 168: goto RULE_264;
+}
+RULE_222:
+{
+RULE_STATS_ATTEMPT(222)
+if(!doublePremise) { goto NEXT_222; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_222; }
+if(term1.atoms[1] != 56){ goto NEXT_222; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_222; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_222; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_222; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 59){ goto NEXT_222; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_222; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_222; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(222)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_222; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_222; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_222; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 222);}
+NEXT_222:
+RULE_STATS_END(222)
+switch(ruleClass)
+{
+case 186: goto RULE_264;
+}
+RULE_223:
+{
+RULE_STATS_ATTEMPT(223)
+if(!doublePremise) { goto NEXT_223; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 59){ goto NEXT_223; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_223; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_223; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_223; }
+if(term2.atoms[1] != 56){ goto NEXT_223; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_223; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_223; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_223; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(223)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_223; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_223; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[33])){ goto NEXT_223; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 223);}
+NEXT_223:
+RULE_STATS_END(223)
+switch(ruleClass)
+{
+case 178: goto RULE_264;
+}
+RULE_224:
+{
+RULE_STATS_ATTEMPT(224)
+if(!doublePremise) { goto NEXT_224; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_224; }
+if(term1.atoms[1] != 56){ goto NEXT_224; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_224; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_224; }
+substitutions[28] = subtree;
+if(term1.atoms[4] != 44){ goto NEXT_224; }
+subtree = Term_ExtractSubterm(&term1, 9);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_224; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term1, 10);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_224; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_224; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_224; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_224; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(224)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_224; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_224; }
+conclusion.atoms[4] = 44;
+if(!Term_OverrideSubterm(&conclusion,9,&substitutions[34])){ goto NEXT_224; }
+if(!Term_OverrideSubterm(&conclusion,10,&substitutions[33])){ goto NEXT_224; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 224);}
+NEXT_224:
+RULE_STATS_END(224)
+switch(ruleClass)
+{
+case 182: goto RULE_226;
+}
+RULE_225:
+{
+RULE_STATS_ATTEMPT(225)
+if(!doublePremise) { goto NEXT_225; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_225; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_225; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_225; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_225; }
+if(term2.atoms[1] != 56){ goto NEXT_225; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_225; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_225; }
+substitutions[28] = subtree;
+if(term2.atoms[4] != 44){ goto NEXT_225; }
+subtree = Term_ExtractSubterm(&term2, 9);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_225; }
+substitutions[34] = subtree;
+subtree = Term_ExtractSubterm(&term2, 10);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_225; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(225)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_225; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_225; }
+conclusion.atoms[4] = 44;
+if(!Term_OverrideSubterm(&conclusion,9,&substitutions[34])){ goto NEXT_225; }
+if(!Term_OverrideSubterm(&conclusion,10,&substitutions[33])){ goto NEXT_225; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 225);}
+NEXT_225:
+RULE_STATS_END(225)
+switch(ruleClass)
+{
+case 128: goto RULE_227;
+}
+RULE_226:
+{
+RULE_STATS_ATTEMPT(226)
+if(!doublePremise) { goto NEXT_226; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_226; }
+if(term1.atoms[1] != 56){ goto NEXT_226; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_226; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_226; }
+substitutions[28] = subtree;
+if(term1.atoms[4] != 44){ goto NEXT_226; }
+subtree = Term_ExtractSubterm(&term1, 9);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_226; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 10);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_226; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 45){ goto NEXT_226; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_226; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_226; }
+substitutions[33] = subtree;
+RULE_STATS_UNIFICATION(226)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_226; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_226; }
+conclusion.atoms[4] = 44;
+if(!Term_OverrideSubterm(&conclusion,9,&substitutions[33])){ goto NEXT_226; }
+if(!Term_OverrideSubterm(&conclusion,10,&substitutions[34])){ goto NEXT_226; }
+Truth conclusionTruth = Truth_Analogy(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 226);}
+NEXT_226:
+RULE_STATS_END(226)
+switch(ruleClass)
+{
+case 182: goto RULE_264;
+}
+RULE_227:
+{
+RULE_STATS_ATTEMPT(227)
+if(!doublePremise) { goto NEXT_227; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 45){ goto NEXT_227; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_227; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_227; }
+substitutions[33] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_227; }
+if(term2.atoms[1] != 56){ goto NEXT_227; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_227; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_227; }
+substitutions[28] = subtree;
+if(term2.atoms[4] != 44){ goto NEXT_227; }
+subtree = Term_ExtractSubterm(&term2, 9);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_227; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term2, 10);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_227; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(227)
+Term conclusion = {0};
+conclusion.atoms[0] = 46;
+conclusion.atoms[1] = 56;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[30])){ goto NEXT_227; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_227; }
+conclusion.atoms[4] = 44;
+if(!Term_OverrideSubterm(&conclusion,9,&substitutions[33])){ goto NEXT_227; }
+if(!Term_OverrideSubterm(&conclusion,10,&substitutions[34])){ goto NEXT_227; }
+Truth conclusionTruth = Truth_Analogy(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 0, 227);}
+NEXT_227:
+RULE_STATS_END(227)
+switch(ruleClass)
+{
+case 128: goto RULE_264;
+}
+RULE_228:
+{
+RULE_STATS_ATTEMPT(228)
+if(!doublePremise) { goto NEXT_228; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_228; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_228; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_228; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_228; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_228; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_228; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(228)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_228; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_228; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_228; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_228; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 228);}
+NEXT_228:
+RULE_STATS_END(228)
+switch(ruleClass)
+{
+}
+RULE_229:
+{
+RULE_STATS_ATTEMPT(229)
+if(!doublePremise) { goto NEXT_229; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_229; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_229; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_229; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_229; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_229; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_229; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(229)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_229; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_229; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_229; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_229; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 229);}
+NEXT_229:
+RULE_STATS_END(229)
+switch(ruleClass)
+{
+}
+RULE_230:
+{
+RULE_STATS_ATTEMPT(230)
+if(!doublePremise) { goto NEXT_230; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_230; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_230; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_230; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_230; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_230; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_230; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(230)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_230; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_230; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_230; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_230; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 230);}
+NEXT_230:
+RULE_STATS_END(230)
+switch(ruleClass)
+{
+}
+RULE_231:
+{
+RULE_STATS_ATTEMPT(231)
+if(!doublePremise) { goto NEXT_231; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_231; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_231; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_231; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_231; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_231; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_231; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(231)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_231; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_231; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_231; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_231; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 231);}
+NEXT_231:
+RULE_STATS_END(231)
+switch(ruleClass)
+{
+}
+RULE_232:
+{
+RULE_STATS_ATTEMPT(232)
+if(!doublePremise) { goto NEXT_232; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_232; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_232; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_232; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_232; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_232; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_232; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(232)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_232; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_232; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_232; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_232; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 232);}
+NEXT_232:
+RULE_STATS_END(232)
+switch(ruleClass)
+{
+}
+RULE_233:
+{
+RULE_STATS_ATTEMPT(233)
+if(!doublePremise) { goto NEXT_233; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_233; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_233; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_233; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_233; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_233; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_233; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(233)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_233; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_233; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_233; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_233; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 233);}
+NEXT_233:
+RULE_STATS_END(233)
+switch(ruleClass)
+{
+}
+RULE_234:
+{
+RULE_STATS_ATTEMPT(234)
+if(!doublePremise) { goto NEXT_234; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_234; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_234; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_234; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_234; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_234; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_234; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(234)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_234; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_234; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_234; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_234; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 234);}
+NEXT_234:
+RULE_STATS_END(234)
+switch(ruleClass)
+{
+}
+RULE_235:
+{
+RULE_STATS_ATTEMPT(235)
+if(!doublePremise) { goto NEXT_235; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_235; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_235; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_235; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_235; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_235; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_235; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(235)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_235; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_235; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_235; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_235; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 235);}
+NEXT_235:
+RULE_STATS_END(235)
+switch(ruleClass)
+{
+}
+RULE_236:
+{
+RULE_STATS_ATTEMPT(236)
+if(!doublePremise) { goto NEXT_236; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_236; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_236; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_236; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_236; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_236; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_236; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(236)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_236; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_236; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_236; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_236; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 236);}
+NEXT_236:
+RULE_STATS_END(236)
+switch(ruleClass)
+{
+}
+RULE_237:
+{
+RULE_STATS_ATTEMPT(237)
+if(!doublePremise) { goto NEXT_237; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_237; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_237; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_237; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_237; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_237; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_237; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(237)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_237; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_237; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_237; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_237; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 237);}
+NEXT_237:
+RULE_STATS_END(237)
+switch(ruleClass)
+{
+}
+RULE_238:
+{
+RULE_STATS_ATTEMPT(238)
+if(!doublePremise) { goto NEXT_238; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_238; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_238; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_238; }
+substitutions[29] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_238; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_238; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_238; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(238)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_238; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_238; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_238; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_238; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 238);}
+NEXT_238:
+RULE_STATS_END(238)
+switch(ruleClass)
+{
+}
+RULE_239:
+{
+RULE_STATS_ATTEMPT(239)
+if(!doublePremise) { goto NEXT_239; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_239; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_239; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_239; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_239; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_239; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_239; }
+substitutions[29] = subtree;
+RULE_STATS_UNIFICATION(239)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 56;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_239; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_239; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_239; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_239; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 239);}
+NEXT_239:
+RULE_STATS_END(239)
+switch(ruleClass)
+{
+case 199: goto RULE_264;
+}
+RULE_240:
+{
+RULE_STATS_ATTEMPT(240)
+if(!doublePremise) { goto NEXT_240; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_240; }
+if(term1.atoms[1] != 56){ goto NEXT_240; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_240; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_240; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_240; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_240; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_240; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_240; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_240; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(240)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_240; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_240; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_240; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_240; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_240; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 240);}
+NEXT_240:
+RULE_STATS_END(240)
+switch(ruleClass)
+{
+case 181: goto RULE_242;
+}
+RULE_241:
+{
+RULE_STATS_ATTEMPT(241)
+if(!doublePremise) { goto NEXT_241; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_241; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_241; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_241; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_241; }
+if(term2.atoms[1] != 56){ goto NEXT_241; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_241; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_241; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_241; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_241; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(241)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_241; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_241; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_241; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_241; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_241; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 241);}
+NEXT_241:
+RULE_STATS_END(241)
+switch(ruleClass)
+{
+case 118: goto RULE_243;
+}
+RULE_242:
+{
+RULE_STATS_ATTEMPT(242)
+if(!doublePremise) { goto NEXT_242; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_242; }
+if(term1.atoms[1] != 56){ goto NEXT_242; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_242; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_242; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_242; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_242; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_242; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_242; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_242; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(242)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_242; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_242; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_242; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_242; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_242; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 242);}
+NEXT_242:
+RULE_STATS_END(242)
+switch(ruleClass)
+{
+case 181: goto RULE_244;
+}
+RULE_243:
+{
+RULE_STATS_ATTEMPT(243)
+if(!doublePremise) { goto NEXT_243; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_243; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_243; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_243; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_243; }
+if(term2.atoms[1] != 56){ goto NEXT_243; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_243; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_243; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_243; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_243; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(243)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_243; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_243; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_243; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_243; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_243; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 243);}
+NEXT_243:
+RULE_STATS_END(243)
+switch(ruleClass)
+{
+case 118: goto RULE_245;
+}
+RULE_244:
+{
+RULE_STATS_ATTEMPT(244)
+if(!doublePremise) { goto NEXT_244; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_244; }
+if(term1.atoms[1] != 56){ goto NEXT_244; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_244; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_244; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_244; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_244; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_244; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_244; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_244; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(244)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_244; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_244; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_244; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_244; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_244; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 244);}
+NEXT_244:
+RULE_STATS_END(244)
+switch(ruleClass)
+{
+case 181: goto RULE_246;
+}
+RULE_245:
+{
+RULE_STATS_ATTEMPT(245)
+if(!doublePremise) { goto NEXT_245; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_245; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_245; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_245; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_245; }
+if(term2.atoms[1] != 56){ goto NEXT_245; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_245; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_245; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_245; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_245; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(245)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_245; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_245; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_245; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_245; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_245; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 245);}
+NEXT_245:
+RULE_STATS_END(245)
+switch(ruleClass)
+{
+case 118: goto RULE_247;
+}
+RULE_246:
+{
+RULE_STATS_ATTEMPT(246)
+if(!doublePremise) { goto NEXT_246; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_246; }
+if(term1.atoms[1] != 56){ goto NEXT_246; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_246; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_246; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_246; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_246; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_246; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_246; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_246; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(246)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_246; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_246; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_246; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_246; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_246; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 246);}
+NEXT_246:
+RULE_STATS_END(246)
+switch(ruleClass)
+{
+case 181: goto RULE_248;
+}
+RULE_247:
+{
+RULE_STATS_ATTEMPT(247)
+if(!doublePremise) { goto NEXT_247; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_247; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_247; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_247; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_247; }
+if(term2.atoms[1] != 56){ goto NEXT_247; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_247; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_247; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_247; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_247; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(247)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_247; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_247; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_247; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_247; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_247; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 247);}
+NEXT_247:
+RULE_STATS_END(247)
+switch(ruleClass)
+{
+case 118: goto RULE_249;
+}
+RULE_248:
+{
+RULE_STATS_ATTEMPT(248)
+if(!doublePremise) { goto NEXT_248; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_248; }
+if(term1.atoms[1] != 56){ goto NEXT_248; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_248; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_248; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_248; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_248; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_248; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_248; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_248; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(248)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_248; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_248; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_248; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_248; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_248; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 248);}
+NEXT_248:
+RULE_STATS_END(248)
+switch(ruleClass)
+{
+case 181: goto RULE_250;
+}
+RULE_249:
+{
+RULE_STATS_ATTEMPT(249)
+if(!doublePremise) { goto NEXT_249; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_249; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_249; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_249; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_249; }
+if(term2.atoms[1] != 56){ goto NEXT_249; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_249; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_249; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_249; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_249; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(249)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 44;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_249; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_249; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_249; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_249; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_249; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 249);}
+NEXT_249:
+RULE_STATS_END(249)
+switch(ruleClass)
+{
+case 118: goto RULE_251;
+}
+RULE_250:
+{
+RULE_STATS_ATTEMPT(250)
+if(!doublePremise) { goto NEXT_250; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_250; }
+if(term1.atoms[1] != 56){ goto NEXT_250; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_250; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_250; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_250; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_250; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 44){ goto NEXT_250; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_250; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_250; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(250)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_250; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_250; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_250; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_250; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_250; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 250);}
+NEXT_250:
+RULE_STATS_END(250)
+switch(ruleClass)
+{
+case 181: goto RULE_264;
+}
+RULE_251:
+{
+RULE_STATS_ATTEMPT(251)
+if(!doublePremise) { goto NEXT_251; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_251; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_251; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_251; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_251; }
+if(term2.atoms[1] != 56){ goto NEXT_251; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_251; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_251; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_251; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_251; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(251)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 44;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_251; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_251; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_251; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_251; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_251; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 251);}
+NEXT_251:
+RULE_STATS_END(251)
+switch(ruleClass)
+{
+case 118: goto RULE_264;
+}
+RULE_252:
+{
+RULE_STATS_ATTEMPT(252)
+if(!doublePremise) { goto NEXT_252; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_252; }
+if(term1.atoms[1] != 56){ goto NEXT_252; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_252; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_252; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_252; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_252; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_252; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_252; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_252; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(252)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_252; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_252; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_252; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_252; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_252; }
+Truth conclusionTruth = Truth_Induction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 252);}
+NEXT_252:
+RULE_STATS_END(252)
+switch(ruleClass)
+{
+case 189: goto RULE_254;
+}
+RULE_253:
+{
+RULE_STATS_ATTEMPT(253)
+if(!doublePremise) { goto NEXT_253; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_253; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_253; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_253; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_253; }
+if(term2.atoms[1] != 56){ goto NEXT_253; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_253; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_253; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_253; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_253; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(253)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_253; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_253; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_253; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_253; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_253; }
+Truth conclusionTruth = Truth_Induction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 253);}
+NEXT_253:
+RULE_STATS_END(253)
+switch(ruleClass)
+{
+case 198: goto RULE_255;
+}
+RULE_254:
+{
+RULE_STATS_ATTEMPT(254)
+if(!doublePremise) { goto NEXT_254; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_254; }
+if(term1.atoms[1] != 56){ goto NEXT_254; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_254; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_254; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_254; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_254; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_254; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_254; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_254; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(254)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 56;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_254; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_254; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_254; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_254; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_254; }
+Truth conclusionTruth = Truth_Abduction(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 254);}
+NEXT_254:
+RULE_STATS_END(254)
+switch(ruleClass)
+{
+case 189: goto RULE_256;
+}
+RULE_255:
+{
+RULE_STATS_ATTEMPT(255)
+if(!doublePremise) { goto NEXT_255; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_255; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_255; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_255; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_255; }
+if(term2.atoms[1] != 56){ goto NEXT_255; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_255; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_255; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_255; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_255; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(255)
+Term conclusion = {0};
+conclusion.atoms[0] = 58;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 56;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_255; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_255; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_255; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_255; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_255; }
+Truth conclusionTruth = Truth_Abduction(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 255);}
+NEXT_255:
+RULE_STATS_END(255)
+switch(ruleClass)
+{
+case 198: goto RULE_257;
+}
+RULE_256:
+{
+RULE_STATS_ATTEMPT(256)
+if(!doublePremise) { goto NEXT_256; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_256; }
+if(term1.atoms[1] != 56){ goto NEXT_256; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_256; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_256; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_256; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_256; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_256; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_256; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_256; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(256)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 56;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_256; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_256; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_256; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_256; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_256; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 256);}
+NEXT_256:
+RULE_STATS_END(256)
+switch(ruleClass)
+{
+case 189: goto RULE_258;
+}
+RULE_257:
+{
+RULE_STATS_ATTEMPT(257)
+if(!doublePremise) { goto NEXT_257; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_257; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_257; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_257; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_257; }
+if(term2.atoms[1] != 56){ goto NEXT_257; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_257; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_257; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_257; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_257; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(257)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 56;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_257; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_257; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_257; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_257; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_257; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 257);}
+NEXT_257:
+RULE_STATS_END(257)
+switch(ruleClass)
+{
+case 198: goto RULE_259;
+}
+RULE_258:
+{
+RULE_STATS_ATTEMPT(258)
+if(!doublePremise) { goto NEXT_258; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_258; }
+if(term1.atoms[1] != 56){ goto NEXT_258; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_258; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_258; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_258; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_258; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_258; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_258; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_258; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(258)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_258; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_258; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_258; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_258; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_258; }
+Truth conclusionTruth = Truth_Comparison(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 258);}
+NEXT_258:
+RULE_STATS_END(258)
+switch(ruleClass)
+{
+case 189: goto RULE_260;
+}
+RULE_259:
+{
+RULE_STATS_ATTEMPT(259)
+if(!doublePremise) { goto NEXT_259; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_259; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_259; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_259; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_259; }
+if(term2.atoms[1] != 56){ goto NEXT_259; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_259; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_259; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_259; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_259; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(259)
+Term conclusion = {0};
+conclusion.atoms[0] = 59;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_259; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_259; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_259; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_259; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_259; }
+Truth conclusionTruth = Truth_Comparison(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 259);}
+NEXT_259:
+RULE_STATS_END(259)
+switch(ruleClass)
+{
+case 198: goto RULE_261;
+}
+RULE_260:
+{
+RULE_STATS_ATTEMPT(260)
+if(!doublePremise) { goto NEXT_260; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_260; }
+if(term1.atoms[1] != 56){ goto NEXT_260; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_260; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_260; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_260; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_260; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_260; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_260; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_260; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(260)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 56;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_260; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_260; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_260; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_260; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_260; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 260);}
+NEXT_260:
+RULE_STATS_END(260)
+switch(ruleClass)
+{
+case 189: goto RULE_262;
+}
+RULE_261:
+{
+RULE_STATS_ATTEMPT(261)
+if(!doublePremise) { goto NEXT_261; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_261; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_261; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_261; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_261; }
+if(term2.atoms[1] != 56){ goto NEXT_261; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_261; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_261; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_261; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_261; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(261)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 46;
+conclusion.atoms[2] = 56;
+conclusion.atoms[3] = 56;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_261; }
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[33])){ goto NEXT_261; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[34])){ goto NEXT_261; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_261; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[38])){ goto NEXT_261; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 261);}
+NEXT_261:
+RULE_STATS_END(261)
+switch(ruleClass)
+{
+case 198: goto RULE_263;
+}
+RULE_262:
+{
+RULE_STATS_ATTEMPT(262)
+if(!doublePremise) { goto NEXT_262; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 46){ goto NEXT_262; }
+if(term1.atoms[1] != 56){ goto NEXT_262; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_262; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_262; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_262; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_262; }
+substitutions[38] = subtree;
+if(term2.atoms[0] != 56){ goto NEXT_262; }
+subtree = Term_ExtractSubterm(&term2, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_262; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_262; }
+substitutions[34] = subtree;
+RULE_STATS_UNIFICATION(262)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_262; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_262; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_262; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_262; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_262; }
+Truth conclusionTruth = Truth_Intersection(truth1,truth2);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 262);}
+NEXT_262:
+RULE_STATS_END(262)
+switch(ruleClass)
+{
+case 189: goto RULE_264;
+}
+RULE_263:
+{
+RULE_STATS_ATTEMPT(263)
+if(!doublePremise) { goto NEXT_263; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 56){ goto NEXT_263; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[33].atoms[0]!=0 && !Term_Equal(&substitutions[33], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_263; }
+substitutions[33] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[34].atoms[0]!=0 && !Term_Equal(&substitutions[34], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_263; }
+substitutions[34] = subtree;
+if(term2.atoms[0] != 46){ goto NEXT_263; }
+if(term2.atoms[1] != 56){ goto NEXT_263; }
+subtree = Term_ExtractSubterm(&term2, 2);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_263; }
+substitutions[30] = subtree;
+subtree = Term_ExtractSubterm(&term2, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_263; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term2, 4);
+if((substitutions[38].atoms[0]!=0 && !Term_Equal(&substitutions[38], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_263; }
+if(!Narsese_isOperation(&subtree)) { goto NEXT_263; }
+substitutions[38] = subtree;
+RULE_STATS_UNIFICATION(263)
+Term conclusion = {0};
+conclusion.atoms[0] = 43;
+conclusion.atoms[1] = 56;
+conclusion.atoms[2] = 46;
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[33])){ goto NEXT_263; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[34])){ goto NEXT_263; }
+conclusion.atoms[5] = 56;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_263; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_263; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[38])){ goto NEXT_263; }
+Truth conclusionTruth = Truth_Intersection(truth2,truth1);
+NAL_DerivedEvent(RuleTable_Reduce(conclusion), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, occurrenceTimeOffset, validation_concept, validation_cid, 1, 263);}
+NEXT_263:
+RULE_STATS_END(263)
+switch(ruleClass)
+{
+}
+RULE_264:;
+}
+Term RuleTable_Reduce(Term term1)
+{
+bool doublePremise = false;
+goto RULE_264;
+RULE_264:
+{
+if(doublePremise) { goto NEXT_264; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_264; }
+if(term1.atoms[1] != 41){ goto NEXT_264; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_264; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_264; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_264; }
+substitutions[28] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_264; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_264; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_264:;
+RULE_265:
+{
+if(doublePremise) { goto NEXT_265; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_265; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_265; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 41){ goto NEXT_265; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_265; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_265; }
+substitutions[28] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_265; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_265; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_265:;
+RULE_266:
+{
+if(doublePremise) { goto NEXT_266; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_266; }
+if(term1.atoms[1] != 42){ goto NEXT_266; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_266; }
+substitutions[31] = subtree;
+subtree = Term_ExtractSubterm(&term1, 3);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_266; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 4);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_266; }
+substitutions[28] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[28])){ goto NEXT_266; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_266; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_266:;
+RULE_267:
+{
+if(doublePremise) { goto NEXT_267; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_267; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_267; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 42){ goto NEXT_267; }
+subtree = Term_ExtractSubterm(&term1, 5);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_267; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 6);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_267; }
+substitutions[28] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_267; }
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[28])){ goto NEXT_267; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_267:;
+RULE_268:
+{
+if(doublePremise) { goto NEXT_268; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 43){ goto NEXT_268; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_268; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_268; }
+substitutions[28] = subtree;
+Term conclusion = {0};
+if(!Term_OverrideSubterm(&conclusion,0,&substitutions[28])){ goto NEXT_268; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_268:;
+RULE_269:
+{
+if(doublePremise) { goto NEXT_269; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_269; }
+if(term1.atoms[1] != 42){ goto NEXT_269; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_269; }
+substitutions[31] = subtree;
+if(term1.atoms[3] != 48){ goto NEXT_269; }
+if(term1.atoms[4] != 48){ goto NEXT_269; }
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_269; }
+substitutions[28] = subtree;
+if(term1.atoms[8] != 39){ goto NEXT_269; }
+subtree = Term_ExtractSubterm(&term1, 9);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_269; }
+substitutions[29] = subtree;
+if(term1.atoms[10] != 39){ goto NEXT_269; }
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 48;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_269; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_269; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_269; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_269:;
+RULE_270:
+{
+if(doublePremise) { goto NEXT_270; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_270; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_270; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 42){ goto NEXT_270; }
+if(term1.atoms[5] != 48){ goto NEXT_270; }
+if(term1.atoms[6] != 48){ goto NEXT_270; }
+subtree = Term_ExtractSubterm(&term1, 11);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_270; }
+substitutions[28] = subtree;
+if(term1.atoms[12] != 39){ goto NEXT_270; }
+subtree = Term_ExtractSubterm(&term1, 13);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_270; }
+substitutions[29] = subtree;
+if(term1.atoms[14] != 39){ goto NEXT_270; }
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_270; }
+conclusion.atoms[2] = 48;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_270; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_270; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_270:;
+RULE_271:
+{
+if(doublePremise) { goto NEXT_271; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_271; }
+if(term1.atoms[1] != 42){ goto NEXT_271; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_271; }
+substitutions[31] = subtree;
+if(term1.atoms[3] != 48){ goto NEXT_271; }
+if(term1.atoms[4] != 48){ goto NEXT_271; }
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_271; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 8);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_271; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 9);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_271; }
+substitutions[30] = subtree;
+if(term1.atoms[10] != 39){ goto NEXT_271; }
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 48;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_271; }
+conclusion.atoms[3] = 51;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_271; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_271; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[29])){ goto NEXT_271; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_271:;
+RULE_272:
+{
+if(doublePremise) { goto NEXT_272; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_272; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_272; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 42){ goto NEXT_272; }
+if(term1.atoms[5] != 48){ goto NEXT_272; }
+if(term1.atoms[6] != 48){ goto NEXT_272; }
+subtree = Term_ExtractSubterm(&term1, 11);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_272; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 12);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_272; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 13);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_272; }
+substitutions[30] = subtree;
+if(term1.atoms[14] != 39){ goto NEXT_272; }
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_272; }
+conclusion.atoms[2] = 48;
+conclusion.atoms[5] = 51;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_272; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_272; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[29])){ goto NEXT_272; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_272:;
+RULE_273:
+{
+if(doublePremise) { goto NEXT_273; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_273; }
+if(term1.atoms[1] != 42){ goto NEXT_273; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_273; }
+substitutions[31] = subtree;
+if(term1.atoms[3] != 48){ goto NEXT_273; }
+if(term1.atoms[4] != 48){ goto NEXT_273; }
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_273; }
+substitutions[30] = subtree;
+if(term1.atoms[8] != 39){ goto NEXT_273; }
+subtree = Term_ExtractSubterm(&term1, 9);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_273; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 10);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_273; }
+substitutions[29] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 48;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_273; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[30])){ goto NEXT_273; }
+conclusion.atoms[4] = 51;
+if(!Term_OverrideSubterm(&conclusion,9,&substitutions[28])){ goto NEXT_273; }
+if(!Term_OverrideSubterm(&conclusion,10,&substitutions[29])){ goto NEXT_273; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_273:;
+RULE_274:
+{
+if(doublePremise) { goto NEXT_274; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_274; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_274; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 42){ goto NEXT_274; }
+if(term1.atoms[5] != 48){ goto NEXT_274; }
+if(term1.atoms[6] != 48){ goto NEXT_274; }
+subtree = Term_ExtractSubterm(&term1, 11);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_274; }
+substitutions[30] = subtree;
+if(term1.atoms[12] != 39){ goto NEXT_274; }
+subtree = Term_ExtractSubterm(&term1, 13);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_274; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 14);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_274; }
+substitutions[29] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_274; }
+conclusion.atoms[2] = 48;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[30])){ goto NEXT_274; }
+conclusion.atoms[6] = 51;
+if(!Term_OverrideSubterm(&conclusion,13,&substitutions[28])){ goto NEXT_274; }
+if(!Term_OverrideSubterm(&conclusion,14,&substitutions[29])){ goto NEXT_274; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_274:;
+RULE_275:
+{
+if(doublePremise) { goto NEXT_275; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_275; }
+if(term1.atoms[1] != 41){ goto NEXT_275; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_275; }
+substitutions[31] = subtree;
+if(term1.atoms[3] != 47){ goto NEXT_275; }
+if(term1.atoms[4] != 47){ goto NEXT_275; }
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_275; }
+substitutions[28] = subtree;
+if(term1.atoms[8] != 39){ goto NEXT_275; }
+subtree = Term_ExtractSubterm(&term1, 9);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_275; }
+substitutions[29] = subtree;
+if(term1.atoms[10] != 39){ goto NEXT_275; }
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 47;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_275; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_275; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_275; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_275:;
+RULE_276:
+{
+if(doublePremise) { goto NEXT_276; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_276; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_276; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 41){ goto NEXT_276; }
+if(term1.atoms[5] != 47){ goto NEXT_276; }
+if(term1.atoms[6] != 47){ goto NEXT_276; }
+subtree = Term_ExtractSubterm(&term1, 11);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_276; }
+substitutions[28] = subtree;
+if(term1.atoms[12] != 39){ goto NEXT_276; }
+subtree = Term_ExtractSubterm(&term1, 13);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_276; }
+substitutions[29] = subtree;
+if(term1.atoms[14] != 39){ goto NEXT_276; }
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_276; }
+conclusion.atoms[2] = 47;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_276; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_276; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_276:;
+RULE_277:
+{
+if(doublePremise) { goto NEXT_277; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_277; }
+if(term1.atoms[1] != 41){ goto NEXT_277; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_277; }
+substitutions[31] = subtree;
+if(term1.atoms[3] != 47){ goto NEXT_277; }
+if(term1.atoms[4] != 47){ goto NEXT_277; }
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_277; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 8);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_277; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 9);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_277; }
+substitutions[30] = subtree;
+if(term1.atoms[10] != 39){ goto NEXT_277; }
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 47;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_277; }
+conclusion.atoms[3] = 51;
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[30])){ goto NEXT_277; }
+if(!Term_OverrideSubterm(&conclusion,7,&substitutions[28])){ goto NEXT_277; }
+if(!Term_OverrideSubterm(&conclusion,8,&substitutions[29])){ goto NEXT_277; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_277:;
+RULE_278:
+{
+if(doublePremise) { goto NEXT_278; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_278; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_278; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 41){ goto NEXT_278; }
+if(term1.atoms[5] != 47){ goto NEXT_278; }
+if(term1.atoms[6] != 47){ goto NEXT_278; }
+subtree = Term_ExtractSubterm(&term1, 11);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_278; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 12);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_278; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 13);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_278; }
+substitutions[30] = subtree;
+if(term1.atoms[14] != 39){ goto NEXT_278; }
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_278; }
+conclusion.atoms[2] = 47;
+conclusion.atoms[5] = 51;
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[30])){ goto NEXT_278; }
+if(!Term_OverrideSubterm(&conclusion,11,&substitutions[28])){ goto NEXT_278; }
+if(!Term_OverrideSubterm(&conclusion,12,&substitutions[29])){ goto NEXT_278; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_278:;
+RULE_279:
+{
+if(doublePremise) { goto NEXT_279; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_279; }
+if(term1.atoms[1] != 41){ goto NEXT_279; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_279; }
+substitutions[31] = subtree;
+if(term1.atoms[3] != 47){ goto NEXT_279; }
+if(term1.atoms[4] != 47){ goto NEXT_279; }
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_279; }
+substitutions[28] = subtree;
+if(term1.atoms[8] != 39){ goto NEXT_279; }
+subtree = Term_ExtractSubterm(&term1, 9);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_279; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 10);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_279; }
+substitutions[30] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 47;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_279; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_279; }
+conclusion.atoms[4] = 51;
+if(!Term_OverrideSubterm(&conclusion,9,&substitutions[29])){ goto NEXT_279; }
+if(!Term_OverrideSubterm(&conclusion,10,&substitutions[30])){ goto NEXT_279; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_279:;
+RULE_280:
+{
+if(doublePremise) { goto NEXT_280; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_280; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_280; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 41){ goto NEXT_280; }
+if(term1.atoms[5] != 47){ goto NEXT_280; }
+if(term1.atoms[6] != 47){ goto NEXT_280; }
+subtree = Term_ExtractSubterm(&term1, 11);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_280; }
+substitutions[28] = subtree;
+if(term1.atoms[12] != 39){ goto NEXT_280; }
+subtree = Term_ExtractSubterm(&term1, 13);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_280; }
+substitutions[29] = subtree;
+subtree = Term_ExtractSubterm(&term1, 14);
+if((substitutions[30].atoms[0]!=0 && !Term_Equal(&substitutions[30], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_280; }
+substitutions[30] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_280; }
+conclusion.atoms[2] = 47;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_280; }
+conclusion.atoms[6] = 51;
+if(!Term_OverrideSubterm(&conclusion,13,&substitutions[29])){ goto NEXT_280; }
+if(!Term_OverrideSubterm(&conclusion,14,&substitutions[30])){ goto NEXT_280; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_280:;
+RULE_281:
+{
+if(doublePremise) { goto NEXT_281; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_281; }
+if(term1.atoms[1] != 48){ goto NEXT_281; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_281; }
+substitutions[31] = subtree;
+if(term1.atoms[3] != 51){ goto NEXT_281; }
+if(term1.atoms[4] != 39){ goto NEXT_281; }
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_281; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 8);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_281; }
+substitutions[29] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 48;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_281; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_281; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_281; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_281:;
+RULE_282:
+{
+if(doublePremise) { goto NEXT_282; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_282; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_282; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 48){ goto NEXT_282; }
+if(term1.atoms[5] != 51){ goto NEXT_282; }
+if(term1.atoms[6] != 39){ goto NEXT_282; }
+subtree = Term_ExtractSubterm(&term1, 11);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_282; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 12);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_282; }
+substitutions[29] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_282; }
+conclusion.atoms[2] = 48;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_282; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_282; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_282:;
+RULE_283:
+{
+if(doublePremise) { goto NEXT_283; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_283; }
+if(term1.atoms[1] != 47){ goto NEXT_283; }
+subtree = Term_ExtractSubterm(&term1, 2);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_283; }
+substitutions[31] = subtree;
+if(term1.atoms[3] != 51){ goto NEXT_283; }
+if(term1.atoms[4] != 39){ goto NEXT_283; }
+subtree = Term_ExtractSubterm(&term1, 7);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_283; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 8);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_283; }
+substitutions[29] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+conclusion.atoms[1] = 47;
+if(!Term_OverrideSubterm(&conclusion,2,&substitutions[31])){ goto NEXT_283; }
+if(!Term_OverrideSubterm(&conclusion,3,&substitutions[28])){ goto NEXT_283; }
+if(!Term_OverrideSubterm(&conclusion,4,&substitutions[29])){ goto NEXT_283; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_283:;
+RULE_284:
+{
+if(doublePremise) { goto NEXT_284; }
+Term substitutions[27+NUM_ELEMENTS(Narsese_RuleTableVars)+1] = {0}; Term subtree = {0};
+if(term1.atoms[0] != 44){ goto NEXT_284; }
+subtree = Term_ExtractSubterm(&term1, 1);
+if((substitutions[31].atoms[0]!=0 && !Term_Equal(&substitutions[31], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_284; }
+substitutions[31] = subtree;
+if(term1.atoms[2] != 47){ goto NEXT_284; }
+if(term1.atoms[5] != 51){ goto NEXT_284; }
+if(term1.atoms[6] != 39){ goto NEXT_284; }
+subtree = Term_ExtractSubterm(&term1, 11);
+if((substitutions[28].atoms[0]!=0 && !Term_Equal(&substitutions[28], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_284; }
+substitutions[28] = subtree;
+subtree = Term_ExtractSubterm(&term1, 12);
+if((substitutions[29].atoms[0]!=0 && !Term_Equal(&substitutions[29], &subtree)) || Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)){ goto NEXT_284; }
+substitutions[29] = subtree;
+Term conclusion = {0};
+conclusion.atoms[0] = 44;
+if(!Term_OverrideSubterm(&conclusion,1,&substitutions[31])){ goto NEXT_284; }
+conclusion.atoms[2] = 47;
+if(!Term_OverrideSubterm(&conclusion,5,&substitutions[28])){ goto NEXT_284; }
+if(!Term_OverrideSubterm(&conclusion,6,&substitutions[29])){ goto NEXT_284; }
+IN_DEBUG( fputs("Reduced: ", stdout); Narsese_PrintTerm(&term1); fputs(" -> ", stdout); Narsese_PrintTerm(&conclusion); puts(""); ) 
+return conclusion;
+}
+NEXT_284:;
+RULE_285:;
+return term1;
+}
+
+char *RuleTable_ruleNames[] = {
+"(S --> M), (M --> P) |- (S --> P) Truth_Deduction",
+"(M --> P), (S --> M) |- (S --> P) Truth_Deduction",
+"(A --> B), (A --> C) |- (C --> B) Truth_Induction",
+"(A --> C), (A --> B) |- (C --> B) Truth_Induction",
+"(A --> C), (B --> C) |- (B --> A) Truth_Abduction",
+"(B --> C), (A --> C) |- (B --> A) Truth_Abduction",
+"(A --> B), (B --> C) |- (C --> A) Truth_Exemplification",
+"(B --> C), (A --> B) |- (C --> A) Truth_Exemplification",
+"(S <-> P) |- (P <-> S) Truth_StructuralDeduction",
+"(M <-> P), (S <-> M) |- (S <-> P) Truth_Resemblance",
+"(S <-> M), (M <-> P) |- (S <-> P) Truth_Resemblance",
+"(P --> M), (S --> M) |- (S <-> P) Truth_Comparison",
+"(S --> M), (P --> M) |- (S <-> P) Truth_Comparison",
+"(M --> P), (M --> S) |- (S <-> P) Truth_Comparison",
+"(M --> S), (M --> P) |- (S <-> P) Truth_Comparison",
+"(M --> P), (S <-> M) |- (S --> P) Truth_Analogy",
+"(S <-> M), (M --> P) |- (S --> P) Truth_Analogy",
+"(P --> M), (S <-> M) |- (P --> S) Truth_Analogy",
+"(S <-> M), (P --> M) |- (P --> S) Truth_Analogy",
+"(S --> {P}) |- (S <-> {P}) Truth_StructuralDeduction",
+"([S] --> P) |- ([S] <-> P) Truth_StructuralDeduction",
+"({M} --> P), (S <-> M) |- ({S} --> P) Truth_Analogy",
+"(S <-> M), ({M} --> P) |- ({S} --> P) Truth_Analogy",
+"(P --> [M]), (S <-> M) |- (P --> [S]) Truth_Analogy",
+"(S <-> M), (P --> [M]) |- (P --> [S]) Truth_Analogy",
+"({A} <-> {B}) |- (A <-> B) Truth_StructuralDeduction",
+"([A] <-> [B]) |- (A <-> B) Truth_StructuralDeduction",
+"({A B} --> M) |- <{A} --> M> Truth_StructuralDeduction",
+"({A B} --> M) |- <{B} --> M> Truth_StructuralDeduction",
+"(M --> [A B]) |- <M --> [A]> Truth_StructuralDeduction",
+"(M --> [A B]) |- <M --> [B]> Truth_StructuralDeduction",
+"((S | P) --> M) |- (S --> M) Truth_StructuralDeduction",
+"(M --> (S & P)) |- (M --> S) Truth_StructuralDeduction",
+"((S | P) --> M) |- (P --> M) Truth_StructuralDeduction",
+"(M --> (S & P)) |- (M --> P) Truth_StructuralDeduction",
+"((A ~ S) --> M) |- (A --> M) Truth_StructuralDeduction",
+"(M --> (B - S)) |- (M --> B) Truth_StructuralDeduction",
+"((A ~ S) --> M) |- (S --> M) Truth_StructuralDeductionNegated",
+"(M --> (B - S)) |- (M --> S) Truth_StructuralDeductionNegated",
+"(P --> M), (S --> M) |- ((P | S) --> M) Truth_Intersection",
+"(S --> M), (P --> M) |- ((P | S) --> M) Truth_Intersection",
+"(P --> M), (S --> M) |- ((P & S) --> M) Truth_Union",
+"(S --> M), (P --> M) |- ((P & S) --> M) Truth_Union",
+"(P --> M), (S --> M) |- ((P ~ S) --> M) Truth_Difference",
+"(S --> M), (P --> M) |- ((P ~ S) --> M) Truth_Difference",
+"(M --> P), (M --> S) |- (M --> (P & S)) Truth_Intersection",
+"(M --> S), (M --> P) |- (M --> (P & S)) Truth_Intersection",
+"(M --> P), (M --> S) |- (M --> (P | S)) Truth_Union",
+"(M --> S), (M --> P) |- (M --> (P | S)) Truth_Union",
+"(M --> P), (M --> S) |- (M --> (P - S)) Truth_Difference",
+"(M --> S), (M --> P) |- (M --> (P - S)) Truth_Difference",
+"(S --> M), ((S | P) --> M) |- (P --> M) Truth_DecomposePNN",
+"((S | P) --> M), (S --> M) |- (P --> M) Truth_DecomposePNN",
+"(P --> M), ((S | P) --> M) |- (S --> M) Truth_DecomposePNN",
+"((S | P) --> M), (P --> M) |- (S --> M) Truth_DecomposePNN",
+"(S --> M), ((S & P) --> M) |- (P --> M) Truth_DecomposeNPP",
+"((S & P) --> M), (S --> M) |- (P --> M) Truth_DecomposeNPP",
+"(P --> M), ((S & P) --> M) |- (S --> M) Truth_DecomposeNPP",
+"((S & P) --> M), (P --> M) |- (S --> M) Truth_DecomposeNPP",
+"(S --> M), ((S ~ P) --> M) |- (P --> M) Truth_DecomposePNP",
+"((S ~ P) --> M), (S --> M) |- (P --> M) Truth_DecomposePNP",
+"(S --> M), ((P ~ S) --> M) |- (P --> M) Truth_DecomposeNNN",
+"((P ~ S) --> M), (S --> M) |- (P --> M) Truth_DecomposeNNN",
+"(M --> S), (M --> (S & P)) |- (M --> P) Truth_DecomposePNN",
+"(M --> (S & P)), (M --> S) |- (M --> P) Truth_DecomposePNN",
+"(M --> P), (M --> (S & P)) |- (M --> S) Truth_DecomposePNN",
+"(M --> (S & P)), (M --> P) |- (M --> S) Truth_DecomposePNN",
+"(M --> S), (M --> (S | P)) |- (M --> P) Truth_DecomposeNPP",
+"(M --> (S | P)), (M --> S) |- (M --> P) Truth_DecomposeNPP",
+"(M --> P), (M --> (S | P)) |- (M --> S) Truth_DecomposeNPP",
+"(M --> (S | P)), (M --> P) |- (M --> S) Truth_DecomposeNPP",
+"(M --> S), (M --> (S - P)) |- (M --> P) Truth_DecomposePNP",
+"(M --> (S - P)), (M --> S) |- (M --> P) Truth_DecomposePNP",
+"(M --> S), (M --> (P - S)) |- (M --> P) Truth_DecomposeNNN",
+"(M --> (P - S)), (M --> S) |- (M --> P) Truth_DecomposeNNN",
+"((A * B) --> R) |- (A --> (R /1 B)) Truth_StructuralDeduction",
+"(A --> (R /1 B)) |- ((A * B) --> R) Truth_StructuralDeduction",
+"((A * B) --> R) |- (B --> (R /2 A)) Truth_StructuralDeduction",
+"(B --> (R /2 A)) |- ((A * B) --> R) Truth_StructuralDeduction",
+"(R --> (A * B)) |- ((R \\1 B) --> A) Truth_StructuralDeduction",
+"((R \\1 B) --> A) |- (R --> (A * B)) Truth_StructuralDeduction",
+"(R --> (A * B)) |- ((R \\2 A) --> B) Truth_StructuralDeduction",
+"((R \\2 A) --> B) |- (R --> (A * B)) Truth_StructuralDeduction",
+"((A * B) --> R), ((C * B) --> R) |- (C --> A) Truth_Abduction",
+"((C * B) --> R), ((A * B) --> R) |- (C --> A) Truth_Abduction",
+"((A * B) --> R), ((A * C) --> R) |- (C --> B) Truth_Abduction",
+"((A * C) --> R), ((A * B) --> R) |- (C --> B) Truth_Abduction",
+"(R --> (A * B)), (R --> (C * B)) |- (C --> A) Truth_Induction",
+"(R --> (C * B)), (R --> (A * B)) |- (C --> A) Truth_Induction",
+"(R --> (A * B)), (R --> (A * C)) |- (C --> B) Truth_Induction",
+"(R --> (A * C)), (R --> (A * B)) |- (C --> B) Truth_Induction",
+"((A * B) --> R), (C --> A) |- ((C * B) --> R) Truth_Deduction",
+"(C --> A), ((A * B) --> R) |- ((C * B) --> R) Truth_Deduction",
+"((A * B) --> R), (A --> C) |- ((C * B) --> R) Truth_Induction",
+"(A --> C), ((A * B) --> R) |- ((C * B) --> R) Truth_Induction",
+"((A * B) --> R), (C <-> A) |- ((C * B) --> R) Truth_Analogy",
+"(C <-> A), ((A * B) --> R) |- ((C * B) --> R) Truth_Analogy",
+"((A * B) --> R), (C --> B) |- ((A * C) --> R) Truth_Deduction",
+"(C --> B), ((A * B) --> R) |- ((A * C) --> R) Truth_Deduction",
+"((A * B) --> R), (B --> C) |- ((A * C) --> R) Truth_Induction",
+"(B --> C), ((A * B) --> R) |- ((A * C) --> R) Truth_Induction",
+"((A * B) --> R), (C <-> B) |- ((A * C) --> R) Truth_Analogy",
+"(C <-> B), ((A * B) --> R) |- ((A * C) --> R) Truth_Analogy",
+"(R --> (A * B)), (A --> C) |- (R --> (C * B)) Truth_Deduction",
+"(A --> C), (R --> (A * B)) |- (R --> (C * B)) Truth_Deduction",
+"(R --> (A * B)), (C --> A) |- (R --> (C * B)) Truth_Abduction",
+"(C --> A), (R --> (A * B)) |- (R --> (C * B)) Truth_Abduction",
+"(R --> (A * B)), (C <-> A) |- (R --> (C * B)) Truth_Analogy",
+"(C <-> A), (R --> (A * B)) |- (R --> (C * B)) Truth_Analogy",
+"(R --> (A * B)), (B --> C) |- (R --> (A * C)) Truth_Deduction",
+"(B --> C), (R --> (A * B)) |- (R --> (A * C)) Truth_Deduction",
+"(R --> (A * B)), (C --> B) |- (R --> (A * C)) Truth_Abduction",
+"(C --> B), (R --> (A * B)) |- (R --> (A * C)) Truth_Abduction",
+"(R --> (A * B)), (C <-> B) |- (R --> (A * C)) Truth_Analogy",
+"(C <-> B), (R --> (A * B)) |- (R --> (A * C)) Truth_Analogy",
+"((A * B) --> R), ((C * B) --> R) |- (A <-> C) Truth_Comparison",
+"((C * B) --> R), ((A * B) --> R) |- (A <-> C) Truth_Comparison",
+"((A * B) --> R), ((A * C) --> R) |- (B <-> C) Truth_Comparison",
+"((A * C) --> R), ((A * B) --> R) |- (B <-> C) Truth_Comparison",
+"(R --> (A * B)), (R --> (C * B)) |- (A <-> C) Truth_Comparison",
+"(R --> (C * B)), (R --> (A * B)) |- (A <-> C) Truth_Comparison",
+"(R --> (A * B)), (R --> (A * C)) |- (B <-> C) Truth_Comparison",
+"(R --> (A * C)), (R --> (A * B)) |- (B <-> C) Truth_Comparison",
+"(! A) |- A Truth_Negation",
+"(A && B) |- A Truth_StructuralDeduction",
+"(A && B) |- B Truth_StructuralDeduction",
+"(A && B) |- (B && A) Truth_StructuralDeduction",
+"S, (&& S A) |- A Truth_DecomposePNN",
+"(&& S A), S |- A Truth_DecomposePNN",
+"S, (|| S A) |- A Truth_DecomposeNPP",
+"(|| S A), S |- A Truth_DecomposeNPP",
+"S, (&& (! S) A) |- A Truth_DecomposeNNN",
+"(&& (! S) A), S |- A Truth_DecomposeNNN",
+"S, (|| (! S) A) |- A Truth_DecomposePPP",
+"(|| (! S) A), S |- A Truth_DecomposePPP",
+"(S ==> M), (M ==> P) |- (S ==> P) Truth_Deduction",
+"(M ==> P), (S ==> M) |- (S ==> P) Truth_Deduction",
+"(A ==> B), (A ==> C) |- (C ==> B) Truth_Induction",
+"(A ==> C), (A ==> B) |- (C ==> B) Truth_Induction",
+"(A ==> C), (B ==> C) |- (B ==> A) Truth_Abduction",
+"(B ==> C), (A ==> C) |- (B ==> A) Truth_Abduction",
+"(A ==> B), (B ==> C) |- (C ==> A) Truth_Exemplification",
+"(B ==> C), (A ==> B) |- (C ==> A) Truth_Exemplification",
+"(A ==> C), (B ==> C) |- ((A && B) ==> C) Truth_Union",
+"(B ==> C), (A ==> C) |- ((A && B) ==> C) Truth_Union",
+"(A ==> C), (B ==> C) |- ((A || B) ==> C) Truth_Intersection",
+"(B ==> C), (A ==> C) |- ((A || B) ==> C) Truth_Intersection",
+"(C ==> A), (C ==> B) |- (C ==> (A && B)) Truth_Intersection",
+"(C ==> B), (C ==> A) |- (C ==> (A && B)) Truth_Intersection",
+"(C ==> A), (C ==> B) |- (C ==> (A || B)) Truth_Union",
+"(C ==> B), (C ==> A) |- (C ==> (A || B)) Truth_Union",
+"((S && P) ==> M), (S ==> M) |- P Truth_Abduction",
+"(S ==> M), ((S && P) ==> M) |- P Truth_Abduction",
+"((C && M) ==> P), (S ==> M) |- ((C && S) ==> P) Truth_Deduction",
+"(S ==> M), ((C && M) ==> P) |- ((C && S) ==> P) Truth_Deduction",
+"((C && P) ==> M), ((C && S) ==> M) |- (S ==> P) Truth_Abduction",
+"((C && S) ==> M), ((C && P) ==> M) |- (S ==> P) Truth_Abduction",
+"((C && M) ==> P), (M ==> S) |- ((C && S) ==> P) Truth_Induction",
+"(M ==> S), ((C && M) ==> P) |- ((C && S) ==> P) Truth_Induction",
+"(S <=> P) |- (P <=> S) Truth_StructuralDeduction",
+"(S ==> P), (P ==> S) |- (S <=> P) Truth_Intersection",
+"(P ==> S), (S ==> P) |- (S <=> P) Truth_Intersection",
+"(P ==> M), (S ==> M) |- (S <=> P) Truth_Comparison",
+"(S ==> M), (P ==> M) |- (S <=> P) Truth_Comparison",
+"(M ==> P), (M ==> S) |- (S <=> P) Truth_Comparison",
+"(M ==> S), (M ==> P) |- (S <=> P) Truth_Comparison",
+"(M ==> P), (S <=> M) |- (S ==> P) Truth_Analogy",
+"(S <=> M), (M ==> P) |- (S ==> P) Truth_Analogy",
+"(P ==> M), (S <=> M) |- (P ==> S) Truth_Analogy",
+"(S <=> M), (P ==> M) |- (P ==> S) Truth_Analogy",
+"(M <=> P), (S <=> M) |- (S <=> P) Truth_Resemblance",
+"(S <=> M), (M <=> P) |- (S <=> P) Truth_Resemblance",
+"(C --> A), (C --> B) |- ((C --> B) ==> (C --> A)) Truth_Induction",
+"(C --> B), (C --> A) |- ((C --> B) ==> (C --> A)) Truth_Induction",
+"(A --> C), (B --> C) |- ((B --> C) ==> (A --> C)) Truth_Induction",
+"(B --> C), (A --> C) |- ((B --> C) ==> (A --> C)) Truth_Induction",
+"(C --> A), (C --> B) |- ((C --> B) <=> (C --> A)) Truth_Comparison",
+"(C --> B), (C --> A) |- ((C --> B) <=> (C --> A)) Truth_Comparison",
+"(A --> C), (B --> C) |- ((B --> C) <=> (A --> C)) Truth_Comparison",
+"(B --> C), (A --> C) |- ((B --> C) <=> (A --> C)) Truth_Comparison",
+"(C --> A), (C --> B) |- ((C --> B) && (C --> A)) Truth_Intersection",
+"(C --> B), (C --> A) |- ((C --> B) && (C --> A)) Truth_Intersection",
+"(A --> C), (B --> C) |- ((B --> C) && (A --> C)) Truth_Intersection",
+"(B --> C), (A --> C) |- ((B --> C) && (A --> C)) Truth_Intersection",
+"(<$1 --> B> ==> <$1 --> C>), A |- (A && (<$1 --> B> ==> <$1 --> C>)) Truth_Intersection",
+"A, (<$1 --> B> ==> <$1 --> C>) |- (A && (<$1 --> B> ==> <$1 --> C>)) Truth_Intersection",
+"(<#1 --> B> && <#1 --> C>), A |- (A ==> (<#1 --> B> && <#1 --> C>)) Truth_Induction",
+"A, (<#1 --> B> && <#1 --> C>) |- (A ==> (<#1 --> B> && <#1 --> C>)) Truth_Induction",
+"(B ==> C), A |- ((A && B) ==> C) Truth_Induction",
+"A, (B ==> C) |- ((A && B) ==> C) Truth_Induction",
+"((A * B) --> R), ((B * A) --> S) |- (((A * B) --> S) ==> ((B * A) --> R)) Truth_Induction",
+"((B * A) --> S), ((A * B) --> R) |- (((A * B) --> S) ==> ((B * A) --> R)) Truth_Induction",
+"(! ((B * A) --> R)), ((A * B) --> S) |- (((A * B) --> S) ==> (! ((B * A) --> R))) Truth_Induction",
+"((A * B) --> S), (! ((B * A) --> R)) |- (((A * B) --> S) ==> (! ((B * A) --> R))) Truth_Induction",
+"((A * B) --> R), ((B * C) --> S) |- (((A * B) --> R) && ((B * C) --> S)) Truth_Intersection",
+"((B * C) --> S), ((A * B) --> R) |- (((A * B) --> R) && ((B * C) --> S)) Truth_Intersection",
+"((A * C) --> M), (((A * B) --> R) && ((B * C) --> S)) |- ((((A * B) --> R) && ((B * C) --> S)) ==> ((A * C) --> M)) Truth_Induction",
+"(((A * B) --> R) && ((B * C) --> S)), ((A * C) --> M) |- ((((A * B) --> R) && ((B * C) --> S)) ==> ((A * C) --> M)) Truth_Induction",
+"(A =/> B), (S ==> B) |- (A =/> S) Truth_Induction",
+"(S ==> B), (A =/> B) |- (A =/> S) Truth_Induction",
+"(A =/> B), (B ==> S) |- (A =/> S) Truth_Deduction",
+"(B ==> S), (A =/> B) |- (A =/> S) Truth_Deduction",
+"(A =/> B), (B <=> S) |- (A =/> S) Truth_Analogy",
+"(B <=> S), (A =/> B) |- (A =/> S) Truth_Analogy",
+"(A =/> (P --> B)), (P <-> S) |- (A =/> (S --> B)) Truth_Analogy",
+"(P <-> S), (A =/> (P --> B)) |- (A =/> (S --> B)) Truth_Analogy",
+"(A =/> (B --> P)), (P <-> S) |- (A =/> (B --> S)) Truth_Analogy",
+"(P <-> S), (A =/> (B --> P)) |- (A =/> (B --> S)) Truth_Analogy",
+"((A &/ B) =/> C), (A ==> S) |- ((S &/ B) =/> C) Truth_Induction",
+"(A ==> S), ((A &/ B) =/> C) |- ((S &/ B) =/> C) Truth_Induction",
+"((A &/ B) =/> C), (S ==> A) |- ((S &/ B) =/> C) Truth_Deduction",
+"(S ==> A), ((A &/ B) =/> C) |- ((S &/ B) =/> C) Truth_Deduction",
+"((A &/ B) =/> C), (S <=> A) |- ((S &/ B) =/> C) Truth_Analogy",
+"(S <=> A), ((A &/ B) =/> C) |- ((S &/ B) =/> C) Truth_Analogy",
+"(((P --> A) &/ B) =/> C), (A <-> S) |- (((P --> S) &/ B) =/> C) Truth_Analogy",
+"(A <-> S), (((P --> A) &/ B) =/> C) |- (((P --> S) &/ B) =/> C) Truth_Analogy",
+"(((A --> P) &/ B) =/> C), (A <-> S) |- (((S --> P) &/ B) =/> C) Truth_Analogy",
+"(A <-> S), (((A --> P) &/ B) =/> C) |- (((S --> P) &/ B) =/> C) Truth_Analogy",
+"((A &/ B) =/> C), (B ==> S) |- ((A &/ S) =/> C) Truth_Induction",
+"(B ==> S), ((A &/ B) =/> C) |- ((A &/ S) =/> C) Truth_Induction",
+"((A &/ B) =/> C), (S ==> B) |- ((A &/ S) =/> C) Truth_Deduction",
+"(S ==> B), ((A &/ B) =/> C) |- ((A &/ S) =/> C) Truth_Deduction",
+"((A &/ B) =/> C), (S <=> B) |- ((A &/ S) =/> C) Truth_Analogy",
+"(S <=> B), ((A &/ B) =/> C) |- ((A &/ S) =/> C) Truth_Analogy",
+"((A &/ (P --> B)) =/> C), (B <-> S) |- ((A &/ (P --> S)) =/> C) Truth_Analogy",
+"(B <-> S), ((A &/ (P --> B)) =/> C) |- ((A &/ (P --> S)) =/> C) Truth_Analogy",
+"((A &/ (B --> P)) =/> C), (B <-> S) |- ((A &/ (S --> P)) =/> C) Truth_Analogy",
+"(B <-> S), ((A &/ (B --> P)) =/> C) |- ((A &/ (S --> P)) =/> C) Truth_Analogy",
+"(A &/ B), (S &/ P) |- ((S &/ P) ==> (A &/ B)) Truth_Induction",
+"(S &/ P), (A &/ B) |- ((S &/ P) ==> (A &/ B)) Truth_Induction",
+"(A &/ B), (S &/ P) |- ((A &/ B) ==> (S &/ P)) Truth_Abduction",
+"(S &/ P), (A &/ B) |- ((A &/ B) ==> (S &/ P)) Truth_Abduction",
+"(A &/ B), (S &/ P) |- ((A &/ B) <=> (S &/ P)) Truth_Comparison",
+"(S &/ P), (A &/ B) |- ((A &/ B) <=> (S &/ P)) Truth_Comparison",
+"(A &/ B), (S &/ P) |- ((S &/ P) <=> (A &/ B)) Truth_Comparison",
+"(S &/ P), (A &/ B) |- ((S &/ P) <=> (A &/ B)) Truth_Comparison",
+"(A &/ B), (S &/ P) |- ((A &/ B) && (S &/ P)) Truth_Intersection",
+"(S &/ P), (A &/ B) |- ((A &/ B) && (S &/ P)) Truth_Intersection",
+"(A &/ B), (S &/ P) |- ((S &/ P) && (A &/ B)) Truth_Intersection",
+"(S &/ P), (A &/ B) |- ((S &/ P) && (A &/ B)) Truth_Intersection",
+"((A &/ Op) =/> C), (S --> P) |- ((S --> P) ==> ((A &/ Op) =/> C)) Truth_Induction",
+"(S --> P), ((A &/ Op) =/> C) |- ((S --> P) ==> ((A &/ Op) =/> C)) Truth_Induction",
+"((A &/ Op) =/> C), (S --> P) |- (((A &/ Op) =/> C) ==> (S --> P)) Truth_Abduction",
+"(S --> P), ((A &/ Op) =/> C) |- (((A &/ Op) =/> C) ==> (S --> P)) Truth_Abduction",
+"((A &/ Op) =/> C), (S --> P) |- (((A &/ Op) =/> C) <=> (S --> P)) Truth_Comparison",
+"(S --> P), ((A &/ Op) =/> C) |- (((A &/ Op) =/> C) <=> (S --> P)) Truth_Comparison",
+"((A &/ Op) =/> C), (S --> P) |- ((S --> P) <=> ((A &/ Op) =/> C)) Truth_Comparison",
+"(S --> P), ((A &/ Op) =/> C) |- ((S --> P) <=> ((A &/ Op) =/> C)) Truth_Comparison",
+"((A &/ Op) =/> C), (S --> P) |- (((A &/ Op) =/> C) && (S --> P)) Truth_Intersection",
+"(S --> P), ((A &/ Op) =/> C) |- (((A &/ Op) =/> C) && (S --> P)) Truth_Intersection",
+"((A &/ Op) =/> C), (S --> P) |- ((S --> P) && ((A &/ Op) =/> C)) Truth_Intersection",
+"(S --> P), ((A &/ Op) =/> C) |- ((S --> P) && ((A &/ Op) =/> C)) Truth_Intersection",
+"((A &/ Op) =/> C), (S &/ P) |- ((S &/ P) ==> ((A &/ Op) =/> C)) Truth_Induction",
+"(S &/ P), ((A &/ Op) =/> C) |- ((S &/ P) ==> ((A &/ Op) =/> C)) Truth_Induction",
+"((A &/ Op) =/> C), (S &/ P) |- (((A &/ Op) =/> C) ==> (S &/ P)) Truth_Abduction",
+"(S &/ P), ((A &/ Op) =/> C) |- (((A &/ Op) =/> C) ==> (S &/ P)) Truth_Abduction",
+"((A &/ Op) =/> C), (S &/ P) |- (((A &/ Op) =/> C) <=> (S &/ P)) Truth_Comparison",
+"(S &/ P), ((A &/ Op) =/> C) |- (((A &/ Op) =/> C) <=> (S &/ P)) Truth_Comparison",
+"((A &/ Op) =/> C), (S &/ P) |- ((S &/ P) <=> ((A &/ Op) =/> C)) Truth_Comparison",
+"(S &/ P), ((A &/ Op) =/> C) |- ((S &/ P) <=> ((A &/ Op) =/> C)) Truth_Comparison",
+"((A &/ Op) =/> C), (S &/ P) |- (((A &/ Op) =/> C) && (S &/ P)) Truth_Intersection",
+"(S &/ P), ((A &/ Op) =/> C) |- (((A &/ Op) =/> C) && (S &/ P)) Truth_Intersection",
+"((A &/ Op) =/> C), (S &/ P) |- ((S &/ P) && ((A &/ Op) =/> C)) Truth_Intersection",
+"(S &/ P), ((A &/ Op) =/> C) |- ((S &/ P) && ((A &/ Op) =/> C)) Truth_Intersection",
+};
+int RuleTable_rulesAmount = 264;
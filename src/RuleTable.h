@@ -35,6 +35,17 @@
 //----------//
 #include "NAL.h"
 
+//Rule stats bookkeeping of the generated rules, see Stats.h
+#define RULE_STATS_ATTEMPT(rule) if(RULE_STATS) { _Pragma("omp atomic") Stats_rules[rule].attempts++; ruleStart = RULE_TIMING ? Stats_Cycles() : 0; }
+#define RULE_STATS_UNIFICATION(rule) if(RULE_STATS) { _Pragma("omp atomic") Stats_rules[rule].unifications++; }
+#define RULE_STATS_END(rule) if(RULE_STATS && RULE_TIMING) { unsigned long long ruleCycles = Stats_Cycles() - ruleStart; _Pragma("omp atomic") Stats_rules[rule].cycles += ruleCycles; }
+
+//Global vars//
+//-----------//
+//Names of the inference rules of RuleTable_Apply for the rule stats
+extern char *RuleTable_ruleNames[];
+extern int RuleTable_rulesAmount;
+
 //Methods//
 //-------//
 void RuleTable_Apply(Term term1, Term term2, Truth truth1, Truth truth2, long conclusionOccurrence, double occurrenceTimeOffset, Stamp conclusionStamp, 
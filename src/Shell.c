@@ -46,9 +46,9 @@ void Shell_NARInit()
     assert(false, "Shell_NARInit: Ran out of operators, add more there, or decrease OPERATIONS_MAX!");
 }
 
-int Shell_ProcessInput(char *line)
+//trim string, for IRC etc. convenience
+static void Shell_Trim(char *line)
 {
-    //trim string, for IRC etc. convenience
     for(int i=strlen(line)-1; i>=0; i--)
     {
         if(!isspace(line[i]))
@@ -57,7 +57,85 @@ int Shell_ProcessInput(char *line)
         }
         line[i] = 0;
     }
+}
+
+//Whether a trimmed line is a Narsese sentence, not a comment, command or timestep
+static bool Shell_IsNarsese(char *line)
+{
+    return line[0] && !(line[0] == '/' && line[1] == '/') && line[0] != '*' && strcmp(line, "quit") && strspn(line, "0123456789") != strlen(line);
+}
+
+//Process the lines of a file, the consecutive Narsese sentences as batches, false if it can't be opened
+static bool Shell_BulkLoad(char *path)
+{
+    FILE *file = fopen(path, "r");
+    if(file == NULL)
+    {
+        return false;
+    }
+    char (*sentences)[NARSESE_LEN_MAX] = malloc(NARSESE_BATCH_MAX * sizeof(*sentences));
+    char **batch = malloc(NARSESE_BATCH_MAX * sizeof(char*));
+    assert(sentences != NULL && batch != NULL, "Allocation of the bulk load batch failed!");
+    int amount = 0;
+    char line[1024];
+    for(;;)
+    {
+        bool end = fgets(line, 1024, file) == NULL;
+        if(!end)
+        {
+            Shell_Trim(line);
+            if(Shell_IsNarsese(line) && strlen(line) < NARSESE_LEN_MAX)
+            {
+                strcpy(sentences[amount], line);
+                batch[amount] = sentences[amount];
+                amount++;
+                if(amount < NARSESE_BATCH_MAX)
+                {
+                    continue;
+                }
+            }
+        }
+        NAR_AddInputNarseseBatch(batch, amount); //the sentences before the other lines
+        amount = 0;
+        if(end)
+        {
+            break;
+        }
+        if(!Shell_IsNarsese(line) || strlen(line) >= NARSESE_LEN_MAX)
+        {
+            int cmd = Shell_ProcessInput(line);
+            if(cmd == SHELL_RESET)
+            {
+                Shell_NARInit();
+            }
+            else
+            if(cmd == SHELL_EXIT)
+            {
+                break;
+            }
+        }
+    }
+    free(sentences);
+    free(batch);
+    fclose(file);
+    return true;
+}
+
+//Whether the line only prints, comments and inspection commands don't change the state
+static bool Shell_IsInspection(char *line)
+{
+    return (line[0] == '/' && line[1] == '/') || !strcmp(line,"*stats") || !strcmp(line,"*inverted_atom_index") || !strcmp(line,"*concepts") ||
+           !strcmp(line,"*cycling_belief_events") || !strcmp(line,"*cycling_goal_events") || !strcmp(line,"*rulestats") || !strcmp(line,"*rulestats=tsv");
+}
+
+static int Shell_ProcessLine(char *line)
+{
+    Shell_Trim(line);
     int size = strlen(line);
+    if(Journal_Replaying() && Shell_IsInspection(line)) //nothing is printed when catching up with a journal
+    {
+        return SHELL_CONTINUE;
+    }
     if(size==0)
     {
         NAR_Cycles(1);
@@ -129,7 +207,7 @@ int Shell_ProcessInput(char *line)
                 assert(c != NULL, "Concept is null");
                 fputs("//", stdout);
                 Narsese_PrintTerm(&c->term);
-                printf(": { \"priority\": %f, \"usefulness\": %f, \"useCount\": %ld, \"lastUsed\": %ld, \"frequency\": %f, \"confidence\": %f, \"termlinks\": [", c->priority, concepts.items[i].priority, c->usage.useCount, c->usage.lastUsed, c->belief.truth.frequency, c->belief.truth.confidence);
+                printf(": { \"priority\": %f, \"usefulness\": %f, \"useCount\": %ld, \"lastUsed\": %ld, \"frequency\": %f, \"confidence\": %f, \"termlinks\": [", Memory_ConceptPriority(c, currentTime), concepts.items[i].priority, c->usage.useCount, c->usage.lastUsed, c->belief.truth.frequency, c->belief.truth.confidence);
                 Term left = Term_ExtractSubterm(&c->term, 1);
                 Term left_left = Term_ExtractSubterm(&left, 1);
                 Term left_right = Term_ExtractSubterm(&left, 2);
@@ -161,9 +239,10 @@ int Shell_ProcessInput(char *line)
                 }
                 for(int opi=0; opi<OPERATIONS_MAX; opi++)
                 {
-                    for(int h=0; h<c->precondition_beliefs[opi].itemsAmount; h++)
+                    Table *table = c->precondition_beliefs[opi];
+                    for(int h=0; table != NULL && h<table->itemsAmount; h++)
                     {
-                        Implication *imp = &c->precondition_beliefs[opi].array[h];
+                        Implication *imp = &table->array[h];
                         Memory_printAddedImplication(&imp->term, &imp->truth, imp->occurrenceTimeOffset, 1, true, false, false);
                     }
                 }
@@ -209,6 +288,67 @@ int Shell_ProcessInput(char *line)
             sscanf(&line[strlen("*babblingops=")], "%d", &BABBLING_OPS);
         }
         else
+        if(!strncmp("*inferencethreads=", line, strlen("*inferencethreads=")))
+        {
+            sscanf(&line[strlen("*inferencethreads=")], "%d", &INFERENCE_THREADS);
+        }
+        else
+        if(!strcmp(line,"*deterministicinference=true"))
+        {
+            DETERMINISTIC_INFERENCE = true;
+        }
+        else
+        if(!strcmp(line,"*deterministicinference=false"))
+        {
+            DETERMINISTIC_INFERENCE = false;
+        }
+        else
+        if(!strcmp(line,"*rulestats=true"))
+        {
+            RULE_STATS = true;
+        }
+        else
+        if(!strcmp(line,"*rulestats=false"))
+        {
+            RULE_STATS = false;
+        }
+        else
+        if(!strcmp(line,"*ruletiming=true"))
+        {
+            RULE_TIMING = true;
+        }
+        else
+        if(!strcmp(line,"*ruletiming=false"))
+        {
+            RULE_TIMING = false;
+        }
+#if STAGE==2
+        else
+        if(!strcmp(line,"*rulestats"))
+        {
+            puts("//*rulestats");
+            Stats_PrintRules(RuleTable_ruleNames, RuleTable_rulesAmount, false);
+            puts("//*done");
+        }
+        else
+        if(!strcmp(line,"*rulestats=tsv"))
+        {
+            puts("//*rulestats=tsv");
+            Stats_PrintRules(RuleTable_ruleNames, RuleTable_rulesAmount, true);
+            puts("//*done");
+        }
+#endif
+        else
+        if(!strcmp(line,"*lazyforgetting=true"))
+        {
+            LAZY_FORGETTING = true;
+        }
+        else
+        if(!strcmp(line,"*lazyforgetting=false"))
+        {
+            LAZY_FORGETTING = false;
+        }
+        else
         if(!strcmp(line,"*motorbabbling=false"))
         {
             MOTOR_BABBLING_CHANCE = 0.0;
@@ -224,6 +364,45 @@ int Shell_ProcessInput(char *line)
             sscanf(&line[strlen("*motorbabbling=")], "%lf", &MOTOR_BABBLING_CHANCE);
         }
         else
+        if(!strncmp("*save ", line, strlen("*save ")))
+        {
+            bool saved = NAR_Save(&line[strlen("*save ")]);
+            assert(saved, "Snapshot could not be saved!");
+        }
+        else
+        if(!strncmp("*load ", line, strlen("*load ")))
+        {
+            bool loaded = NAR_Load(&line[strlen("*load ")]);
+            assert(loaded, "Snapshot could not be loaded, it needs to be from the same build!");
+        }
+        else
+        if(!strncmp("*bulkload ", line, strlen("*bulkload ")))
+        {
+            bool loaded = Shell_BulkLoad(&line[strlen("*bulkload ")]);
+            assert(loaded, "Narsese file could not be opened!");
+        }
+        else
+        if(!strncmp("*journal ", line, strlen("*journal ")))
+        {
+            bool opened = Journal_Open(&line[strlen("*journal ")]);
+            assert(opened, "Journal could not be opened!");
+        }
+        else
+        if(!strncmp("*recover ", line, strlen("*recover ")))
+        {
+            bool recovered = Journal_Replay(&line[strlen("*recover ")], true);
+            assert(recovered, "Journal could not be replayed, it needs to be from the same build!");
+        }
+        else
+        if(!strncmp("*memory=", line, strlen("*memory=")))
+        {
+            //capacities in the order of Memory_Config, the ones which are left out stay the same
+            Memory_Config config = memoryConfig;
+            sscanf(&line[strlen("*memory=")], "%d %d %d %d %d", &config.conceptsMax, &config.cyclingBeliefEventsMax, &config.cyclingGoalEventsMax, &config.preconditionTablesMax, &config.atomsMax);
+            NAR_INIT_Config(config); //kept by the reset
+            return SHELL_RESET;
+        }
+        else
         if(!strncmp("*setopname ", line, strlen("*setopname ")))
         {
             assert(currentTime == 1, "Operators can only be registered right after initialization / reset!");
@@ -260,13 +439,24 @@ int Shell_ProcessInput(char *line)
             operations[opID - 1].arguments[opArgID-1] = Narsese_Term(argname);
         }
         else
+        if(!strncmp("*questions ", line, strlen("*questions ")))
+        {
+            NAR_AddInputNarseseQuestions(&line[strlen("*questions ")]);
+        }
+        else
         if(strspn(line, "0123456789") && strlen(line) == strspn(line, "0123456789"))
         {
             unsigned int steps;
             sscanf(line, "%u", &steps);
-            printf("performing %u inference steps:\n", steps); fflush(stdout);
+            if(!Journal_Replaying())
+            {
+                printf("performing %u inference steps:\n", steps); fflush(stdout);
+            }
             NAR_Cycles(steps);
-            printf("done with %u additional inference steps.\n", steps); fflush(stdout);
+            if(!Journal_Replaying())
+            {
+                printf("done with %u additional inference steps.\n", steps); fflush(stdout);
+            }
         }
         else
         {
@@ -277,6 +467,27 @@ int Shell_ProcessInput(char *line)
     return SHELL_CONTINUE;
 }
 
+int Shell_ProcessInput(char *line)
+{
+    //saving, journal handling and bulk loading would act on files again when replayed, the input they cause is recorded by itself
+    if(!strncmp("*save ", line, strlen("*save ")) || !strncmp("*journal ", line, strlen("*journal ")) || !strncmp("*recover ", line, strlen("*recover ")) || !strncmp("*bulkload ", line, strlen("*bulkload ")))
+    {
+        return Shell_ProcessLine(line);
+    }
+    bool failed = Journal_Failed();
+    if(Journal_Enter())
+    {
+        Journal_RecordString(JOURNAL_SHELL, line);
+    }
+    int cmd = Shell_ProcessLine(line);
+    Journal_Leave();
+    if(!failed && Journal_Failed())
+    {
+        puts("//Journal could not be written, it was closed!"); fflush(stdout);
+    }
+    return cmd;
+}
+
 void Shell_Start()
 {
     Shell_NARInit();
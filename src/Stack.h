@@ -28,7 +28,7 @@
 /////////////
 //  Stack  //
 /////////////
-//The stack for use by the hashtable
+//The stack, used as pool of free items
 
 //References//
 //----------//
@@ -48,11 +48,11 @@ typedef struct
 //Methods//
 //-------//
 void Stack_INIT(Stack *stack, void **items, int maxElements);
-//Add a VMItem on the top of the stack
+//Add an item on the top of the stack
 void Stack_Push(Stack *stack, void *item);
-//Remove a VMItem from the top of the stack
+//Remove an item from the top of the stack
 void* Stack_Pop(Stack *stack);
-//Check if there aren't VMItems left on the stack
+//Check if there aren't items left on the stack
 bool Stack_IsEmpty(Stack *stack);
 
 #endif
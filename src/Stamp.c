@@ -24,6 +24,11 @@
 
 #include "Stamp.h"
 
+Stamp Stamp_input(long evidence)
+{
+    return (Stamp) { .evidentalBase = { evidence }, .summary = STAMP_SUMMARY_BIT(evidence) };
+}
+
 Stamp Stamp_make(Stamp *stamp1, Stamp *stamp2)
 {
     Stamp ret = {0};
@@ -36,6 +41,7 @@ Stamp Stamp_make(Stamp *stamp1, Stamp *stamp2)
             if(stamp1->evidentalBase[i] != STAMP_FREE)
             {
                 ret.evidentalBase[j] = stamp1->evidentalBase[i];
+                ret.summary |= STAMP_SUMMARY_BIT(ret.evidentalBase[j]);
                 j++;
                 if(j >= STAMP_SIZE)
                 {
@@ -52,6 +58,7 @@ Stamp Stamp_make(Stamp *stamp1, Stamp *stamp2)
             if(stamp2->evidentalBase[i] != STAMP_FREE)
             {
                 ret.evidentalBase[j] = stamp2->evidentalBase[i];
+                ret.summary |= STAMP_SUMMARY_BIT(ret.evidentalBase[j]);
                 j++;
                 if(j >= STAMP_SIZE)
                 {
@@ -73,6 +80,11 @@ Stamp Stamp_make(Stamp *stamp1, Stamp *stamp2)
 
 bool Stamp_checkOverlap(Stamp *a, Stamp *b)
 {
+    //stamps without common summary bits can't share an evidence ID, only possible overlaps need to be checked exactly
+    if(a->summary && b->summary && !(a->summary & b->summary))
+    {
+        return false;
+    }
     for (int i=0;i<STAMP_SIZE;i++)
     {
         if (a->evidentalBase[i] == STAMP_FREE) 
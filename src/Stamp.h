@@ -34,19 +34,25 @@
 //----------//
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdint.h>
 #include "Config.h"
 
 //Data structure//
 //--------------//
 //Stamp as implemented by all NARS implementations
 #define STAMP_FREE 0
+#define STAMP_SUMMARY_BIT(evidence) (((uint64_t) 1) << (((unsigned long) (evidence)) % 64))
 typedef struct {
     //EvidentalBase of stamp
     long evidentalBase[STAMP_SIZE];
+    //Bit mask with a bit for each of its evidence IDs, 0 if not summarized
+    uint64_t summary;
 } Stamp;
 
 //Methods//
 //-------//
+//stamp with a single new evidence ID
+Stamp Stamp_input(long evidence);
 //zip stamp1 and stamp2 into a stamp
 Stamp Stamp_make(Stamp *stamp1, Stamp *stamp2);
 //true iff there is evidental base overlap between a and b
@@ -23,9 +23,24 @@
  */
 
 #include "Stats.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
 
-long Stats_countConceptsMatchedTotal = 0;
-long Stats_countConceptsMatchedMax = 0;
+THREAD_LOCAL bool RULE_STATS = RULE_STATS_INITIAL;
+THREAD_LOCAL bool RULE_TIMING = RULE_TIMING_INITIAL;
+THREAD_LOCAL RuleStats *Stats_rules;
+THREAD_LOCAL long Stats_countConceptsMatchedTotal = 0;
+THREAD_LOCAL long Stats_countConceptsMatchedMax = 0;
+THREAD_LOCAL long Stats_countDecisionGoals = 0;
+THREAD_LOCAL unsigned long long Stats_countDecisionCycles = 0;
+
+void Stats_INIT()
+{
+    Stats_rules = Memory_ArenaTake(RULES_MAX, sizeof(RuleStats));
+}
 
 void Stats_Print(long currentTime)
 {
@@ -34,35 +49,38 @@ void Stats_Print(long currentTime)
     {
         Stats_averageBeliefEventPriority += cycling_belief_events.items[i].priority;
     }
-    Stats_averageBeliefEventPriority /= (double) CYCLING_BELIEF_EVENTS_MAX;
+    Stats_averageBeliefEventPriority /= (double) cycling_belief_events.maxElements;
     double Stats_averageGoalEventPriority = 0.0;
     for(int i=0; i<cycling_goal_events.itemsAmount; i++)
     {
         Stats_averageGoalEventPriority += cycling_goal_events.items[i].priority;
     }
-    Stats_averageGoalEventPriority /= (double) CYCLING_GOAL_EVENTS_MAX;
+    Stats_averageGoalEventPriority /= (double) cycling_goal_events.maxElements;
     double Stats_averageConceptPriority = 0.0;
     for(int i=0; i<concepts.itemsAmount; i++)
     {
         Concept *c = concepts.items[i].address;
-        Stats_averageConceptPriority += c->priority;
+        Stats_averageConceptPriority += Memory_ConceptPriority(c, currentTime);
     }
-    Stats_averageConceptPriority /= (double) CONCEPTS_MAX;
+    Stats_averageConceptPriority /= (double) concepts.maxElements;
     double Stats_averageConceptUsefulness = 0.0;
     for(int i=0; i<concepts.itemsAmount; i++)
     {
         Stats_averageConceptUsefulness += concepts.items[i].priority;
     }
-    Stats_averageConceptUsefulness /= (double) CONCEPTS_MAX;
+    Stats_averageConceptUsefulness /= (double) concepts.maxElements;
     puts("Statistics\n----------");
     printf("countConceptsMatchedTotal:\t%ld\n", Stats_countConceptsMatchedTotal);
     printf("countConceptsMatchedMax:\t%ld\n", Stats_countConceptsMatchedMax);
     long countConceptsMatchedAverage = Stats_countConceptsMatchedTotal / currentTime;
     printf("countConceptsMatchedAverage:\t%ld\n", countConceptsMatchedAverage);
+    printf("countDecisionGoals:\t\t%ld\n", Stats_countDecisionGoals);
+    printf("averageDecisionCyclesPerGoal:\t%llu\n", Stats_countDecisionCycles / MAX(1, Stats_countDecisionGoals));
     printf("currentTime:\t\t\t%ld\n", currentTime);
     printf("total concepts:\t\t\t%d\n", concepts.itemsAmount);
     printf("current average concept priority:\t%f\n", Stats_averageConceptPriority);
     printf("current average concept usefulness:\t%f\n", Stats_averageConceptUsefulness);
+    printf("precondition tables in use:\t\t%d\n", precondition_table_stack.maxElements - precondition_table_stack.stackpointer);
     printf("curring belief events cnt:\t\t%d\n", cycling_belief_events.itemsAmount);
     printf("curring goal events cnt:\t\t%d\n", cycling_goal_events.itemsAmount);
     printf("current average belief event priority:\t%f\n", Stats_averageBeliefEventPriority);
@@ -71,3 +89,49 @@ void Stats_Print(long currentTime)
     printf("Maximum chain length in atoms hashtable: %d\n", HashTable_MaximumChainLength(&HTatoms));
     fflush(stdout);
 }
+
+void Stats_PrintRules(char **ruleNames, int rulesAmount, bool machineReadable)
+{
+    if(machineReadable)
+    {
+        puts("rule\tattempts\tunifications\tderivations\trejections\tcycles\tname");
+    }
+    else
+    {
+        puts("Rule statistics\n---------------");
+    }
+    for(int i=0; i<rulesAmount; i++)
+    {
+        RuleStats *r = &Stats_rules[i];
+        if(machineReadable)
+        {
+            printf("%d\t%ld\t%ld\t%ld\t%ld\t%llu\t%s\n", i, r->attempts, r->unifications, r->derivations, r->rejections, r->cycles, ruleNames[i]);
+        }
+        else
+        if(r->attempts)
+        {
+            printf("%s\nattempts=%ld unifications=%ld derivations=%ld rejections=%ld cycles=%llu\n", ruleNames[i], r->attempts, r->unifications, r->derivations, r->rejections, r->cycles);
+        }
+    }
+    fflush(stdout);
+}
+
+unsigned long long Stats_Cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return clock();
+#endif
+}
+
+void Stats_SwapState(Stats_State *state)
+{
+    SWAP_STATE(RULE_STATS, state->RULE_STATS);
+    SWAP_STATE(RULE_TIMING, state->RULE_TIMING);
+    SWAP_STATE(Stats_rules, state->Stats_rules);
+    SWAP_STATE(Stats_countConceptsMatchedTotal, state->Stats_countConceptsMatchedTotal);
+    SWAP_STATE(Stats_countConceptsMatchedMax, state->Stats_countConceptsMatchedMax);
+    SWAP_STATE(Stats_countDecisionGoals, state->Stats_countDecisionGoals);
+    SWAP_STATE(Stats_countDecisionCycles, state->Stats_countDecisionCycles);
+}
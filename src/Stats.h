@@ -35,15 +35,53 @@
 #include "Memory.h"
 #include "Narsese.h"
 
+//Data structure//
+//--------------//
+//Statistics of an inference rule of the rule table
+typedef struct
+{
+    long attempts; //premises of the rule's premise class it was tried on
+    long unifications; //premises which unified with the rule's premises
+    long derivations; //derivations which passed the NAL filters
+    long rejections; //derivations rejected by the NAL filters
+    unsigned long long cycles; //processor cycles spent in the rule
+}RuleStats;
+//Statistics and their parameters of a reasoner instance
+typedef struct
+{
+    bool RULE_STATS;
+    bool RULE_TIMING;
+    RuleStats *Stats_rules;
+    long Stats_countConceptsMatchedTotal;
+    long Stats_countConceptsMatchedMax;
+    long Stats_countDecisionGoals;
+    unsigned long long Stats_countDecisionCycles;
+}Stats_State;
+#define STATS_STATE_INITIAL ((Stats_State) { .RULE_STATS = RULE_STATS_INITIAL, .RULE_TIMING = RULE_TIMING_INITIAL })
+
+//Parameters//
+//----------//
+extern THREAD_LOCAL bool RULE_STATS;
+extern THREAD_LOCAL bool RULE_TIMING;
+
 //Global vars//
 //-----------//
-extern long Stats_countConceptsMatchedTotal;
-extern long Stats_countConceptsMatchedMax;
-//From Narsese module, for stats purposes:
-extern HashTable HTatoms;
+extern THREAD_LOCAL RuleStats *Stats_rules; //taken from the memory arena, shared with the worker threads of parallel inference
+extern THREAD_LOCAL long Stats_countConceptsMatchedTotal;
+extern THREAD_LOCAL long Stats_countConceptsMatchedMax;
+extern THREAD_LOCAL long Stats_countDecisionGoals;
+extern THREAD_LOCAL unsigned long long Stats_countDecisionCycles;
 
 //Methods//
 //-------//
+//Init module, after Memory_INIT as the rule stats are taken from the memory arena
+void Stats_INIT();
 void Stats_Print(long currentTime);
+//Prints the statistics of the rules which were tried, or of all rules tab-separated if machineReadable
+void Stats_PrintRules(char **ruleNames, int rulesAmount, bool machineReadable);
+//Processor cycle counter for measuring the rule cost
+unsigned long long Stats_Cycles();
+//Exchange the statistics with the ones kept for a reasoner instance
+void Stats_SwapState(Stats_State *state);
 
 #endif
@@ -23,17 +23,32 @@
  */
 
 #include "Term.h"
+//SSE2 kernels for the atom scans, the atoms fit into 16 byte blocks exactly:
+#if defined(__SSE2__) && COMPOUND_TERM_SIZE_MAX == 64 && !defined(TERM_SCALAR)
+#define TERM_SSE2
+#include <emmintrin.h>
+#define TERM_BLOCKS (TERM_ATOMS_SIZE / sizeof(__m128i))
+#endif
 
 bool Term_Equal(Term *a, Term *b)
 {
-    if(Term_Hash(a) == Term_Hash(b))
+    //only compare the hashes if both are known already, else comparing the atoms is cheaper than hashing them
+    if(a->hashed && b->hashed && a->hash != b->hash)
     {
-        return memcmp(a, b, sizeof(Term)) == 0;
+        return false;
     }
-    else
+#ifdef TERM_SSE2
+    __m128i equal = _mm_set1_epi8(-1);
+    for(unsigned int i=0; i<TERM_BLOCKS; i++)
     {
-        return false;
+        __m128i block_a = _mm_loadu_si128((__m128i*) a->atoms + i);
+        __m128i block_b = _mm_loadu_si128((__m128i*) b->atoms + i);
+        equal = _mm_and_si128(equal, _mm_cmpeq_epi8(block_a, block_b));
     }
+    return _mm_movemask_epi8(equal) == 0xFFFF;
+#else
+    return memcmp(a->atoms, b->atoms, TERM_ATOMS_SIZE) == 0;
+#endif
 }
 
 static bool Term_RelativeOverride(Term *term, int i, Term *subterm, int j)
@@ -80,6 +95,9 @@ Term Term_ExtractSubterm(Term *term, int j)
 
 int Term_Complexity(Term *term)
 {
+#ifdef TERM_SSE2
+    return __builtin_popcountll(Term_AtomsMask(term));
+#else
     int s = 0;
     for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
     {
@@ -89,6 +107,43 @@ int Term_Complexity(Term *term)
         }
     }
     return s;
+#endif
+}
+
+uint64_t Term_AtomsMask(Term *term)
+{
+    uint64_t mask = 0;
+#ifdef TERM_SSE2
+    __m128i zero = _mm_setzero_si128();
+    for(unsigned int i=0; i<TERM_BLOCKS; i+=2)
+    {
+        //compare two blocks of 8 atoms with 0 and pack the 16 results into bytes, one bit each for the mask:
+        __m128i empty_low = _mm_cmpeq_epi16(_mm_loadu_si128((__m128i*) term->atoms + i), zero);
+        __m128i empty_high = _mm_cmpeq_epi16(_mm_loadu_si128((__m128i*) term->atoms + i + 1), zero);
+        uint64_t empty = (uint64_t) _mm_movemask_epi8(_mm_packs_epi16(empty_low, empty_high));
+        mask |= (~empty & 0xFFFF) << (i*8);
+    }
+#else
+    for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+    {
+        if(term->atoms[i])
+        {
+            mask |= ((uint64_t) 1) << i;
+        }
+    }
+#endif
+    return mask;
+}
+
+int Term_LowestAtom(uint64_t mask)
+{
+#ifdef TERM_SSE2
+    return __builtin_ctzll(mask);
+#else
+    int i = 0;
+    for(; !(mask & 1); mask >>= 1, i++);
+    return i;
+#endif
 }
 
 HASH_TYPE Term_Hash(Term *term)
@@ -48,6 +48,9 @@
 //--------------//
 #define HASH_TYPE_SIZE sizeof(HASH_TYPE)
 #define TERM_ATOMS_SIZE (sizeof(Atom)*COMPOUND_TERM_SIZE_MAX)
+#if COMPOUND_TERM_SIZE_MAX > 64
+#error "The atoms mask of a term has 64 bits, COMPOUND_TERM_SIZE_MAX can't be larger!"
+#endif
 typedef struct
 {
     bool hashed;
@@ -67,5 +70,9 @@ Term Term_ExtractSubterm(Term *term, int j);
 int Term_Complexity(Term *term);
 //Hash of a term (needed by the term->concept HashTable)
 HASH_TYPE Term_Hash(Term *term);
+//Mask of the term's atom positions which are not empty, bit i for atoms[i]
+uint64_t Term_AtomsMask(Term *term);
+//Position of the lowest set bit of a non-empty atoms mask
+int Term_LowestAtom(uint64_t mask);
 
 #endif
@@ -24,8 +24,8 @@
 
 #include "Truth.h"
 
-double TRUTH_EVIDENTAL_HORIZON = TRUTH_EVIDENTAL_HORIZON_INITIAL;
-double TRUTH_PROJECTION_DECAY = TRUTH_PROJECTION_DECAY_INITIAL;
+THREAD_LOCAL double TRUTH_EVIDENTAL_HORIZON = TRUTH_EVIDENTAL_HORIZON_INITIAL;
+THREAD_LOCAL double TRUTH_PROJECTION_DECAY = TRUTH_PROJECTION_DECAY_INITIAL;
 #define TruthValues(v1,v2, f1,c1, f2,c2) double f1 = v1.frequency; double f2 = v2.frequency; double c1 = v1.confidence; double c2 = v2.confidence;
 
 double Truth_w2c(double w)
@@ -208,3 +208,9 @@ Truth Truth_AnonymousAnalogy(Truth v1, Truth v2)
     Truth v3 = { .frequency = 1.0, .confidence = Truth_w2c(f2 * c2) }; //page 125 in NAL book
     return Truth_Analogy(v1, v3);
 }
+
+void Truth_SwapState(Truth_State *state)
+{
+    SWAP_STATE(TRUTH_EVIDENTAL_HORIZON, state->TRUTH_EVIDENTAL_HORIZON);
+    SWAP_STATE(TRUTH_PROJECTION_DECAY, state->TRUTH_PROJECTION_DECAY);
+}
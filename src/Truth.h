@@ -45,11 +45,18 @@ typedef struct {
     //Confidence
     double confidence;
 } Truth;
+//Parameters of a reasoner instance
+typedef struct
+{
+    double TRUTH_EVIDENTAL_HORIZON;
+    double TRUTH_PROJECTION_DECAY;
+}Truth_State;
+#define TRUTH_STATE_INITIAL ((Truth_State) { .TRUTH_EVIDENTAL_HORIZON = TRUTH_EVIDENTAL_HORIZON_INITIAL, .TRUTH_PROJECTION_DECAY = TRUTH_PROJECTION_DECAY_INITIAL })
 
 //Parameters//
 //----------//
-extern double TRUTH_EVIDENTAL_HORIZON;
-extern double TRUTH_PROJECTION_DECAY;
+extern THREAD_LOCAL double TRUTH_EVIDENTAL_HORIZON;
+extern THREAD_LOCAL double TRUTH_PROJECTION_DECAY;
 #define OCCURRENCE_ETERNAL -1
 #define STRUCTURAL_TRUTH (Truth) { .frequency = 1.0, .confidence = RELIANCE }
 
@@ -66,6 +73,8 @@ Truth Truth_Eternalize(Truth v);
 Truth Truth_Projection(Truth v, long originalTime, long targetTime);
 void Truth_Print(Truth *truth);
 void Truth_Print2(Truth *truth);
+//Exchange the parameters with the ones kept for a reasoner instance
+void Truth_SwapState(Truth_State *state);
 //not part of sensorimotor inference:
 Truth Truth_Abduction(Truth v1, Truth v2);
 Truth Truth_Exemplification(Truth v1, Truth v2);
@@ -46,9 +46,9 @@ bool Variable_isVariable(Atom atom)
 
 bool Variable_hasVariable(Term *term, bool independent, bool dependent, bool query)
 {
-    for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+    for(uint64_t mask = Term_AtomsMask(term); mask; mask &= mask - 1) //only visit the atoms which are there
     {
-        Atom atom = term->atoms[i];
+        Atom atom = term->atoms[Term_LowestAtom(mask)];
         if((independent && Variable_isIndependentVariable(atom)) || (dependent && Variable_isDependentVariable(atom)) || (query && Variable_isQueryVariable(atom)))
         {
             return true;
@@ -57,6 +57,12 @@ bool Variable_hasVariable(Term *term, bool independent, bool dependent, bool que
     return false;
 }
 
+//Hash of the atoms, not using the cached term hash which could be stale if the term was changed
+static HASH_TYPE Variable_AtomsHash(Term *term)
+{
+    return Globals_Hash((HASH_TYPE*) term->atoms, TERM_ATOMS_SIZE / HASH_TYPE_SIZE);
+}
+
 Substitution Variable_Unify2(Term *general, Term *specific, bool unifyQueryVarOnly)
 {
     Substitution substitution = {0};
@@ -69,20 +75,26 @@ Substitution Variable_Unify2(Term *general, Term *specific, bool unifyQueryVarOn
             if(is_allowed_var)
             {
                 assert(general_atom <= 27, "Variable_Unify: Problematic variable encountered, only $1-$9, #1-#9 and ?1-?9 are allowed!");
-                Term subtree = Term_ExtractSubterm(specific, i);
-                if(Variable_isQueryVariable(general_atom) && Variable_isVariable(subtree.atoms[0])) //not valid to substitute a variable for a question var
+                Atom subtree_root = specific->atoms[i];
+                if(Variable_isQueryVariable(general_atom) && Variable_isVariable(subtree_root)) //not valid to substitute a variable for a question var
                 {
                     return substitution;
                 }
-                if(substitution.map[(int) general_atom].atoms[0] != 0 && !Term_Equal(&substitution.map[(int) general_atom], &subtree)) //unificiation var consistency criteria
+                int bound = substitution.map[(int) general_atom];
+                if(bound && specific->atoms[bound-1] != 0) //unificiation var consistency criteria
                 {
-                    return substitution;
+                    Term subtree = Term_ExtractSubterm(specific, i);
+                    Term boundSubtree = Term_ExtractSubterm(specific, bound-1);
+                    if(!Term_Equal(&boundSubtree, &subtree))
+                    {
+                        return substitution;
+                    }
                 }
-                if(Narsese_copulaEquals(subtree.atoms[0], SET_TERMINATOR)) //not allowed to unify with set terminator
+                if(Narsese_copulaEquals(subtree_root, SET_TERMINATOR)) //not allowed to unify with set terminator
                 {
                     return substitution;	
                 }
-                substitution.map[(int) general_atom] = subtree;
+                substitution.map[(int) general_atom] = i+1;
             }
             else
             {
@@ -93,6 +105,8 @@ Substitution Variable_Unify2(Term *general, Term *specific, bool unifyQueryVarOn
             }
         }
     }
+    substitution.specific = specific;
+    IN_DEBUG( substitution.specificHash = Variable_AtomsHash(specific); )
     substitution.success = true;
     return substitution;
 }
@@ -105,15 +119,18 @@ Substitution Variable_Unify(Term *general, Term *specific)
 Term Variable_ApplySubstitute(Term general, Substitution substitution, bool *success)
 {
     assert(substitution.success, "A substitution from unsuccessful unification cannot be used to substitute variables!");
+    IN_DEBUG( assert(substitution.specificHash == Variable_AtomsHash(substitution.specific), "The term the substitution refers to was changed after the unification!"); )
     *success = true;
     for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
     {
         Atom general_atom = general.atoms[i];
         bool is_variable = Variable_isVariable(general_atom);
         assert(!is_variable || general_atom <= 27, "Variable_ApplySubstitute: Problematic variable encountered, only $1-$9, #1-#9 and ?1-?9 are allowed!");
-        if(is_variable && substitution.map[(int) general_atom].atoms[0] != 0)
+        int bound = is_variable ? substitution.map[(int) general_atom] : 0;
+        if(bound && substitution.specific->atoms[bound-1] != 0)
         {
-            if(!Term_OverrideSubterm(&general, i, &substitution.map[(int) general_atom]))
+            Term subtree = Term_ExtractSubterm(substitution.specific, bound-1);
+            if(!Term_OverrideSubterm(&general, i, &subtree))
             {
                 *success = false;
             }
@@ -122,9 +139,45 @@ Term Variable_ApplySubstitute(Term general, Substitution substitution, bool *suc
     return general;
 }
 
+//Small atom to count map, a term has at most COMPOUND_TERM_SIZE_MAX different atoms
+//which avoids clearing ATOMS_MAX sized scratch arrays on each variable introduction
+typedef struct
+{
+    Atom atoms[COMPOUND_TERM_SIZE_MAX];
+    int counts[COMPOUND_TERM_SIZE_MAX];
+    int size;
+} AtomCounts;
+
+static int *AtomCounts_At(AtomCounts *map, Atom atom)
+{
+    for(int i=0; i<map->size; i++)
+    {
+        if(map->atoms[i] == atom)
+        {
+            return &map->counts[i];
+        }
+    }
+    assert(map->size < COMPOUND_TERM_SIZE_MAX, "AtomCounts: more different atoms than a term can hold!");
+    map->atoms[map->size] = atom;
+    map->counts[map->size] = 0;
+    return &map->counts[map->size++];
+}
+
+static int AtomCounts_Get(AtomCounts *map, Atom atom)
+{
+    for(int i=0; i<map->size; i++)
+    {
+        if(map->atoms[i] == atom)
+        {
+            return map->counts[i];
+        }
+    }
+    return 0;
+}
+
 //Search for variables which appear twice extensionally, if also appearing in the right side of the implication
 //then introduce as independent variable, else as dependent variable
-static void countStatementAtoms(Term *cur_inheritance, int *appearing, bool extensionally, bool ignore_structure)
+static void countStatementAtoms(Term *cur_inheritance, AtomCounts *appearing, bool extensionally, bool ignore_structure)
 {
     bool similarity = Narsese_copulaEquals(cur_inheritance->atoms[0], SIMILARITY);
     if(Narsese_copulaEquals(cur_inheritance->atoms[0], INHERITANCE) || similarity) //inheritance and similarity
@@ -177,13 +230,13 @@ static void countStatementAtoms(Term *cur_inheritance, int *appearing, bool exte
             Atom atom = cur_inheritance->atoms[i];
             if(Narsese_IsSimpleAtom(atom) || Variable_isVariable(atom))
             {
-                appearing[(int) cur_inheritance->atoms[i]] += 1;
+                *AtomCounts_At(appearing, atom) += 1;
             }
         }
     }
 }
 
-static void countHigherOrderStatementAtoms(Term *term, int *appearing, bool extensionally)
+static void countHigherOrderStatementAtoms(Term *term, AtomCounts *appearing, bool extensionally)
 {
     if(Narsese_copulaEquals(term->atoms[0], NEGATION))
     {
@@ -209,22 +262,25 @@ Term Variable_IntroduceImplicationVariables(Term implication, bool *success, boo
     assert(Narsese_copulaEquals(implication.atoms[0], TEMPORAL_IMPLICATION) || Narsese_copulaEquals(implication.atoms[0], IMPLICATION) || Narsese_copulaEquals(implication.atoms[0], EQUIVALENCE), "An implication is expected here!");
     Term left_side = Term_ExtractSubterm(&implication, 1);
     Term right_side = Term_ExtractSubterm(&implication, 2);
-    int appearing_left[ATOMS_MAX] = {0};
-    int appearing_right[ATOMS_MAX] = {0};
-    countHigherOrderStatementAtoms(&left_side, appearing_left, extensionally);
-    countHigherOrderStatementAtoms(&right_side, appearing_right, extensionally);
+    AtomCounts appearing_left = {0};
+    AtomCounts appearing_right = {0};
+    countHigherOrderStatementAtoms(&left_side, &appearing_left, extensionally);
+    countHigherOrderStatementAtoms(&right_side, &appearing_right, extensionally);
     char depvar_i = 1;
     char indepvar_i = 1;
-    char variable_id[ATOMS_MAX] = {0};
+    AtomCounts variable_id = {0};
     Term implication_copy = implication;
     for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
     {
         Atom atom = implication_copy.atoms[i];
-        if(appearing_left[(int) atom] >= 2 || appearing_right[(int) atom] >= 2 || (appearing_left[(int) atom] && appearing_right[(int) atom]))
+        int left = AtomCounts_Get(&appearing_left, atom);
+        int right = AtomCounts_Get(&appearing_right, atom);
+        if(left >= 2 || right >= 2 || (left && right))
         {
-            if(appearing_right[(int) atom] && appearing_left[(int) atom])
+            int *atom_var_id = AtomCounts_At(&variable_id, atom);
+            if(right && left)
             {
-                int var_id = variable_id[(int) atom] = variable_id[(int) atom] ? variable_id[(int) atom] : indepvar_i++;
+                int var_id = *atom_var_id = *atom_var_id ? *atom_var_id : indepvar_i++;
                 if(var_id <= 9) //can only introduce up to 9 variables
                 {
                     char varname[3] = { '$', ('0' + var_id), 0 }; //$i
@@ -238,7 +294,7 @@ Term Variable_IntroduceImplicationVariables(Term implication, bool *success, boo
             }
             else
             {
-                int var_id = variable_id[(int) atom] = variable_id[(int) atom] ? variable_id[(int) atom] : depvar_i++;
+                int var_id = *atom_var_id = *atom_var_id ? *atom_var_id : depvar_i++;
                 if(var_id <= 9) //can only introduce up to 9 variables
                 {
                     char varname[3] = { '#', ('0' + var_id), 0 }; //#i
@@ -260,18 +316,19 @@ Term Variable_IntroduceImplicationVariables(Term implication, bool *success, boo
 Term Variable_IntroduceConjunctionVariables(Term conjunction, bool *success, bool extensionally)
 {
     assert(Narsese_copulaEquals(conjunction.atoms[0], CONJUNCTION), "A conjunction is expected here!");
-    int appearing_conjunction[ATOMS_MAX] = {0};
+    AtomCounts appearing_conjunction = {0};
     Term left_side = conjunction;
-    countHigherOrderStatementAtoms(&left_side, appearing_conjunction, extensionally);
+    countHigherOrderStatementAtoms(&left_side, &appearing_conjunction, extensionally);
     char depvar_i = 1;
-    char variable_id[ATOMS_MAX] = {0};
+    AtomCounts variable_id = {0};
     Term conjunction_copy = conjunction;
     for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
     {
         Atom atom = conjunction_copy.atoms[i];
-        if(appearing_conjunction[(int) atom] >= 2)
+        if(AtomCounts_Get(&appearing_conjunction, atom) >= 2)
         {
-            int var_id = variable_id[(int) atom] = variable_id[(int) atom] ? variable_id[(int) atom] : depvar_i++;
+            int *atom_var_id = AtomCounts_At(&variable_id, atom);
+            int var_id = *atom_var_id = *atom_var_id ? *atom_var_id : depvar_i++;
             if(var_id <= 9) //can only introduce up to 9 variables
             {
                 char varname[3] = { '#', ('0' + var_id), 0 }; //#i
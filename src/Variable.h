@@ -36,9 +36,11 @@
 
 //Data structure//
 //--------------//
-//Substitution, mapping variable atoms to terms
+//Substitution, mapping variable atoms to subterms of the term they were unified with
 typedef struct {
-    Term map[27+1]; //there can only be 27 variables: $1 to $9 and #1 to #9 and ?1 to ?9, but it can't be 0
+    Term *specific; //the term the variables were unified with, not copied, see Variable_Unify
+    HASH_TYPE specificHash; //hash of the atoms of specific at unification, only set and checked in debug builds
+    unsigned char map[27+1]; //position+1 of the subterm in specific, 0 if unbound, there can only be 27 variables: $1 to $9 and #1 to #9 and ?1 to ?9, but it can't be 0
     bool success;
 } Substitution;
 
@@ -55,6 +57,9 @@ bool Variable_isVariable(Atom atom);
 //Whether the term has variables of certain kind
 bool Variable_hasVariable(Term *term, bool independent, bool dependent, bool query);
 //Unify two terms, returning the substitution/unifier
+//The substitution refers to the subterms of specific instead of copying them,
+//so specific must stay unchanged and in scope as long as the substitution is applied,
+//which is asserted in Variable_ApplySubstitute in debug builds
 Substitution Variable_Unify(Term *general, Term *specific);
 Substitution Variable_Unify2(Term *general, Term *specific, bool unifyQueryVarOnly);
 //Applying the substitution to a term, returning success
@@ -0,0 +1,72 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//Fill concept memory of the given capacity with <ai --> bj> concepts, which don't need more than 2048 atoms
+static void Cycle_Benchmark_FillConcepts(int amount)
+{
+    Memory_Config config = MEMORY_CONFIG_DEFAULT;
+    config.conceptsMax = amount;
+    NAR_INIT_Config(config);
+    char narsese[40];
+    for(int i=0; i<amount; i++)
+    {
+        sprintf(narsese, "<a%d --> b%d>", i % 1024, i / 1024);
+        Term term = Narsese_Term(narsese);
+        Concept *c = Memory_Conceptualize(&term, 1);
+        Memory_SetConceptPriority(c, 1.0, 1);
+    }
+}
+
+//Forgetting cycles per second, measured for about a second
+static double Cycle_Benchmark_ForgettingPerSecond(bool lazy)
+{
+    LAZY_FORGETTING = lazy;
+    long cycles = 0;
+    clock_t start = clock();
+    double seconds = 0.0;
+    while(seconds < 1.0)
+    {
+        Cycle_RelativeForgetting(++cycles);
+        seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    }
+    LAZY_FORGETTING = LAZY_FORGETTING_INITIAL;
+    return cycles / seconds;
+}
+
+void Cycle_Benchmark()
+{
+    puts(">>Cycle benchmark start");
+    //the cost of eager forgetting grows with the amount of concepts, lazy forgetting's doesn't:
+    int amounts[] = { 16384, 131072, 1048576 };
+    for(unsigned int i=0; i<NUM_ELEMENTS(amounts); i++)
+    {
+        Cycle_Benchmark_FillConcepts(amounts[i]);
+        double eager = Cycle_Benchmark_ForgettingPerSecond(false);
+        Cycle_Benchmark_FillConcepts(amounts[i]);
+        double lazy = Cycle_Benchmark_ForgettingPerSecond(true);
+        printf("Forgetting cycles per second with %d concepts: eager %f, lazy %f\n", amounts[i], eager, lazy);
+    }
+    NAR_INIT_Config(MEMORY_CONFIG_DEFAULT);
+    puts("<<Cycle benchmark done");
+}
@@ -0,0 +1,63 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+static void Decision_Benchmark_Op(Term args)
+{
+    (void) args;
+}
+
+void Decision_Benchmark()
+{
+    puts(">>Decision benchmark start");
+    NAR_INIT();
+    PRINT_INPUT = false;
+    MOTOR_BABBLING_CHANCE = 0.0;
+    NAR_AddOperation("^left", Decision_Benchmark_Op);
+    NAR_AddOperation("^right", Decision_Benchmark_Op);
+    //procedural knowledge with a variable precondition, and many concepts Decision_BestCandidate could consider for it
+    NAR_AddInputNarsese("<(<$1 --> [seen]> &/ ^left) =/> <$1 --> [reached]>>.");
+    NAR_AddInputNarsese("<(<$1 --> [heard]> &/ ^right) =/> <$1 --> [reached]>>.");
+    char narsese[NARSESE_LEN_MAX];
+    int objects = 4096;
+    for(int i=0; i<objects; i++)
+    {
+        sprintf(narsese, "<obj%d --> [%s]>.", i, i % 2 ? "seen" : "heard");
+        NAR_AddInputNarsese(narsese);
+    }
+    Stats_countDecisionGoals = 0;
+    Stats_countDecisionCycles = 0;
+    int goals = 1000;
+    clock_t start = clock();
+    for(int i=0; i<goals; i++)
+    {
+        sprintf(narsese, "<obj%d --> [reached]>! :|:", i % objects);
+        NAR_AddInputNarsese(narsese);
+    }
+    double seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    printf("Goals per second with %d concepts: %f, decision cycles per goal: %llu\n", concepts.itemsAmount, goals / MAX(seconds, 0.000001), Stats_countDecisionCycles / MAX(1, Stats_countDecisionGoals));
+    NAR_INIT();
+    PRINT_INPUT = PRINT_INPUT_INITIAL;
+    MOTOR_BABBLING_CHANCE = MOTOR_BABBLING_CHANCE_INITIAL;
+    puts("<<Decision benchmark done");
+}
@@ -0,0 +1,80 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define HASHTABLE_BENCHMARK_BUCKETS (HASHTABLE_BUCKETS_PER_ITEM*CONCEPTS_MAX)
+
+//Concept hashtable workloads with already hashed terms: lookups of present and absent terms on a full table,
+//and deleting the oldest concept for each new one as concept recycling does
+void HashTable_Benchmark()
+{
+    puts(">>HashTable benchmark start");
+    HashTable hashtable;
+    static HashTableSlot slots[HASHTABLE_BENCHMARK_BUCKETS];
+    static Term terms[3*CONCEPTS_MAX];
+    HashTable_INIT(&hashtable, slots, HASHTABLE_BENCHMARK_BUCKETS, (Equal) Term_Equal, (Hash) Term_Hash);
+    for(int i=0; i<3*CONCEPTS_MAX; i++)
+    {
+        terms[i] = (Term) {0};
+        terms[i].atoms[0] = Narsese_CopulaIndex(INHERITANCE);
+        terms[i].atoms[1] = i % (ATOMS_MAX-1) + 1;
+        terms[i].atoms[2] = i / (ATOMS_MAX-1) + 1;
+        Term_Hash(&terms[i]);
+    }
+    for(int i=0; i<CONCEPTS_MAX; i++)
+    {
+        HashTable_Set(&hashtable, &terms[i], &terms[i]);
+    }
+    int repetitions = 20;
+    volatile long found = 0;
+    clock_t start = clock();
+    for(int k=0; k<repetitions; k++)
+    {
+        for(int i=0; i<CONCEPTS_MAX; i++)
+        {
+            found += HashTable_Get(&hashtable, &terms[i]) != NULL;
+        }
+    }
+    double seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    printf("HashTable hits per second: %f\n", repetitions * CONCEPTS_MAX / MAX(seconds, 0.000001));
+    start = clock();
+    for(int k=0; k<repetitions; k++)
+    {
+        for(int i=CONCEPTS_MAX; i<2*CONCEPTS_MAX; i++)
+        {
+            found += HashTable_Get(&hashtable, &terms[i]) != NULL;
+        }
+    }
+    seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    printf("HashTable misses per second: %f\n", repetitions * CONCEPTS_MAX / MAX(seconds, 0.000001));
+    int replacements = repetitions * CONCEPTS_MAX;
+    start = clock();
+    for(int i=0; i<replacements; i++)
+    {
+        HashTable_Delete(&hashtable, &terms[i % (3*CONCEPTS_MAX)]);
+        HashTable_Set(&hashtable, &terms[(i+CONCEPTS_MAX) % (3*CONCEPTS_MAX)], &terms[i]);
+    }
+    seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    printf("HashTable delete and set pairs per second: %f, maximum chain length with %d concepts: %d\n", replacements / MAX(seconds, 0.000001), CONCEPTS_MAX, HashTable_MaximumChainLength(&hashtable));
+    puts("<<HashTable benchmark done");
+}
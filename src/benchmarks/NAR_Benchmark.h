@@ -0,0 +1,72 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#define NAR_BENCHMARK_KNOWLEDGE 2000
+
+//Wall clock seconds, as clock() adds up the time of the worker threads
+static double NAR_Benchmark_Seconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+//Loading a knowledge base of eternal beliefs one by one against as a batch, with 1 and 4 inference threads
+void NAR_Benchmark()
+{
+    puts(">>NAR benchmark start");
+    char (*sentences)[NARSESE_LEN_MAX] = malloc(NAR_BENCHMARK_KNOWLEDGE * sizeof(*sentences));
+    char **knowledge = malloc(NAR_BENCHMARK_KNOWLEDGE * sizeof(char*));
+    assert(sentences != NULL && knowledge != NULL, "Allocation of the knowledge failed!");
+    for(int i=0; i<NAR_BENCHMARK_KNOWLEDGE; i++)
+    {
+        snprintf(sentences[i], NARSESE_LEN_MAX, "<(k%d * k%d) --> (r%d | q%d)>. {0.9 0.8}", i, i/2, i%17, i%5);
+        knowledge[i] = sentences[i];
+    }
+    bool printInput = PRINT_INPUT;
+    int threads[2] = { 1, 4 };
+    for(int i=0; i<2; i++)
+    {
+        NAR_INIT_Config(MEMORY_CONFIG_DEFAULT);
+        PRINT_INPUT = false; //the batch doesn't echo them
+        INFERENCE_THREADS = threads[i];
+        double start = NAR_Benchmark_Seconds();
+        for(int j=0; j<NAR_BENCHMARK_KNOWLEDGE; j++) { NAR_AddInputNarsese(knowledge[j]); }
+        double sequentialSeconds = NAR_Benchmark_Seconds() - start;
+        NAR_INIT_Config(MEMORY_CONFIG_DEFAULT);
+        PRINT_INPUT = false;
+        INFERENCE_THREADS = threads[i];
+        start = NAR_Benchmark_Seconds();
+        NAR_AddInputNarseseBatch(knowledge, NAR_BENCHMARK_KNOWLEDGE);
+        double batchSeconds = NAR_Benchmark_Seconds() - start;
+        printf("Eternal beliefs loaded per second with %d inference threads: one by one %f, batch %f\n", threads[i],
+               NAR_BENCHMARK_KNOWLEDGE / MAX(sequentialSeconds, 0.000001), NAR_BENCHMARK_KNOWLEDGE / MAX(batchSeconds, 0.000001));
+    }
+    INFERENCE_THREADS = INFERENCE_THREADS_INITIAL;
+    PRINT_INPUT = printInput;
+    free(sentences);
+    free(knowledge);
+    puts("<<NAR benchmark done");
+}
@@ -0,0 +1,48 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+//Parsing throughput of sensor input, the single-pass parser against the multi-pass one of Narsese_Test
+void Narsese_Benchmark()
+{
+    puts(">>Narsese benchmark start");
+    NAR_INIT();
+    int repetitions = 100000;
+    clock_t start = clock();
+    for(int i=0; i<repetitions; i++) { Narsese_Test_MultiPassTerm("<obj --> [seen]>"); }
+    double multiPassSeconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    start = clock();
+    for(int i=0; i<repetitions; i++) { Narsese_Term("<obj --> [seen]>"); }
+    double singlePassSeconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    start = clock();
+    for(int i=0; i<repetitions; i++)
+    {
+        Term term; char punctuation; int tense; Truth tv; double occurrenceTimeOffset;
+        Narsese_Sentence("<obj --> [seen]>. :|:", &term, &punctuation, &tense, &tv, &occurrenceTimeOffset);
+    }
+    double sentenceSeconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    printf("Terms parsed per second: multi-pass %f, single-pass %f\n", repetitions / MAX(multiPassSeconds, 0.000001), repetitions / MAX(singlePassSeconds, 0.000001));
+    printf("Sentences parsed per second: %f\n", repetitions / MAX(sentenceSeconds, 0.000001));
+    puts("<<Narsese benchmark done");
+}
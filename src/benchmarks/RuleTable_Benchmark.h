@@ -0,0 +1,81 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if STAGE==2
+//Premise pairs of the kinds occurring in the NAL examples
+static char *RuleTable_Benchmark_Premises[][2] = { { "<cat --> animal>", "<animal --> being>" },
+                                                   { "<cat --> animal>", "<dog --> animal>" },
+                                                   { "<{tim} --> [tall]>", "<tim <-> tom>" },
+                                                   { "<(cat * fish) --> eat>", "<tiger --> cat>" },
+                                                   { "<(cat | dog) --> animal>", "<cat --> animal>" },
+                                                   { "<a ==> b>", "<b ==> c>" },
+                                                   { "<(a && b) ==> c>", "<a ==> c>" },
+                                                   { "<a <=> b>", "<c <=> a>" },
+                                                   { "<(a &/ ^left) =/> b>", "<b ==> c>" },
+                                                   { "<(a &/ ^left) =/> b>", "<c --> d>" },
+                                                   { "(a &/ b)", "(c &/ d)" },
+                                                   { "(! <a --> b>)", "<c --> d>" },
+                                                   { "a", "(a && b)" } };
+
+static double RuleTable_Benchmark_ApplyPerSecond()
+{
+    NAR_INIT();
+    static NAL_Derivations derivations;
+    NAL_derivations = &derivations; //measure the rule matching without memory insertion
+    int pairs = NUM_ELEMENTS(RuleTable_Benchmark_Premises);
+    Term terms[NUM_ELEMENTS(RuleTable_Benchmark_Premises)][2];
+    for(int i=0; i<pairs; i++)
+    {
+        terms[i][0] = Narsese_Term(RuleTable_Benchmark_Premises[i][0]);
+        terms[i][1] = Narsese_Term(RuleTable_Benchmark_Premises[i][1]);
+    }
+    int repetitions = 20000;
+    clock_t start = clock();
+    for(int k=0; k<repetitions; k++)
+    {
+        for(int i=0; i<pairs; i++)
+        {
+            for(int j=0; j<2; j++)
+            {
+                derivations.itemsAmount = 0;
+                RuleTable_Apply(terms[i][j], terms[i][1-j], NAR_DEFAULT_TRUTH, NAR_DEFAULT_TRUTH, 1, 0, (Stamp) {0}, 1, 1.0, 1.0, true, NULL, 0);
+                derivations.itemsAmount = 0;
+                RuleTable_Apply(terms[i][j], (Term) {0}, NAR_DEFAULT_TRUTH, (Truth) {0}, 1, 0, (Stamp) {0}, 1, 1.0, 1.0, false, NULL, 0);
+            }
+        }
+    }
+    double seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    NAL_derivations = NULL;
+    return repetitions * pairs * 4 / MAX(seconds, 0.000001);
+}
+#endif
+
+void RuleTable_Benchmark()
+{
+    puts(">>RuleTable benchmark start");
+#if STAGE==2
+    printf("RuleTable_Apply calls per second: %f\n", RuleTable_Benchmark_ApplyPerSecond());
+#endif
+    puts("<<RuleTable benchmark done");
+}
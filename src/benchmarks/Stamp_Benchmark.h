@@ -0,0 +1,45 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//Overlap checks run for every premise pair in the inference loops
+void Stamp_Benchmark()
+{
+    puts(">>Stamp benchmark start");
+    Stamp input1 = Stamp_input(1), disjoint = Stamp_input(STAMP_SIZE+1), full = {0};
+    for(int i=0; i<STAMP_SIZE; i++)
+    {
+        Stamp next = Stamp_input(i+1);
+        full = Stamp_make(&next, &full);
+    }
+    int repetitions = 1000000;
+    volatile int overlaps = 0;
+    clock_t start = clock();
+    for(int i=0; i<repetitions; i++)
+    {
+        overlaps += Stamp_checkOverlap(&full, i % 2 ? &disjoint : &input1);
+    }
+    double seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    printf("Overlap checks per second: %f\n", repetitions / MAX(seconds, 0.000001));
+    puts("<<Stamp benchmark done");
+}
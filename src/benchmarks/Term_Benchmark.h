@@ -0,0 +1,68 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+static void Term_Benchmark_PrintSpeedup(char *kernel, clock_t scalarTime, clock_t kernelTime)
+{
+    printf("%s: scalar %f s, kernel %f s, speedup %f\n", kernel, ((double) scalarTime) / CLOCKS_PER_SEC, ((double) kernelTime) / CLOCKS_PER_SEC, ((double) scalarTime) / MAX(kernelTime, 1));
+}
+
+//The atom scan kernels against the scalar scans of Term_Test
+void Term_Benchmark()
+{
+    puts(">>Term benchmark start");
+    NAR_INIT();
+    Term terms[4] = { Narsese_Term("<(<cat --> [meowing]> &/ <cat --> [furry]>) =/> <cat --> animal>>"),
+                      Narsese_Term("<(<$1 --> [meowing]> &/ <$1 --> [furry]>) =/> <$1 --> animal>>"),
+                      Narsese_Term("<{SELF} --> [good]>"),
+                      Narsese_Term("<(<#1 --> a> &/ <?1 --> b>) =/> (&&,<#1 --> c>,<#1 --> d>)>") };
+    Term last = {0};
+    last.atoms[COMPOUND_TERM_SIZE_MAX-1] = terms[2].atoms[0];
+    int repetitions = 1000000;
+    volatile long sink = 0;
+    clock_t start = clock();
+    for(int i=0; i<repetitions; i++) { sink += Term_Test_ScalarEqual(&terms[i & 1], &terms[0]); }
+    clock_t scalarTime = clock() - start;
+    start = clock();
+    for(int i=0; i<repetitions; i++) { sink += Term_Equal(&terms[i & 1], &terms[0]); }
+    Term_Benchmark_PrintSpeedup("Term_Equal", scalarTime, clock() - start);
+    start = clock();
+    for(int i=0; i<repetitions; i++) { sink += Term_Test_ScalarComplexity(&terms[i & 3]); }
+    scalarTime = clock() - start;
+    start = clock();
+    for(int i=0; i<repetitions; i++) { sink += Term_Complexity(&terms[i & 3]); }
+    Term_Benchmark_PrintSpeedup("Term_Complexity", scalarTime, clock() - start);
+    start = clock();
+    for(int i=0; i<repetitions; i++) { sink += Term_Test_ScalarHasVariable(&terms[(i & 1) * 2]); }
+    scalarTime = clock() - start;
+    start = clock();
+    for(int i=0; i<repetitions; i++) { sink += Variable_hasVariable(&terms[(i & 1) * 2], true, true, true); }
+    Term_Benchmark_PrintSpeedup("Variable_hasVariable", scalarTime, clock() - start);
+    start = clock();
+    for(int i=0; i<repetitions; i++) { sink += Term_Test_ScalarHasSimpleAtom(&last); }
+    scalarTime = clock() - start;
+    start = clock();
+    for(int i=0; i<repetitions; i++) { sink += Narsese_HasSimpleAtom(&last); }
+    Term_Benchmark_PrintSpeedup("Narsese_HasSimpleAtom", scalarTime, clock() - start);
+    puts("<<Term benchmark done");
+}
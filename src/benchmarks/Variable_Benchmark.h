@@ -0,0 +1,100 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if STAGE==2
+//Premise pairs of the NAL-6 and NAL-8 examples, the derived implications and conjunctions get variables introduced
+static char *Variable_Benchmark_Premises[][2] = { { "<<$1 --> bird> ==> <$1 --> animal>>", "<tweety --> bird>" },
+                                                  { "<(&&,<$1 --> flyer>,<$1 --> [chirping]>) ==> <$1 --> bird>>", "<tweety --> flyer>" },
+                                                  { "<<$1 --> [with_wings]> ==> <$1 --> flyer>>", "<<$1 --> [with_wings]> ==> <$1 --> bird>>" },
+                                                  { "<(<cat --> [meowing]> &/ <cat --> [furry]>) =/> <cat --> animal>>", "<cat --> [meowing]>" },
+                                                  { "<(<cat --> [meowing]> &/ <cat --> [furry]>) =/> <cat --> animal>>", "<cat --> animal>" },
+                                                  { "<(<{light} --> [on]> &/ ^pick) =/> <{light} --> [off]>>", "<{light} --> [on]>" },
+                                                  { "<{tom} --> cat>", "<{tom} --> [furry]>" },
+                                                  { "<(tom * fish) --> eat>", "<(tom * meat) --> eat>" } };
+#endif
+
+void Variable_Benchmark()
+{
+    puts(">>Variable benchmark start");
+    NAR_INIT();
+    Term implication = Narsese_Term("<(<cat --> [meowing]> &/ <cat --> [furry]>) =/> <cat --> animal>>");
+    Term conjunction = Narsese_Term("(&&,<cat --> [meowing]>,<cat --> [furry]>)");
+    bool success;
+    //variable introduction is called twice per higher-order derivation:
+    int repetitions = 100000;
+    clock_t start = clock();
+    for(int i=0; i<repetitions; i++)
+    {
+        Variable_IntroduceImplicationVariables(implication, &success, i % 2);
+        Variable_IntroduceConjunctionVariables(conjunction, &success, i % 2);
+    }
+    double seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    printf("Variable introductions per second: %f\n", 2.0 * repetitions / MAX(seconds, 0.000001));
+    //unification runs for each candidate concept in the matching loops:
+    Term general = Narsese_Term("<($1 &/ <$1 --> [furry]>) =/> #1>");
+    Term specific = Narsese_Term("<(cat &/ <cat --> [furry]>) =/> <cat --> animal>>");
+    Term inconsistent = Narsese_Term("<(cat &/ <dog --> [furry]>) =/> <cat --> animal>>");
+    start = clock();
+    for(int i=0; i<repetitions; i++)
+    {
+        Substitution unifier = Variable_Unify(&general, i % 2 ? &specific : &inconsistent);
+        if(unifier.success)
+        {
+            Variable_ApplySubstitute(general, unifier, &success);
+        }
+    }
+    seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    printf("Unifications per second: %f\n", repetitions / MAX(seconds, 0.000001));
+#if STAGE==2
+    //derivations of NAL-6/8 premises, buffered instead of added to memory to measure the inference alone:
+    static NAL_Derivations derivations;
+    NAL_derivations = &derivations;
+    int pairs = NUM_ELEMENTS(Variable_Benchmark_Premises);
+    Term terms[NUM_ELEMENTS(Variable_Benchmark_Premises)][2];
+    for(int i=0; i<pairs; i++)
+    {
+        terms[i][0] = Narsese_Term(Variable_Benchmark_Premises[i][0]);
+        terms[i][1] = Narsese_Term(Variable_Benchmark_Premises[i][1]);
+    }
+    long derived = 0;
+    repetitions = 20000;
+    start = clock();
+    for(int k=0; k<repetitions; k++)
+    {
+        for(int i=0; i<pairs; i++)
+        {
+            for(int j=0; j<2; j++)
+            {
+                derivations.itemsAmount = 0;
+                RuleTable_Apply(terms[i][j], terms[i][1-j], NAR_DEFAULT_TRUTH, NAR_DEFAULT_TRUTH, 1, 0, (Stamp) {0}, 1, 1.0, 1.0, true, NULL, 0);
+                derived += derivations.itemsAmount;
+            }
+        }
+    }
+    seconds = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+    NAL_derivations = NULL;
+    printf("NAL-6/8 derivations per second: %f (%ld derivations)\n", derived / MAX(seconds, 0.000001), derived / repetitions);
+#endif
+    puts("<<Variable benchmark done");
+}
@@ -0,0 +1,47 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Variable_Benchmark.h"
+#include "Cycle_Benchmark.h"
+#include "RuleTable_Benchmark.h"
+#include "Decision_Benchmark.h"
+#include "Term_Benchmark.h"
+#include "Stamp_Benchmark.h"
+#include "HashTable_Benchmark.h"
+#include "Narsese_Benchmark.h"
+#include "NAR_Benchmark.h"
+
+//Microbenchmarks of the hot paths, they print their throughput and are not run with the tests
+void Run_Benchmarks()
+{
+    Variable_Benchmark();
+    Cycle_Benchmark();
+    RuleTable_Benchmark();
+    Decision_Benchmark();
+    Term_Benchmark();
+    Stamp_Benchmark();
+    HashTable_Benchmark();
+    Narsese_Benchmark();
+    NAR_Benchmark();
+}
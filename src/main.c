@@ -30,6 +30,7 @@
 #include "NAR.h"
 #include "./unit_tests/unit_tests.h"
 #include "./system_tests/system_tests.h"
+#include "./benchmarks/benchmarks.h"
 #include "Shell.h"
 #include "./NetworkNAR/UDPNAR.h"
 
@@ -59,6 +60,10 @@ void Process_Args(int argc, char *argv[])
             NAL_GenerateRuleTable();
             exit(0);
         }
+        if(!strcmp(argv[1],"bench"))
+        {
+            Run_Benchmarks();
+        }
         if(!strcmp(argv[1],"shell"))
         {
             Shell_Start();
@@ -139,6 +144,7 @@ void Display_Help()
     puts("NAR cartpole (starts the cartpole example)");
     puts("NAR robot (starts the robot example)");
     puts("NAR shell (starts the interactive NAL shell)");
+    puts("NAR bench (runs the microbenchmarks)");
 }
 
 int main(int argc, char *argv[])
@@ -0,0 +1,67 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+void NAR_Question_Test()
+{
+    NAR_INIT();
+    puts(">>NAR Question test start");
+    NAR_AddInputNarsese("<a --> b>.");
+    NAR_AddInputNarsese("<c --> d>. %0.6;0.9%");
+    NAR_AddInputNarsese("<a --> e>. :|:");
+    NAR_Cycles(5);
+    Term questions[4] = { Narsese_Term("<a --> b>"), Narsese_Term("<?1 --> d>"), Narsese_Term("<a --> ?1>"), Narsese_Term("<x --> y>") };
+    int tenses[4] = { 0, 0, 1, 0 };
+    Answer answers[4];
+    NAR_AnswerQuestions(questions, tenses, 4, answers);
+    Term ab = Narsese_Term("<a --> b>");
+    Term cd = Narsese_Term("<c --> d>");
+    Term ae = Narsese_Term("<a --> e>");
+    assert(answers[0].answered && Term_Equal(&answers[0].term, &ab) && answers[0].occurrenceTime == OCCURRENCE_ETERNAL, "<a --> b> should have been answered by its belief!");
+    assert(answers[1].answered && Term_Equal(&answers[1].term, &cd) && answers[1].truth.frequency == 0.6, "<?1 --> d> should have been answered by <c --> d>!");
+    assert(answers[2].answered && Term_Equal(&answers[2].term, &ae) && answers[2].occurrenceTime != OCCURRENCE_ETERNAL, "<a --> ?1> :|: should have been answered by the event <a --> e>!");
+    assert(!answers[3].answered, "<x --> y> should not have been answered!");
+    //answering them one by one gives the same answers:
+    for(int i=0; i<4; i++)
+    {
+        Answer answer;
+        NAR_AnswerQuestions(&questions[i], &tenses[i], 1, &answer);
+        assert(answer.answered == answers[i].answered && Term_Equal(&answer.term, &answers[i].term) && answer.creationTime == answers[i].creationTime, "Batch and single answers should be the same!");
+    }
+    //equally expected answers are taken from the concept which is later in the concepts queue, as by a scan over it, whatever order the candidates are visited in
+    NAR_AddInputNarsese("<g --> h>.");
+    NAR_AddInputNarsese("<i --> h>.");
+    Term gh = Narsese_Term("<g --> h>");
+    Term ih = Narsese_Term("<i --> h>");
+    Concept *cgh = Memory_FindConceptByTerm(&gh);
+    Concept *cih = Memory_FindConceptByTerm(&ih);
+    assert(cgh != NULL && cih != NULL && Truth_Expectation(cgh->belief.truth) == Truth_Expectation(cih->belief.truth), "Both beliefs should be equally expected!");
+    Term tie = Narsese_Term("<?1 --> h>");
+    int eternal = 0;
+    Answer tieAnswer;
+    NAR_AnswerQuestions(&tie, &eternal, 1, &tieAnswer);
+    Concept *later = cgh->queuePosition > cih->queuePosition ? cgh : cih;
+    assert(tieAnswer.answered && Term_Equal(&tieAnswer.term, &later->term), "The tie should have been resolved by the queue position!");
+    NAR_AddInputNarseseQuestions("<a --> b>? <?1 --> d>? <a --> ?1>? :|: <x --> y>?");
+    puts("<<NAR Question test successful");
+}
@@ -522,7 +522,7 @@ void NAR_Robot(long iterations)
         }
         fputs("\033[1;1H\033[2J", stdout); //POSIX clear screen
         World_Draw();
-        printf("time=%ld moves=%d move_success_ratio=%f eaten=%d reasonerStep=%ld\n", t, moves, (float) (((float) moves) / ((float) t)), eaten, currentTime);
+        printf("time=%ld moves=%d move_success_ratio=%f eaten=%d reasonerStep=%ld decision_cycles_per_goal=%llu\n", t, moves, (float) (((float) moves) / ((float) t)), eaten, currentTime, Stats_countDecisionCycles / MAX(1, Stats_countDecisionGoals));
         Agent_Invoke();
         if(iterations == -1)
         {
@@ -389,7 +389,7 @@ void NAR_TestChamber()
             puts("");
         }
         printf("\nCurrent goal: %s", goal);
-        printf("\ngoals=%d, reached=%d, ratio=%f \n", (int) goals, (int) reached, ((float) reached)/((float) goals));
+        printf("\ngoals=%d, reached=%d, ratio=%f decision_cycles_per_goal=%llu\n", (int) goals, (int) reached, ((float) reached)/((float) goals), Stats_countDecisionCycles / MAX(1, Stats_countDecisionGoals));
         puts("\nCommand:");
         char probe = '\n';
         if(c >= 'a' && c <= 'z')
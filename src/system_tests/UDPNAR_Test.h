@@ -37,7 +37,9 @@ void NAR_UDPNAR_Test()
     int port = 50001;
     long timestep = 10000000L; //10ms
     UDPNAR_Start(ip, port, timestep);
+    NAR_Acquire(UDPNAR_instance);
     NAR_AddOperation("^left", NAR_UDPNAR_Test_op_left);
+    NAR_Release();
     int sockfd_sender = UDP_INIT_Sender();
     char *send_data1 = "<(a &/ ^left) =/> g>.";
     UDP_SendData(sockfd_sender, ip, port, send_data1, strlen(send_data1)+1);
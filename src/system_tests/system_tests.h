@@ -63,6 +63,7 @@ void DRAW_LINE(double x, double y, double angle, int len, char *canvas, char sym
 #include "Multistep2_Test.h"
 #include "Testchamber_Test.h"
 #include "Sequence_Test.h"
+#include "Question_Test.h"
 #include "Alien_Test.h"
 #include "UDPNAR_Test.h"
 
@@ -74,5 +75,6 @@ void Run_System_Tests()
     NAR_Multistep_Test();
     NAR_Multistep2_Test();
     NAR_Sequence_Test();
+    NAR_Question_Test();
     NAR_UDPNAR_Test();
 }
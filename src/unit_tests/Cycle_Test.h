@@ -0,0 +1,122 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+static void Cycle_Test_FillConcepts(int amount)
+{
+    NAR_INIT();
+    char name[20];
+    for(int i=0; i<amount; i++)
+    {
+        sprintf(name, "c%d", i);
+        Term term = Narsese_AtomicTerm(name);
+        Concept *c = Memory_Conceptualize(&term, 1);
+        Memory_SetConceptPriority(c, 1.0, 1);
+    }
+}
+
+//Summarizes concept memory content and order to compare runs
+static unsigned long Cycle_Test_MemoryChecksum()
+{
+    unsigned long checksum = concepts.itemsAmount;
+    for(int i=0; i<concepts.itemsAmount; i++)
+    {
+        Concept *c = concepts.items[i].address;
+        checksum = checksum * 31 + Term_Hash(&c->term);
+        checksum = checksum * 31 + (unsigned long) (c->belief.truth.confidence * 1000000.0);
+    }
+    return checksum;
+}
+
+static unsigned long Cycle_Test_DeterministicRun(int threads, int derivationsMax)
+{
+    NAR_INIT();
+    Stats_countConceptsMatchedTotal = 0; //the concept threshold adapts to it
+    DETERMINISTIC_INFERENCE = true;
+    INFERENCE_THREADS = threads;
+    DERIVATIONS_MAX = derivationsMax;
+    NAR_AddInputNarsese("<cat --> animal>.");
+    NAR_AddInputNarsese("<animal --> being>.");
+    NAR_AddInputNarsese("<cat --> [furry]>.");
+    NAR_AddInputNarsese("<dog --> animal>.");
+    NAR_AddInputNarsese("<dog --> [furry]>.");
+    NAR_Cycles(50);
+    DETERMINISTIC_INFERENCE = DETERMINISTIC_INFERENCE_INITIAL;
+    INFERENCE_THREADS = INFERENCE_THREADS_INITIAL;
+    DERIVATIONS_MAX = DERIVATIONS_MAX_INITIAL;
+    return Cycle_Test_MemoryChecksum();
+}
+
+void Cycle_Test()
+{
+    puts(">>Cycle test start");
+    //lazy forgetting has to lead to the same concept priority as eager forgetting:
+    Cycle_Test_FillConcepts(10);
+    for(long t=1; t<=20; t++)
+    {
+        Cycle_RelativeForgetting(t);
+    }
+    double eagerPriority = Memory_ConceptPriority(concepts.items[0].address, 21);
+    Cycle_Test_FillConcepts(10);
+    LAZY_FORGETTING = true;
+    for(long t=1; t<=20; t++)
+    {
+        Cycle_RelativeForgetting(t);
+    }
+    double lazyPriority = Memory_ConceptPriority(concepts.items[0].address, 21);
+    LAZY_FORGETTING = LAZY_FORGETTING_INITIAL;
+    assert(fabs(eagerPriority - pow(CONCEPT_DURABILITY, 20)) < 0.000000001, "Concept priority should have decayed 20 times");
+    assert(fabs(eagerPriority - lazyPriority) < 0.000000001, "Lazy forgetting should lead to the same priority");
+    //the round-robin re-evaluation of lazy forgetting visits every concept once per round, though it moves them in the queue:
+    int amount = 10*LAZY_FORGETTING_USEFULNESS_UPDATES;
+    Cycle_Test_FillConcepts(amount);
+    LAZY_FORGETTING = true;
+    for(int k=0; k<amount/LAZY_FORGETTING_USEFULNESS_UPDATES; k++)
+    {
+        Cycle_RelativeForgetting(2);
+    }
+    LAZY_FORGETTING = LAZY_FORGETTING_INITIAL;
+    for(int i=0; i<concepts.itemsAmount; i++)
+    {
+        Concept *c = concepts.items[i].address;
+        assert(c->queuePosition == i, "Concept should know its queue position");
+        assert(concepts.items[i].priority == Usage_usefulness(c->usage, 2), "Each concept should have been re-evaluated once");
+    }
+    //derivations of parallel inference have to arrive in memory:
+    NAR_INIT();
+    INFERENCE_THREADS = 4;
+    NAR_AddInputNarsese("<a --> b>.");
+    NAR_AddInputNarsese("<b --> c>.");
+    NAR_Cycles(10);
+    INFERENCE_THREADS = INFERENCE_THREADS_INITIAL;
+    Term conclusion = Narsese_Term("<a --> c>");
+    assert(Memory_FindConceptByTerm(&conclusion) != NULL, "Parallel inference should have derived <a --> c>");
+    //deterministic inference has to give the same memory for any amount of threads:
+    assert(Cycle_Test_DeterministicRun(1, DERIVATIONS_MAX_INITIAL) == Cycle_Test_DeterministicRun(4, DERIVATIONS_MAX_INITIAL), "Deterministic inference should not depend on the thread count");
+    //also not when the derivations of a cycle exceed the maximum, which then drops the same ones:
+    unsigned long capped = Cycle_Test_DeterministicRun(1, 3);
+    assert(capped != Cycle_Test_DeterministicRun(1, DERIVATIONS_MAX_INITIAL), "The derivations should have exceeded the maximum");
+    assert(capped == Cycle_Test_DeterministicRun(4, 3), "Deterministic inference should not depend on the thread count at the derivations maximum");
+    NAR_INIT();
+    puts("<<Cycle test successful");
+}
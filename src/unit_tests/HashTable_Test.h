@@ -22,28 +22,38 @@
  * THE SOFTWARE.
  */
 
+#define HASHTABLE_TEST_BUCKETS (HASHTABLE_BUCKETS_PER_ITEM*CONCEPTS_MAX)
+
+//Key of the k-th item in the chain of the bucket, the item added last comes first, NULL if the chain is shorter
+static void *HashTable_Test_ChainKey(HashTable *hashtable, int bucket, int k)
+{
+    int i = hashtable->slots[bucket].head;
+    for(; i && k > 0; i=hashtable->slots[i-1].next, k--);
+    return i ? hashtable->slots[i-1].key : NULL;
+}
+
 void HashTable_Test()
 {
     HashTable HTtest;
-    VMItem* HTest_storageptrs[CONCEPTS_MAX];
-    VMItem HTest_storage[CONCEPTS_MAX];
-    VMItem* HTest_HT[CONCEPTS_HASHTABLE_BUCKETS]; //the hash of the concept term is the index
+    static HashTableSlot HTest_slots[HASHTABLE_TEST_BUCKETS]; //the hash of the concept term is the bucket
     puts(">>HashTable test start");
-    HashTable_INIT(&HTtest, HTest_storage, HTest_storageptrs, HTest_HT, CONCEPTS_HASHTABLE_BUCKETS, CONCEPTS_MAX, (Equal) Term_Equal, (Hash) Term_Hash);
-    assert(HTtest.VMStack.stackpointer == CONCEPTS_MAX, "The stack should be full!");
+    HashTable_INIT(&HTtest, HTest_slots, HASHTABLE_TEST_BUCKETS, (Equal) Term_Equal, (Hash) Term_Hash);
+    assert(HTtest.itemsAmount == 0, "The hashtable should be empty!");
     //Insert a first concept:
     Term term1 = Narsese_Term("<a --> b>");
     Concept c1 = { .id = 1, .term = term1 };
     HashTable_Set(&HTtest, &term1, &c1);
-    assert(HTtest.VMStack.stackpointer == CONCEPTS_MAX-1, "One item should be taken off of the stack");
-    assert(HTtest.HT[c1.term.hash % CONCEPTS_HASHTABLE_BUCKETS] != NULL, "Item didn't go in right place");
+    assert(HTtest.itemsAmount == 1, "One item should have been added");
+    int home = ((unsigned long) term1.hash) % HASHTABLE_TEST_BUCKETS;
+    assert(HashTable_Test_ChainKey(&HTtest, home, 0) == &term1, "Item didn't go in right place");
     //Return it
     Concept *c1_returned = HashTable_Get(&HTtest, &term1);
     assert(c1_returned != NULL, "Returned item is null (1)");
     assert(Term_Equal(&c1.term, &c1_returned->term), "Hashtable Get led to different term than we put into (1)");
     //insert another with the same hash:
     Term term2 = Narsese_Term("<c --> d>");
-    term2.hash = c1.term.hash;
+    term2.hash = term1.hash;
+    term2.hashed = true;
     Concept c2 = { .id = 2, .term = term2 }; //use different term but same hash, hash collision!
     HashTable_Set(&HTtest, &term2, &c2);
     //get first one:
@@ -51,31 +61,53 @@ void HashTable_Test()
     assert(c1_returned_again != NULL, "Returned item is null (2)");
     assert(Term_Equal(&c1.term, &c1_returned_again->term), "Hashtable Get led to different term than we put into (2)");
     Term term3 = Narsese_Term("<e --> f>");
-    term3.hash = c1.term.hash;
+    term3.hash = term1.hash;
+    term3.hashed = true;
     Concept c3 = { .id = 3, .term = term3 }; //use different term but same hash, hash collision!
     HashTable_Set(&HTtest, &term3, &c3);
-    //there should be a chain of 3 concepts now at the hash position:
-    assert(Term_Equal(HTtest.HT[c1.term.hash % CONCEPTS_HASHTABLE_BUCKETS]->key, &c1.term), "c1 not there! (1)");
-    assert(Term_Equal(((VMItem*)HTtest.HT[c1.term.hash % CONCEPTS_HASHTABLE_BUCKETS]->next)->key, &c2.term), "c2 not there! (1)");
-    assert(Term_Equal(((VMItem*)((VMItem*)HTtest.HT[c1.term.hash % CONCEPTS_HASHTABLE_BUCKETS]->next)->next)->key, &c3.term), "c3 not there! (1)");
-    //Delete the middle one, c2
+    //there should be a chain of 3 concepts now in the bucket:
+    assert(Term_Equal(HashTable_Test_ChainKey(&HTtest, home, 0), &c3.term), "c3 not there! (1)");
+    assert(Term_Equal(HashTable_Test_ChainKey(&HTtest, home, 1), &c2.term), "c2 not there! (1)");
+    assert(Term_Equal(HashTable_Test_ChainKey(&HTtest, home, 2), &c1.term), "c1 not there! (1)");
+    assert(HashTable_MaximumChainLength(&HTtest) == 3, "Chain should be of length 3");
+    //Delete the middle one, c2, which links c3 to c1
     HashTable_Delete(&HTtest, &term2);
-    assert(((Concept*)((VMItem*)HTtest.HT[c1.term.hash % CONCEPTS_HASHTABLE_BUCKETS]->next)->value)->id == 3, "c3 not there according to id! (2)");
-    assert(Term_Equal(HTtest.HT[c1.term.hash % CONCEPTS_HASHTABLE_BUCKETS]->key, &c1.term), "c1 not there! (2)");
-    assert(Term_Equal(((VMItem*)HTtest.HT[c1.term.hash % CONCEPTS_HASHTABLE_BUCKETS]->next)->key, &c3.term), "c3 not there! (2)");
-    //Delete the last one, c3
+    assert(((Concept*) HashTable_Get(&HTtest, &term3))->id == 3, "c3 not there according to id! (2)");
+    assert(Term_Equal(HashTable_Test_ChainKey(&HTtest, home, 0), &c3.term), "c3 not there! (2)");
+    assert(Term_Equal(HashTable_Test_ChainKey(&HTtest, home, 1), &c1.term), "c1 not there! (2)");
+    assert(HashTable_MaximumChainLength(&HTtest) == 2, "Chain should be of length 2");
+    assert(HashTable_Get(&HTtest, &term2) == NULL, "c2 should have been deleted");
+    //Delete the first one, c3
     HashTable_Delete(&HTtest, &term3);
-    assert(Term_Equal(HTtest.HT[c1.term.hash % CONCEPTS_HASHTABLE_BUCKETS]->key, &c1.term), "c1 not there! (3)");
-    //Delete the first one, which is the last one left, c1
+    assert(Term_Equal(HashTable_Test_ChainKey(&HTtest, home, 0), &c1.term), "c1 not there! (3)");
+    //Delete the last one left, c1
     HashTable_Delete(&HTtest, &term1);
-    assert(HTtest.HT[c1.term.hash % CONCEPTS_HASHTABLE_BUCKETS] == NULL, "Hash table at hash position must be null");
-    assert(HTtest.VMStack.stackpointer == CONCEPTS_MAX, "All elements should be free now");
+    assert(HTtest.slots[home].head == 0, "Bucket at hash position must be empty");
+    assert(HTtest.itemsAmount == 0, "All elements should be free now");
+    //the slots of deleted items are reused, so a full hashtable stays usable:
+    static Term fill[HASHTABLE_TEST_BUCKETS];
+    for(int round=0; round<2; round++)
+    {
+        for(int i=0; i<HASHTABLE_TEST_BUCKETS; i++)
+        {
+            fill[i] = (Term) {0};
+            fill[i].atoms[0] = Narsese_CopulaIndex(INHERITANCE);
+            fill[i].atoms[1] = i % (ATOMS_MAX-1) + 1;
+            fill[i].atoms[2] = i / (ATOMS_MAX-1) + 1 + round;
+            HashTable_Set(&HTtest, &fill[i], &fill[i]);
+        }
+        assert(HTtest.itemsAmount == HASHTABLE_TEST_BUCKETS && HTtest.freeSlots == 0, "All slots should hold an item");
+        for(int i=0; i<HASHTABLE_TEST_BUCKETS; i++)
+        {
+            assert(HashTable_GetWithHash(&HTtest, &fill[i], fill[i].hash) == &fill[i], "Item of the full hashtable not found");
+            HashTable_DeleteWithHash(&HTtest, &fill[i], fill[i].hash);
+        }
+        assert(HTtest.itemsAmount == 0, "All items should have been deleted");
+    }
     //test for chars:
     HashTable HTtest2;
-    VMItem* HTtest2_storageptrs[ATOMS_MAX];
-    VMItem HTtest2_storage[ATOMS_MAX];
-    VMItem* HTtest2_HT[ATOMS_HASHTABLE_BUCKETS];
-    HashTable_INIT(&HTtest2, HTtest2_storage, HTtest2_storageptrs, HTtest2_HT, ATOMS_HASHTABLE_BUCKETS, ATOMS_MAX, (Equal) Narsese_StringEqual, (Hash) Narsese_StringHash);
+    static HashTableSlot HTtest2_slots[HASHTABLE_BUCKETS_PER_ITEM*ATOMS_MAX];
+    HashTable_INIT(&HTtest2, HTtest2_slots, HASHTABLE_BUCKETS_PER_ITEM*ATOMS_MAX, (Equal) Narsese_StringEqual, (Hash) Narsese_StringHash);
     char *testname = "test";
     char blockname[ATOMIC_TERM_LEN_MAX] = {0};
     strncpy(blockname, testname, ATOMIC_TERM_LEN_MAX-1);
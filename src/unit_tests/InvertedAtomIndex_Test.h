@@ -22,6 +22,13 @@
  * THE SOFTWARE.
  */
 
+static Concept *InvertedAtomIndex_Test_Posting(char *atom, int k)
+{
+    int size;
+    ConceptPosting *postings = InvertedAtomIndex_GetPostings(Narsese_AtomicTermIndex(atom), &size);
+    return k < size ? postings[k].c : NULL;
+}
+
 void InvertedAtomIndex_Test()
 {
     puts(">>Inverted atom index test start");
@@ -30,38 +37,52 @@ void InvertedAtomIndex_Test()
     Concept c = { .term = term };
     InvertedAtomIndex_AddConcept(term, &c);
     InvertedAtomIndex_Print();
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("a")]->c == &c, "There was no concept reference added for key a!");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("b")]->c == &c, "There was no concept reference added for key b!");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("c")]->c == &c, "There was no concept reference added for key c!");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex(":")] == NULL, "There was a concept reference added for key inheritance!");
+    assert(InvertedAtomIndex_Test_Posting("a", 0) == &c, "There was no concept reference added for key a!");
+    assert(InvertedAtomIndex_Test_Posting("b", 0) == &c, "There was no concept reference added for key b!");
+    assert(InvertedAtomIndex_Test_Posting("c", 0) == &c, "There was no concept reference added for key c!");
+    assert(InvertedAtomIndex_Test_Posting(":", 0) == NULL, "There was a concept reference added for key inheritance!");
     InvertedAtomIndex_RemoveConcept(term, &c);
     InvertedAtomIndex_Print();
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("a")] == NULL, "Concept reference was not removed for key a!");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("b")] == NULL, "Concept reference was not removed for key b!");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("c")] == NULL, "Concept reference was not removed for key c!");
+    assert(InvertedAtomIndex_Test_Posting("a", 0) == NULL, "Concept reference was not removed for key a!");
+    assert(InvertedAtomIndex_Test_Posting("b", 0) == NULL, "Concept reference was not removed for key b!");
+    assert(InvertedAtomIndex_Test_Posting("c", 0) == NULL, "Concept reference was not removed for key c!");
     InvertedAtomIndex_AddConcept(term, &c);
     Term term2 = Narsese_Term("<b --> d>");
     Concept c2 = { .term = term2 };
     InvertedAtomIndex_AddConcept(term2, &c2);
     InvertedAtomIndex_Print();
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("a")]->c == &c, "There was no concept reference added for key a! (2)");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("b")]->c == &c, "There was no concept reference added for key b! (2)");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("c")]->c == &c, "There was no concept reference added for key c! (2)");
-    assert(((ConceptChainElement*) invertedAtomIndex[Narsese_AtomicTermIndex("b")]->next)->c == &c2, "There was no concept2 reference added for key b! (2)");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("d")]->c == &c2, "There was no concept2 reference added for key d! (2)");
+    assert(InvertedAtomIndex_Test_Posting("a", 0) == &c, "There was no concept reference added for key a! (2)");
+    assert(InvertedAtomIndex_Test_Posting("b", 0) == &c, "There was no concept reference added for key b! (2)");
+    assert(InvertedAtomIndex_Test_Posting("c", 0) == &c, "There was no concept reference added for key c! (2)");
+    assert(InvertedAtomIndex_Test_Posting("b", 1) == &c2, "There was no concept2 reference added for key b! (2)");
+    assert(InvertedAtomIndex_Test_Posting("d", 0) == &c2, "There was no concept2 reference added for key d! (2)");
     InvertedAtomIndex_RemoveConcept(term, &c);
     puts("after removal");
     InvertedAtomIndex_Print();
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("b")]->c == &c2, "There was no concept2 reference remaining for key b! (3)");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("d")]->c == &c2, "There was no concept2 reference remaining for key d! (3)");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("a")] == NULL, "Concept reference was not removed for key a! (3)");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("c")] == NULL, "Concept reference was not removed for key c! (3)");
+    assert(InvertedAtomIndex_Test_Posting("b", 0) == &c2, "There was no concept2 reference remaining for key b! (3)");
+    assert(InvertedAtomIndex_Test_Posting("d", 0) == &c2, "There was no concept2 reference remaining for key d! (3)");
+    assert(InvertedAtomIndex_Test_Posting("a", 0) == NULL, "Concept reference was not removed for key a! (3)");
+    assert(InvertedAtomIndex_Test_Posting("c", 0) == NULL, "Concept reference was not removed for key c! (3)");
+    //concepts of higher priority come first:
+    Term term3 = Narsese_Term("<b --> e>");
+    Concept c3 = { .term = term3 };
+    InvertedAtomIndex_AddConcept(term3, &c3);
+    assert(InvertedAtomIndex_Test_Posting("b", 1) == &c3, "Concept3 should have been added after concept2 with same priority!");
+    int rarestSize;
+    Term query = Narsese_Term("<b --> e>");
+    ConceptPosting *rarest = InvertedAtomIndex_GetRarestPostings(&query, &rarestSize);
+    assert(rarestSize == 1 && rarest[0].c == &c3, "The posting list of e should have been the rarest one!");
+    Term query2 = Narsese_Term("<?1 --> ?2>");
+    assert(InvertedAtomIndex_GetRarestPostings(&query2, &rarestSize) == NULL && rarestSize == 0, "A term without simple atom has no posting list!");
+    InvertedAtomIndex_IncreasePriorityKey(term3, &c3, 1.0);
+    assert(InvertedAtomIndex_Test_Posting("b", 0) == &c3 && InvertedAtomIndex_Test_Posting("b", 1) == &c2, "Concept3 should have moved before concept2!");
+    InvertedAtomIndex_RemoveConcept(term3, &c3);
     InvertedAtomIndex_RemoveConcept(term2, &c2);
     puts("after removal2");
     InvertedAtomIndex_Print();
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("a")] == NULL, "Concept reference was not removed for key a! (4)");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("b")] == NULL, "Concept reference was not removed for key b! (4)");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("c")] == NULL, "Concept reference was not removed for key c! (4)");
-    assert(invertedAtomIndex[Narsese_AtomicTermIndex("d")] == NULL, "Concept reference was not removed for key d! (4)");
+    assert(InvertedAtomIndex_Test_Posting("a", 0) == NULL, "Concept reference was not removed for key a! (4)");
+    assert(InvertedAtomIndex_Test_Posting("b", 0) == NULL, "Concept reference was not removed for key b! (4)");
+    assert(InvertedAtomIndex_Test_Posting("c", 0) == NULL, "Concept reference was not removed for key c! (4)");
+    assert(InvertedAtomIndex_Test_Posting("d", 0) == NULL, "Concept reference was not removed for key d! (4)");
     puts(">>Inverted atom index test successul");
 }
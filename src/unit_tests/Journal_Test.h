@@ -0,0 +1,100 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+static int Journal_Test_executed = 0, Journal_Test_executedReplaying = 0;
+void Journal_Test_op(Term args)
+{
+    Journal_Test_executed++;
+    Journal_Test_executedReplaying += Journal_Replaying();
+}
+
+void Journal_Test_Feed()
+{
+    NAR_AddInputNarsese("<(<a --> b> &/ ^left) =/> g>.");
+    NAR_AddInputBelief(Narsese_Term("<e --> f>")); //its atoms are created outside of the recorded call
+    char *knowledge[] = { "<c --> d>.", "<d --> e>. {0.9 0.8}" };
+    NAR_AddInputNarseseBatch(knowledge, NUM_ELEMENTS(knowledge)); //eternal beliefs added without a cycle each
+    NAR_Cycles(10);
+    NAR_AddInputNarsese("<a --> b>. :|:");
+    NAR_AddInputNarsese("g! :|:");
+    NAR_Cycles(5);
+}
+
+void Journal_Test()
+{
+    puts(">>Journal test start");
+    remove("Journal_Test.journal");
+    NAR *recorded = NAR_New(NAR_TEST_CONFIG);
+    NAR_Select(recorded);
+    assert(Journal_Open("Journal_Test.journal"), "Journal should have been opened!");
+    NAR_INIT_Config(NAR_TEST_CONFIG);
+    NAR_AddOperation("^left", Journal_Test_op);
+    Journal_Test_Feed();
+    assert(Journal_Test_executed == 1, "The operation should have been executed!");
+    long recordedTime = currentTime;
+    int recordedConcepts = concepts.itemsAmount;
+    Term ef = Narsese_Term("<e --> f>");
+    Truth recordedTruth = Memory_FindConceptByTerm(&ef)->belief.truth;
+    //a fresh instance catches up, and also executes the operation again
+    NAR *recovered = NAR_New(NAR_TEST_CONFIG);
+    NAR_Select(recovered);
+    NAR_AddOperation("^left", Journal_Test_op);
+    assert(!Journal_Replay("Journal_Test.missing", true), "Replaying a missing journal should fail!");
+    assert(Journal_Replay("Journal_Test.journal", true), "Journal should have been replayed!");
+    assert(Journal_Test_executed == 2 && currentTime == recordedTime && concepts.itemsAmount == recordedConcepts, "Replay should lead to the same state!");
+    assert(Journal_Test_executedReplaying == 1 && !Journal_Replaying(), "The operation should have been executed while catching up!");
+    Term ef2 = Narsese_Term("<e --> f>");
+    Concept *c = Memory_FindConceptByTerm(&ef2);
+    assert(c != NULL && Truth_Equal(&c->belief.truth, &recordedTruth), "Replay should lead to the same beliefs!");
+    //with a snapshot only the input after it has to be replayed
+    NAR_Select(recorded);
+    assert(NAR_Save("Journal_Test.snapshot"), "Snapshot should have been saved!");
+    Journal_Test_Feed();
+    recordedTime = currentTime;
+    recordedConcepts = concepts.itemsAmount;
+    NAR_Delete(recovered);
+    recovered = NAR_New(NAR_TEST_CONFIG);
+    NAR_Select(recovered);
+    NAR_AddOperation("^left", Journal_Test_op);
+    assert(Journal_Replay("Journal_Test.journal", true), "Journal should have been replayed from the snapshot!");
+    assert(currentTime == recordedTime && concepts.itemsAmount == recordedConcepts, "Replay from the snapshot should lead to the same state!");
+    //a record which can't be written closes the journal instead of aborting
+    assert(!Journal_Open("/dev/full"), "A journal without space should not have been opened!");
+    assert(Journal_Open("Journal_Test.journal") && !Journal_Failed(), "Journal should have been opened again!");
+    char questions[QUESTIONS_MAX * NARSESE_LEN_MAX] = {0};
+    while((int) strlen(questions) <= JOURNAL_RECORD_MAX)
+    {
+        strcat(questions, "<cccccccccc --> dddddddddd>? ");
+    }
+    NAR_AddInputNarseseQuestions(questions);
+    assert(Journal_Failed(), "A record larger than JOURNAL_RECORD_MAX should have failed!");
+    NAR_AddInputNarsese("<a --> b>. :|:");
+    assert(Journal_Failed() && Journal_Open("Journal_Test.journal") && !Journal_Failed(), "The journal should stay closed until it's opened again!");
+    NAR_Select(NULL);
+    NAR_Delete(recovered);
+    NAR_Delete(recorded);
+    remove("Journal_Test.journal");
+    remove("Journal_Test.snapshot");
+    puts("<<Journal test successful");
+}
@@ -30,8 +30,8 @@ void Memory_Test()
                                EVENT_TYPE_BELIEF, 
                                (Truth) { .frequency = 1, .confidence = 0.9 }, 
                                0, 0);
-    Memory_AddInputEvent(&e, 0);
-    assert(belief_events.array[0][0].truth.confidence == (double) 0.9, "event has to be there"); //identify
+    Memory_AddInputEvent(&e, 0, true);
+    assert(belief_events->array[0][0].truth.confidence == (double) 0.9, "event has to be there"); //identify
     Memory_Conceptualize(&e.term, 1);
     Concept *c1 = Memory_FindConceptByTerm(&e.term);
     assert(c1 != NULL, "Concept should have been created!");
@@ -39,9 +39,76 @@ void Memory_Test()
                                EVENT_TYPE_BELIEF, 
                                (Truth) { .frequency = 1, .confidence = 0.9 }, 
                                0, 0);
-    Memory_AddInputEvent(&e2, 0);
+    Memory_AddInputEvent(&e2, 0, true);
     Memory_Conceptualize(&e2.term, 1);
     Concept *c2 = Memory_FindConceptByTerm(&e2.term);
     assert(c2 != NULL, "Concept should have been created!");
+    assert(c2->precondition_beliefs[0] == NULL, "Implication table should only be taken from the pool on first use!");
+    Table *table = Memory_PreconditionTable(c2, 0);
+    assert(table != NULL && table->itemsAmount == 0, "Implication table should have been taken from the pool!");
+    assert(Memory_PreconditionTable(c2, 0) == table, "Implication table should be taken from the pool only once!");
+    assert(operation_conceptsAmount[0] == 1 && operation_concepts[0][0] == c2, "Concept should be indexed for the operation!");
+    int tablesFree = precondition_table_stack.stackpointer;
+    Memory_ReleasePreconditionTables(c2);
+    assert(c2->precondition_beliefs[0] == NULL && precondition_table_stack.stackpointer == tablesFree+1, "Implication table should have been returned to the pool!");
+    assert(operation_conceptsAmount[0] == 0, "Concept should not be indexed for the operation anymore!");
+    //the duplicate check hashtable has to stay in sync with pushes, evictions and pops of the cycling events:
+    Memory_ClearCyclingEvents(&cycling_belief_events);
+    Event cycling[CYCLING_BELIEF_EVENTS_MAX+10];
+    for(int i=0; i<CYCLING_BELIEF_EVENTS_MAX+10; i++)
+    {
+        char name[20];
+        sprintf(name, "cycling%d", i);
+        cycling[i] = Event_InputEvent(Narsese_AtomicTerm(name), EVENT_TYPE_BELIEF, (Truth) { .frequency = 1, .confidence = 0.9 }, 0, 0);
+        assert(Memory_addCyclingEvent(&cycling[i], 0.5 + i / 1000.0, false, 0), "Cycling event should have been added!");
+        assert(!Memory_addCyclingEvent(&cycling[i], 0.5 + i / 1000.0, false, 0), "Duplicate cycling event should have been rejected!");
+    }
+    assert(cycling_belief_events.itemsAmount == CYCLING_BELIEF_EVENTS_MAX, "Cycling events should have been evicted!");
+    for(int i=0; i<cycling_belief_events.itemsAmount; i++)
+    {
+        Event *queued = cycling_belief_events.items[i].address;
+        assert(HashTable_Get(&HTcycling_belief_events, queued) == queued, "Cycling event should be in the hashtable!");
+    }
+    assert(Memory_addCyclingEvent(&cycling[0], 1.0, false, 0), "Evicted cycling event should not count as duplicate!");
+    Event *popped;
+    double poppedPriority;
+    assert(Memory_PopCyclingEvent(&cycling_belief_events, &popped, &poppedPriority) && Event_Equal(popped, &cycling[0]), "Highest priority event should have been popped!");
+    assert(Memory_addCyclingEvent(&cycling[0], 1.0, false, 0), "Popped cycling event should not count as duplicate!");
+    Memory_ClearCyclingEvents(&cycling_belief_events);
+    assert(Memory_addCyclingEvent(&cycling[0], 1.0, false, 0), "Cleared cycling event should not count as duplicate!");
+    //capacities can be set at runtime, and are kept on reset:
+    NAR_INIT_Config((Memory_Config) { .conceptsMax = 8, .cyclingBeliefEventsMax = 4, .cyclingGoalEventsMax = 4, .preconditionTablesMax = 2, .atomsMax = 256 });
+    NAR_INIT();
+    for(int i=0; i<20; i++)
+    {
+        Memory_Conceptualize(&cycling[i].term, 1);
+        Memory_addCyclingEvent(&cycling[i], 0.5 + i / 1000.0, false, 0);
+    }
+    assert(concepts.itemsAmount == 8 && cycling_belief_events.itemsAmount == 4, "Memory should be limited to the configured capacities!");
+    assert(Memory_PreconditionTable(concepts.items[0].address, 0) != NULL && Memory_PreconditionTable(concepts.items[1].address, 0) != NULL, "Configured tables should be available!");
+    assert(Memory_PreconditionTable(concepts.items[2].address, 0) == NULL, "Table pool should be limited to the configured capacity!");
+    //a reset clears the kept arena, so snapshots don't write bytes left over from before:
+    FILE *before = tmpfile(), *after = tmpfile();
+    NAR_INIT();
+    assert(before != NULL && after != NULL && Memory_WriteArena(before), "Arena should have been written!");
+    NAR_AddInputNarsese("<(a &/ ^left) =/> b>.");
+    NAR_AddInputNarsese("<x --> y>. :|:");
+    NAR_Cycles(5);
+    NAR_INIT();
+    assert(Memory_WriteArena(after), "Arena should have been written!");
+    rewind(before);
+    rewind(after);
+    int byteBefore, byteAfter;
+    do
+    {
+        byteBefore = fgetc(before);
+        byteAfter = fgetc(after);
+    }
+    while(byteBefore == byteAfter && byteBefore != EOF);
+    assert(byteBefore == EOF && byteAfter == EOF, "The arena should be the same after each reset!");
+    fclose(before);
+    fclose(after);
+    NAR_INIT_Config(MEMORY_CONFIG_DEFAULT);
+    assert(concepts.maxElements == CONCEPTS_MAX, "Default capacities should have been restored!");
     puts("<<Memory test successful");
 }
@@ -0,0 +1,205 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <pthread.h>
+
+#define NAR_TEST_CONFIG ((Memory_Config) { .conceptsMax = 64, .cyclingBeliefEventsMax = 8, .cyclingGoalEventsMax = 8, .preconditionTablesMax = 16, .atomsMax = 256 })
+
+void *NAR_Test_Thread_Run(void *instance)
+{
+    for(int i=0; i<10; i++)
+    {
+        NAR_Acquire(instance);
+        NAR_AddInputNarsese("<agent --> [active]>. :|:");
+        NAR_Cycles(5);
+        NAR_Release();
+    }
+    return NULL;
+}
+
+void *NAR_Test_Concurrent_Run(void *instance)
+{
+    NAR_Select(instance);
+    for(int i=0; i<10; i++)
+    {
+        NAR_AddInputNarsese("<{tom} --> cat>. :|:");
+        NAR_AddInputNarsese("<cat --> animal>.");
+        NAR_AddInputNarsese("<(<$1 --> cat> &/ ^pet) =/> <$1 --> [purring]>>.");
+        NAR_Cycles(5);
+    }
+    NAR_Select(NULL);
+    return NULL;
+}
+
+//Write a copy of a snapshot with a field of it changed
+void NAR_Test_ChangeSnapshot(char *path, char *changedPath, size_t offset, unsigned int value)
+{
+    FILE *file = fopen(path, "rb");
+    assert(file != NULL, "Snapshot to change not found!");
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    rewind(file);
+    char *content = malloc(size);
+    assert(content != NULL && (long) fread(content, 1, size, file) == size, "Snapshot to change could not be read!");
+    fclose(file);
+    memcpy(&content[offset], &value, sizeof(value));
+    file = fopen(changedPath, "wb");
+    assert(file != NULL && (long) fwrite(content, 1, size, file) == size, "Changed snapshot could not be written!");
+    fclose(file);
+    free(content);
+}
+
+//Whether two instances reached the same state, the concepts of the other instance stay in its memory when it's not selected
+bool NAR_Test_SameState(NAR *a, NAR *b)
+{
+    NAR_Select(a);
+    long time = currentTime;
+    long matched = Stats_countConceptsMatchedTotal;
+    PriorityQueue conceptsA = concepts;
+    NAR_Select(b);
+    bool same = time == currentTime && matched == Stats_countConceptsMatchedTotal && conceptsA.itemsAmount == concepts.itemsAmount;
+    for(int i=0; same && i<concepts.itemsAmount; i++)
+    {
+        Concept *c = conceptsA.items[i].address, *c2 = concepts.items[i].address;
+        same = Term_Equal(&c->term, &c2->term) && Truth_Equal(&c->belief.truth, &c2->belief.truth) && Truth_Equal(&c->belief_spike.truth, &c2->belief_spike.truth);
+    }
+    NAR_Select(NULL);
+    return same;
+}
+
+void NAR_Test()
+{
+    puts(">>NAR test start");
+    NAR_INIT();
+    NAR_AddInputNarsese("<x --> y>.");
+    long defaultTime = currentTime;
+    int defaultConcepts = concepts.itemsAmount;
+    NAR *first = NAR_New(NAR_TEST_CONFIG);
+    NAR *second = NAR_New(NAR_TEST_CONFIG);
+    assert(NAR_Selected() != first && NAR_Selected() != second, "Creating instances should not select them!");
+    NAR_Select(first);
+    PRINT_INPUT = false;
+    NAR_AddInputNarsese("<a --> b>.");
+    NAR_Select(second);
+    assert(PRINT_INPUT && currentTime == 1 && concepts.itemsAmount == 0, "Instances should not share their state!");
+    NAR_AddInputNarsese("<c --> d>.");
+    NAR_AddInputNarsese("<c --> d>.");
+    Term ab = Narsese_Term("<a --> b>");
+    assert(Memory_FindConceptByTerm(&ab) == NULL && currentTime == 3, "The other instance's input should not be in this one!");
+    NAR_Select(first);
+    Term ab2 = Narsese_Term("<a --> b>");
+    assert(Memory_FindConceptByTerm(&ab2) != NULL && currentTime == 2 && concepts.maxElements == 64, "The instance should have kept its memory!");
+    NAR_Select(NULL);
+    Term xy = Narsese_Term("<x --> y>");
+    assert(Memory_FindConceptByTerm(&xy) != NULL && currentTime == defaultTime && concepts.itemsAmount == defaultConcepts, "The default instance should be unaffected!");
+    //instances can be stepped from separate threads, which take turns
+    pthread_t threads[2];
+    pthread_create(&threads[0], NULL, NAR_Test_Thread_Run, first);
+    pthread_create(&threads[1], NULL, NAR_Test_Thread_Run, second);
+    pthread_join(threads[0], NULL);
+    pthread_join(threads[1], NULL);
+    NAR_Select(first);
+    assert(currentTime == 2 + 10*6, "The thread should have stepped its instance!");
+    //a saved instance can be loaded into another one, which continues from the same state
+    NAR_Select(second);
+    assert(NAR_Save("NAR_Test.snapshot"), "Snapshot should have been saved!");
+    long savedTime = currentTime;
+    int savedConcepts = concepts.itemsAmount;
+    Term cd = Narsese_Term("<c --> d>");
+    Truth savedTruth = Memory_FindConceptByTerm(&cd)->belief.truth;
+    NAR *loaded = NAR_New(NAR_TEST_CONFIG);
+    NAR_Select(loaded);
+    assert(!NAR_Load("NAR_Test.missing") && currentTime == 1, "Loading a missing snapshot should fail!");
+    NAR_Test_ChangeSnapshot("NAR_Test.snapshot", "NAR_Test.changed", offsetof(NAR_SnapshotHeader, version), NAR_SNAPSHOT_VERSION+1);
+    assert(!NAR_Load("NAR_Test.changed") && currentTime == 1, "A snapshot of another version should be rejected!");
+    NAR_Test_ChangeSnapshot("NAR_Test.snapshot", "NAR_Test.changed", offsetof(NAR_SnapshotHeader, byteOrder), 0x04030201);
+    assert(!NAR_Load("NAR_Test.changed") && currentTime == 1, "A snapshot of the other byte order should be rejected!");
+    //corrupted amounts and indices are rejected before they are used
+    size_t state = sizeof(NAR_SnapshotHeader), arena = state + sizeof(NAR_Snapshot);
+    NAR_Test_ChangeSnapshot("NAR_Test.snapshot", "NAR_Test.changed", state + offsetof(NAR_Snapshot, conceptsAmount), NAR_TEST_CONFIG.conceptsMax+1);
+    assert(!NAR_Load("NAR_Test.changed") && currentTime == 1, "A snapshot with more concepts than its capacity should be rejected!");
+    NAR_Test_ChangeSnapshot("NAR_Test.snapshot", "NAR_Test.changed", state + offsetof(NAR_Snapshot, operation_conceptsAmount), -1);
+    assert(!NAR_Load("NAR_Test.changed") && currentTime == 1, "A snapshot with a negative amount should be rejected!");
+    NAR_Test_ChangeSnapshot("NAR_Test.snapshot", "NAR_Test.changed", state + offsetof(NAR_Snapshot, memoryConfig), 1000000);
+    assert(!NAR_Load("NAR_Test.changed") && currentTime == 1, "A snapshot with capacities its arena doesn't have should be rejected!");
+    NAR_Test_ChangeSnapshot("NAR_Test.snapshot", "NAR_Test.changed", arena + offsetof(Concept, queuePosition), NAR_TEST_CONFIG.conceptsMax);
+    assert(!NAR_Load("NAR_Test.changed") && currentTime == 1, "A snapshot with an index beyond the storage in its arena should be rejected!");
+    NAR_Test_ChangeSnapshot("NAR_Test.snapshot", "NAR_Test.changed", arena + offsetof(Concept, precondition_beliefs), 0xFFFFFFFF);
+    assert(!NAR_Load("NAR_Test.changed") && currentTime == 1, "A snapshot with a pointer beyond its arena should be rejected!");
+    remove("NAR_Test.changed");
+    assert(NAR_Load("NAR_Test.snapshot") && currentTime == savedTime && concepts.itemsAmount == savedConcepts, "Snapshot should have been loaded!");
+    Term cd2 = Narsese_Term("<c --> d>");
+    Concept *c = Memory_FindConceptByTerm(&cd2);
+    assert(c != NULL && c->belief.truth.confidence == savedTruth.confidence && c == HashTable_Get(&HTconcepts, &c->term), "Loaded concepts should be retrievable!");
+    NAR_Test_Thread_Run(loaded);
+    NAR_Select(loaded);
+    assert(currentTime == savedTime + 10*6, "Loaded instance should continue!");
+    NAR_Delete(loaded);
+    remove("NAR_Test.snapshot");
+    //a batch of sentences leads to the same state as adding them one by one, the eternal beliefs are only not echoed
+    char *sentences[] = { "<cat --> animal>.", "<animal --> [alive]>. {0.9 0.8}", "<{tom} --> cat>.", "<(<$1 --> cat> &/ ^pet) =/> <$1 --> [purring]>>.",
+                          "<cat --> animal>. {1.0 0.5}", "<{tom} --> [alive]>?", "<{tom} --> cat>. :|:", "<{tom} --> [purring]>! :|:",
+                          "dt=2 <{tom} --> [happy]>. :|: %1.0;0.9%" };
+    NAR *sequential = NAR_New(NAR_TEST_CONFIG);
+    NAR_Select(sequential);
+    for(unsigned int i=0; i<NUM_ELEMENTS(sentences); i++)
+    {
+        NAR_AddInputNarsese(sentences[i]);
+    }
+    NAR *batched = NAR_New(NAR_TEST_CONFIG);
+    NAR_Select(batched);
+    NAR_AddInputNarseseBatch(sentences, NUM_ELEMENTS(sentences));
+    assert(NAR_Test_SameState(sequential, batched), "The batch should lead to the same state!");
+    //instances selected on separate threads run at the same time, which gives the same result as running them one after another
+    NAR *concurrent[2], *separate[2];
+    for(int i=0; i<2; i++)
+    {
+        concurrent[i] = NAR_New(NAR_TEST_CONFIG);
+        separate[i] = NAR_New(NAR_TEST_CONFIG);
+        NAR_Select(concurrent[i]);
+        INFERENCE_THREADS = DETERMINISTIC_INFERENCE = i; //the second one with parallel inference on the thread's workers
+        NAR_Select(separate[i]);
+        INFERENCE_THREADS = DETERMINISTIC_INFERENCE = i;
+    }
+    NAR_Select(NULL);
+    pthread_create(&threads[0], NULL, NAR_Test_Concurrent_Run, concurrent[0]);
+    pthread_create(&threads[1], NULL, NAR_Test_Concurrent_Run, concurrent[1]);
+    pthread_join(threads[0], NULL);
+    pthread_join(threads[1], NULL);
+    NAR_Test_Concurrent_Run(separate[0]);
+    NAR_Test_Concurrent_Run(separate[1]);
+    for(int i=0; i<2; i++)
+    {
+        assert(NAR_Test_SameState(concurrent[i], separate[i]), "Instances running at the same time should not affect each other!");
+        NAR_Delete(concurrent[i]);
+        NAR_Delete(separate[i]);
+    }
+    NAR_Select(first);
+    NAR_Delete(sequential);
+    NAR_Delete(batched);
+    NAR_Delete(first);
+    assert(NAR_Selected() != first && currentTime == defaultTime, "Deleting the selected instance should select the default one!");
+    NAR_Delete(second);
+    puts("<<NAR test successful");
+}
@@ -22,14 +22,167 @@
  * THE SOFTWARE.
  */
 
+//The multi-pass parsing by expansion and prefix transformation, to compare the single-pass parser with:
+//upper bound of multplier 3 given by [ becoming "(' " replacement
+#define NARSESE_TEST_REPLACEMENT_LEN 3*NARSESE_LEN_MAX
+//size for the expanded array with spaces for tokenization, has at most 3 times the amount of chars as the replacement array
+#define NARSESE_TEST_EXPANSION_LEN NARSESE_TEST_REPLACEMENT_LEN*3
+
+//Expands Narsese into by strtok(str," ") tokenizable string with canonical copulas
+static char* Narsese_Test_Expand(char *narsese)
+{
+    static char narsese_replaced[NARSESE_TEST_REPLACEMENT_LEN];
+    static char narsese_expanded[NARSESE_TEST_EXPANSION_LEN];
+    memset(narsese_replaced, ' ', NARSESE_TEST_REPLACEMENT_LEN);
+    memset(narsese_expanded, ' ', NARSESE_TEST_EXPANSION_LEN);
+    int n = strlen(narsese);
+    assert(n+3 <= NARSESE_LEN_MAX, "NARSESE_LEN_MAX too small for the test input!");
+    int j=0;
+    for(int i=0; i<n; )
+    {
+        j += Narsese_CanonicalCopula(narsese, n, &i, &narsese_replaced[j]);
+    }
+    narsese_replaced[j] = 0;
+    int k = 0;
+    for(int i=0; i<=j; i++)
+    {
+        bool opener_closer = false;
+        if(narsese_replaced[i] == '(' || narsese_replaced[i] == ')')
+        {
+            k+=1;
+            opener_closer = true;
+        }
+        narsese_expanded[k] = narsese_replaced[i];
+        if(narsese_replaced[i] == 0)
+        {
+            break;
+        }
+        if(opener_closer)
+        {
+            k+=1;
+        }
+        k+=1;
+    }
+    narsese_expanded[k] = 0;
+    return narsese_expanded;
+}
+
+static int Narsese_Test_SkipCompound(char** tokens, int i, int nt)
+{
+    int parenthesis_cnt = 0;
+    for(; i<nt; i++)
+    {
+        if(tokens[i][0] == '(' && tokens[i][1] == 0)
+        {
+            parenthesis_cnt += 1;
+        }
+        if(tokens[i][0] == ')' && tokens[i][1] == 0)
+        {
+            parenthesis_cnt -= 1;
+        }
+        if(parenthesis_cnt==0)
+        {
+            return i+1;
+        }
+    }
+    return i;
+}
+
+//Tokenize expanded Narsese in prefix copula order
+static char** Narsese_Test_PrefixTransform(char* narsese_expanded)
+{
+    static char* tokens[NARSESE_LEN_MAX+1]; //there cannot be more tokens than chars
+    memset(tokens, 0, (NARSESE_LEN_MAX+1)*sizeof(char*)); //and last one stays NULL for sure
+    char* token = strtok(narsese_expanded, " ");
+    int nt = 0, nc = NUM_ELEMENTS(Naresese_CanonicalCopulas) - 1;
+    while(token)
+    {
+        tokens[nt] = token;
+        token = strtok(NULL, " ");
+        nt++;
+    }
+    for(int i=0; i<nt-2; i++)
+    {
+        if(tokens[i][0] == '(' && tokens[i][1] == 0)   //see if it's in prefix form
+        {
+            for(int k=0; k<nc; k++)
+            {
+                if(tokens[i+1][0] == (int) Naresese_CanonicalCopulas[k] && tokens[i+1][1] == 0)
+                {
+                    goto Continue;
+                }
+            }
+            //it's not a copula, so its in infix form, we need to find its copula and put it before tokens[i+1]
+            int i2 = Narsese_Test_SkipCompound(tokens, i+1, nt);
+            if(i2 < nt)
+            {
+                //1. backup copula token
+                char copula = tokens[i2][0];
+                //2. shift all tokens forward up to copula position and set the copula to be at i+1 instead
+                for(int j=i2; j>=i+2; j--)
+                {
+                    char *temp = tokens[j];
+                    tokens[j] = tokens[j-1];
+                    tokens[j-1] = temp;
+                }
+                tokens[i+1][0] = copula;
+                tokens[i+1][1] = 0;
+            }
+        }
+        Continue:;
+    }
+    return tokens;
+}
+
+static void Narsese_Test_BuildBinaryTree(Term *bintree, char** tokens_prefix, int i1, int tree_index, int nt)
+{
+    if(tokens_prefix[i1][0] == '(' && tokens_prefix[i1][1] == 0)
+    {
+        int icop = i1+1;
+        i1 = i1+2;
+        int i2 = Narsese_Test_SkipCompound(tokens_prefix, i1, nt);
+        bintree->atoms[tree_index-1] = Narsese_AtomicTermIndex(tokens_prefix[icop]);
+        if(i1<nt)
+        {
+            Narsese_Test_BuildBinaryTree(bintree, tokens_prefix, i1, tree_index*2, nt);
+        }
+        if(i2<nt)
+        {
+            Narsese_Test_BuildBinaryTree(bintree, tokens_prefix, i2, tree_index*2+1, nt);
+        }
+    }
+    else
+    {
+        if(!(tokens_prefix[i1][0] == ')' && tokens_prefix[i1][1] == 0))
+        {
+            bintree->atoms[tree_index-1] = Narsese_AtomicTermIndex(tokens_prefix[i1]);
+        }
+        else
+        {
+            bintree->atoms[tree_index-1] = Narsese_CopulaIndex(SET_TERMINATOR);
+        }
+    }
+}
+
+static Term Narsese_Test_MultiPassTerm(char *narsese)
+{
+    Term ret = {0};
+    char** tokens_prefix = Narsese_Test_PrefixTransform(Narsese_Test_Expand(narsese));
+    int nt = 0; for(;tokens_prefix[nt] != NULL; nt++){}
+    Narsese_Test_BuildBinaryTree(&ret, tokens_prefix, 0, 1, nt);
+    Variable_Normalize(&ret);
+    Term_Hash(&ret);
+    return ret;
+}
+
 void Narsese_Test()
 {
     puts(">>Narsese test start");
     char* narsese = "<<$sth --> (&,[furry,meowing],animal)> =/> <$sth --> [good]>>";
     printf("Narsese: %s\n", narsese);
-    char* preprocessed = Narsese_Expand(narsese);
+    char* preprocessed = Narsese_Test_Expand(narsese);
     printf("Preprocessed: %s\n", preprocessed);
-    char **tokens = Narsese_PrefixTransform(preprocessed);
+    char **tokens = Narsese_Test_PrefixTransform(preprocessed);
     int k = 0;
     for(;tokens[k] != NULL;k++)
     {
@@ -46,6 +199,17 @@ void Narsese_Test()
     puts("Result:");
     Narsese_PrintTerm(&ret);
     puts("");
+    //the single-pass parser encodes the same terms as the expansion and prefix transformation
+    char *sentences[] = { "<a --> b>", "<(a &/ ^left) =/> <b <-> c>>", "(&/,<a --> [seen]>,+5,(^go,{SELF},x))", "<{a,b} --> [c d]>",
+                          "(--,<a --> b>)", "(-- <a --> b>)", "<(/,rel,_,b) --> a>", "<(\\,rel,a,_) --> b>", "(/1 a b)", "(\\2 a b)",
+                          "<<$1 --> a> ==> (&&,<#1 --> b>,<$1 --> c>)>", "<(a || b) <=> <?1 --> d>>", "(a * b)", "(*,a,b,c)",
+                          "<(&,[furry,meowing],animal) --> (|,cat,dog)>", "(a - b)", "(a ~ b)", "atom", "<a --> b> --> c", "{a}" };
+    for(unsigned int i=0; i<NUM_ELEMENTS(sentences); i++)
+    {
+        Term multiPass = Narsese_Test_MultiPassTerm(sentences[i]);
+        Term singlePass = Narsese_Term(sentences[i]);
+        assert(Term_Equal(&multiPass, &singlePass), "The single-pass parser should encode the same term!");
+    }
     puts(">>Narsese Test successul");
     Narsese_PrintTerm(&ret);
     puts("");
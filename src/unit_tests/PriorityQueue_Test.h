@@ -49,5 +49,19 @@ void PriorityQueue_Test()
             evictions++;
         }
     }
+    //removing an item in the middle has to keep the min and max retrievable:
+    void *removed = NULL;
+    assert(PriorityQueue_PopAt(&queue, 3, &removed) && removed != NULL, "item should have been removed");
+    double minPriority = queue.items[0].priority, maxPriority = minPriority;
+    for(int i=0; i<queue.itemsAmount; i++)
+    {
+        minPriority = MIN(minPriority, queue.items[i].priority);
+        maxPriority = MAX(maxPriority, queue.items[i].priority);
+    }
+    double poppedPriority = 0;
+    PriorityQueue_PopMin(&queue, NULL, &poppedPriority);
+    assert(poppedPriority == minPriority, "PopAt should have kept the min at the root");
+    PriorityQueue_PopMax(&queue, NULL, &poppedPriority);
+    assert(poppedPriority == maxPriority, "PopAt should have kept the max retrievable");
     puts("<<PriorityQueue test successful");
 }
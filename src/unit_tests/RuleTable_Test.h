@@ -26,8 +26,19 @@ void RuleTable_Test()
 {
     puts(">>RuleTable test start");
     NAR_INIT();
+    RULE_STATS = true;
     NAR_AddInput(Narsese_Term("<cat --> animal>"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, true, 0);
     NAR_AddInput(Narsese_Term("<animal --> being>"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, true, 0);
     NAR_Cycles(1);
+    RULE_STATS = RULE_STATS_INITIAL;
+#if STAGE==2
+    long derivations = 0;
+    for(int i=0; i<RuleTable_rulesAmount; i++)
+    {
+        assert(Stats_rules[i].unifications <= Stats_rules[i].attempts, "Rules can't unify more often than they were tried");
+        derivations += Stats_rules[i].derivations;
+    }
+    assert(derivations > 0, "The deduction should have been counted");
+#endif
     puts(">>RuleTable test successul");
 }
@@ -26,25 +26,25 @@ void Stack_Test()
 {
     puts(">>Stack test start");
     Stack stack = {0};
-    VMItem* storageptrs[CONCEPTS_MAX];
+    HashTableSlot* storageptrs[CONCEPTS_MAX];
     Stack_INIT(&stack, (void**) storageptrs, CONCEPTS_MAX);
     Concept c1 = {0};
     Concept c2 = {0};
-    VMItem item1 = { .value = &c1 };
-    VMItem item2 = { .value = &c2 };
+    HashTableSlot item1 = { .value = &c1 };
+    HashTableSlot item2 = { .value = &c2 };
     Stack_Push(&stack, &item1);
     assert(stack.stackpointer == 1, "Stackpointer wasn't incremented");
-    assert(((VMItem**)stack.items)[0]->value == &c1, "Item should point to c1");
+    assert(((HashTableSlot**)stack.items)[0]->value == &c1, "Item should point to c1");
     assert(!Stack_IsEmpty(&stack), "Stack should not be empty");
-    VMItem *item1_popped = Stack_Pop(&stack);
+    HashTableSlot *item1_popped = Stack_Pop(&stack);
     assert(stack.stackpointer == 0, "Stackpointer wasn't decremented");
     assert(item1_popped->value == &c1, "Popped item1 should point to c1 (1)");
     Stack_Push(&stack, &item1);
     Stack_Push(&stack, &item2);
     assert(stack.stackpointer == 2, "Stackpointer wrong");
-    VMItem *item2_popped = Stack_Pop(&stack);
+    HashTableSlot *item2_popped = Stack_Pop(&stack);
     assert(item2_popped->value == &c2, "Popped item2 should point to c2");
-    VMItem *item1_popped_again = Stack_Pop(&stack);
+    HashTableSlot *item1_popped_again = Stack_Pop(&stack);
     assert(item1_popped_again->value == &c1, "Popped item1 should point to c1 (2)");
     assert(Stack_IsEmpty(&stack), "Stack should be empty");
     puts(">>Stack test successul");
@@ -33,5 +33,22 @@ void Stamp_Test()
     fputs("zipped:", stdout);
     Stamp_print(&stamp3);
     assert(Stamp_checkOverlap(&stamp1,&stamp2) == true, "Stamp should overlap");
+    //summarized stamps only skip the exact check if no evidence ID can be shared:
+    Stamp input1 = Stamp_input(1), input2 = Stamp_input(2), input65 = Stamp_input(65);
+    Stamp zipped = Stamp_make(&input1, &input2);
+    assert(zipped.summary == (STAMP_SUMMARY_BIT(1) | STAMP_SUMMARY_BIT(2)), "Zipped stamp should summarize both evidence IDs");
+    assert(!Stamp_checkOverlap(&input2, &input65), "Stamps without common summary bits should not overlap");
+    assert(!Stamp_checkOverlap(&input1, &input65), "Summary collision should be resolved by the exact check");
+    assert(Stamp_checkOverlap(&zipped, &input1), "Zipped stamp should overlap with its premise");
+    assert(Stamp_checkOverlap(&zipped, &stamp1), "Summarized stamp should still overlap with an unsummarized one");
+    //a full stamp overlaps with each of its inputs, but not with newer evidence:
+    Stamp disjoint = Stamp_input(STAMP_SIZE+1), full = {0};
+    for(int i=0; i<STAMP_SIZE; i++)
+    {
+        Stamp next = Stamp_input(i+1);
+        full = Stamp_make(&next, &full);
+    }
+    assert(Stamp_checkOverlap(&full, &input1), "Full stamp should overlap with its first input");
+    assert(!Stamp_checkOverlap(&full, &disjoint), "Full stamp should not overlap with a newer input");
     puts("<<Stamp test successful");
 }
@@ -0,0 +1,94 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//The scalar atom scans, to compare the kernels with (also used by Term_Benchmark):
+static bool Term_Test_ScalarEqual(Term *a, Term *b)
+{
+    return memcmp(a->atoms, b->atoms, TERM_ATOMS_SIZE) == 0;
+}
+
+static int Term_Test_ScalarComplexity(Term *term)
+{
+    int s = 0;
+    for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+    {
+        if(term->atoms[i])
+        {
+            s += 1;
+        }
+    }
+    return s;
+}
+
+static bool Term_Test_ScalarHasVariable(Term *term)
+{
+    for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+    {
+        if(Variable_isVariable(term->atoms[i]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool Term_Test_ScalarHasSimpleAtom(Term *term)
+{
+    for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+    {
+        if(Narsese_IsSimpleAtom(term->atoms[i]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Term_Test()
+{
+    puts(">>Term test start");
+    NAR_INIT();
+    Term terms[4] = { Narsese_Term("<(<cat --> [meowing]> &/ <cat --> [furry]>) =/> <cat --> animal>>"),
+                      Narsese_Term("<(<$1 --> [meowing]> &/ <$1 --> [furry]>) =/> <$1 --> animal>>"),
+                      Narsese_Term("<{SELF} --> [good]>"),
+                      Narsese_Term("<(<#1 --> a> &/ <?1 --> b>) =/> (&&,<#1 --> c>,<#1 --> d>)>") };
+    Term last = {0};
+    last.atoms[COMPOUND_TERM_SIZE_MAX-1] = terms[2].atoms[0];
+    for(int i=0; i<4; i++)
+    {
+        for(int j=0; j<4; j++)
+        {
+            assert(Term_Equal(&terms[i], &terms[j]) == Term_Test_ScalarEqual(&terms[i], &terms[j]), "Term_Equal differs from the scalar comparison!");
+        }
+        assert(Term_Complexity(&terms[i]) == Term_Test_ScalarComplexity(&terms[i]), "Term_Complexity differs from the scalar count!");
+        assert(Variable_hasVariable(&terms[i], true, true, true) == Term_Test_ScalarHasVariable(&terms[i]), "Variable_hasVariable differs from the scalar scan!");
+        assert(Narsese_HasSimpleAtom(&terms[i]) == Term_Test_ScalarHasSimpleAtom(&terms[i]), "Narsese_HasSimpleAtom differs from the scalar scan!");
+    }
+    assert(Term_Complexity(&last) == 1 && Term_LowestAtom(Term_AtomsMask(&last)) == COMPOUND_TERM_SIZE_MAX-1, "The last atom position should be in the mask!");
+    assert(!Term_Equal(&last, &terms[2]), "Terms with the same atom at different positions are different!");
+    Term hashed = terms[0];
+    Term_Hash(&hashed);
+    assert(Term_Equal(&hashed, &terms[0]) && Term_Equal(&terms[0], &hashed), "Hashing should not change equality!");
+    puts("<<Term test successful");
+}
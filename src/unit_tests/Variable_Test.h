@@ -0,0 +1,47 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+void Variable_Test()
+{
+    puts(">>Variable test start");
+    NAR_INIT();
+    Term implication = Narsese_Term("<(<cat --> [meowing]> &/ <cat --> [furry]>) =/> <cat --> animal>>");
+    Term expected_implication = Narsese_Term("<(<$1 --> [meowing]> &/ <$1 --> [furry]>) =/> <$1 --> animal>>");
+    Term conjunction = Narsese_Term("(&&,<cat --> [meowing]>,<cat --> [furry]>)");
+    Term expected_conjunction = Narsese_Term("(&&,<#1 --> [meowing]>,<#1 --> [furry]>)");
+    bool success;
+    Term implication_with_vars = Variable_IntroduceImplicationVariables(implication, &success, true);
+    assert(success && Term_Equal(&implication_with_vars, &expected_implication), "Independent variable should have been introduced!");
+    Term conjunction_with_vars = Variable_IntroduceConjunctionVariables(conjunction, &success, true);
+    assert(success && Term_Equal(&conjunction_with_vars, &expected_conjunction), "Dependent variable should have been introduced!");
+    //unification binds each variable to one subterm, which is substituted for it:
+    Term general = Narsese_Term("<($1 &/ <$1 --> [furry]>) =/> #1>");
+    Term specific = Narsese_Term("<(cat &/ <cat --> [furry]>) =/> <cat --> animal>>");
+    Substitution subs = Variable_Unify(&general, &specific);
+    assert(subs.success, "Unification should have succeeded!");
+    Term substituted = Variable_ApplySubstitute(general, subs, &success);
+    assert(success && Term_Equal(&substituted, &specific), "Substitution should have given the specific term!");
+    Term inconsistent = Narsese_Term("<(cat &/ <dog --> [furry]>) =/> <cat --> animal>>");
+    assert(!Variable_Unify(&general, &inconsistent).success, "A variable can't be bound to two different subterms!");
+    puts("<<Variable test successful");
+}
@@ -33,6 +33,11 @@
 #include "Table_Test.h"
 #include "HashTable_Test.h"
 #include "UDP_Test.h"
+#include "Variable_Test.h"
+#include "Term_Test.h"
+#include "Cycle_Test.h"
+#include "NAR_Test.h"
+#include "Journal_Test.h"
 
 void Run_Unit_Tests()
 {
@@ -47,4 +52,9 @@ void Run_Unit_Tests()
     Stack_Test();
     HashTable_Test();
     UDP_Test();
+    Variable_Test();
+    Term_Test();
+    Cycle_Test();
+    NAR_Test();
+    Journal_Test();
 }